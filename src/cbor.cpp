@@ -0,0 +1,85 @@
+#include "cbor.h"
+#include <string.h>
+
+// Major types
+constexpr uint8_t CBOR_UINT = 0;
+constexpr uint8_t CBOR_NEGINT = 1;
+constexpr uint8_t CBOR_TEXT = 3;
+constexpr uint8_t CBOR_ARRAY = 4;
+constexpr uint8_t CBOR_MAP = 5;
+constexpr uint8_t CBOR_SIMPLE = 7;
+
+CborWriter::CborWriter(uint8_t* buffer, size_t capacity) {
+    this->buffer = buffer;
+    this->capacity = capacity;
+    length = 0;
+    overflow = false;
+}
+
+void CborWriter::writeByte(uint8_t value) {
+    if (length >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = value;
+}
+
+void CborWriter::writeHead(uint8_t major, uint64_t value) {
+    uint8_t type = major << 5;
+
+    // Shortest form, as required for deterministic encoding
+    if (value < 24) {
+        writeByte(type | (uint8_t)value);
+        return;
+    }
+
+    uint8_t bytes;
+    if (value <= 0xFF) {
+        writeByte(type | 24);
+        bytes = 1;
+    } else if (value <= 0xFFFF) {
+        writeByte(type | 25);
+        bytes = 2;
+    } else if (value <= 0xFFFFFFFF) {
+        writeByte(type | 26);
+        bytes = 4;
+    } else {
+        writeByte(type | 27);
+        bytes = 8;
+    }
+    for (int8_t i = bytes - 1; i >= 0; i--) {
+        writeByte((uint8_t)(value >> (i * 8)));
+    }
+}
+
+void CborWriter::beginMap(size_t pairs) {
+    writeHead(CBOR_MAP, pairs);
+}
+
+void CborWriter::beginArray(size_t items) {
+    writeHead(CBOR_ARRAY, items);
+}
+
+void CborWriter::writeUint(uint64_t value) {
+    writeHead(CBOR_UINT, value);
+}
+
+void CborWriter::writeInt(int64_t value) {
+    if (value < 0) {
+        writeHead(CBOR_NEGINT, (uint64_t)(-1 - value));
+    } else {
+        writeHead(CBOR_UINT, (uint64_t)value);
+    }
+}
+
+void CborWriter::writeBool(bool value) {
+    writeByte((CBOR_SIMPLE << 5) | (value ? 21 : 20));
+}
+
+void CborWriter::writeString(const char* value) {
+    size_t size = strlen(value);
+    writeHead(CBOR_TEXT, size);
+    for (size_t i = 0; i < size; i++) {
+        writeByte((uint8_t)value[i]);
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef CBOR_H
+#define CBOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Minimal CBOR (RFC 8949) encoder writing into a caller-owned buffer, no
+// allocation. Containers are definite length. Writes past the end set the
+// overflow flag instead of truncating silently.
+class CborWriter {
+private:
+    uint8_t* buffer;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+
+    void writeByte(uint8_t value);
+    void writeHead(uint8_t major, uint64_t value);
+
+public:
+    CborWriter(uint8_t* buffer, size_t capacity);
+
+    void beginMap(size_t pairs);
+    void beginArray(size_t items);
+
+    void writeUint(uint64_t value);
+    void writeInt(int64_t value);
+    void writeBool(bool value);
+    void writeString(const char* value);
+
+    size_t getLength() const { return length; }
+    bool hasOverflowed() const { return overflow; }
+};
+
+#endif // CBOR_H
@@ -1,18 +1,68 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <stdint.h>
+
 // Pin definitions
 constexpr int LED_PIN = 2;
 constexpr int RESET_BUTTON_PIN = 0; // GPIO 0 - Usually the BOOT button on ESP32
 constexpr int TEMP_SENSOR_PIN = 4; // DHT22 temperature & humidity sensor pin
 constexpr int DS18B20_PIN = 15; // DS18B20 temperature sensor pin
 
+// Sensor types compiled in (0 = type and its library are left out)
+#define SENSOR_DHT22_ENABLED 1
+#define SENSOR_DS18B20_ENABLED 1
+
+// Sensor settings
+constexpr int DS18B20_MAX_PROBES = 4; // Max DS18B20 probes cached on one bus
+constexpr uint8_t DS18B20_DEFAULT_RESOLUTION = 12; // Bits (9-12) for probes without a stored setting, 12 bit = 750 ms conversion
+
+// Sensor acquisition task
+#define SENSOR_TASK_ENABLED 1 // 0 = sample inline in loop() (e.g. to compare jitter)
+constexpr int SENSOR_TASK_CORE = 1; // APP_CPU, WiFi/lwIP run on core 0
+constexpr int SENSOR_TASK_PRIORITY = 2; // Above the Arduino loop task (1)
+constexpr uint32_t SENSOR_TASK_STACK = 4096;
+constexpr uint16_t SENSOR_QUEUE_DEPTH = 32; // Readings buffered for the loop task (power of two)
+constexpr unsigned long SENSOR_POLL_INTERVAL = 10; // Poll period while a conversion is pending
+constexpr unsigned long SENSOR_SAMPLE_TIMEOUT = 1000; // Samples slower than this count as timeouts
+constexpr uint8_t SENSOR_STATS_BUCKETS = 20; // log2 duration buckets, 1 us .. 524 ms and above
+
+// In-RAM sample history (/api/history)
+constexpr uint32_t HISTORY_RAM_BUDGET = 48 * 1024; // Bytes shared by all channels, 4 bytes per sample
+constexpr uint32_t HISTORY_SPAN = 24UL * 3600 * 1000; // ms kept, readings are averaged down until this fits the budget
+
+// Flash sample log ("samplelog" partition in partitions.csv)
+#define LOG_PARTITION_LABEL "samplelog"
+constexpr uint8_t LOG_PARTITION_SUBTYPE = 0x40;
+constexpr uint32_t LOG_PAGE_SIZE = 256; // Flash page, the log writes each batch of records into one
+constexpr uint16_t LOG_MAX_SEGMENTS = 512; // Sizes the RAM index (4 bytes per 4 KB segment)
+constexpr int LOG_REPLAY_BATCH = 5; // Records published per MQTT loop during a replay
+
+// Rollup aggregates (12 bytes per window per channel, ~20 KB of heap with 7
+// channels). Closed day windows are saved to NVS ("rollup" namespace), one
+// small blob per day, and restored at boot; the 20 KB nvs partition bounds
+// them to a month, nothing on the device keeps more. The minute and hour
+// tiers and the open windows start empty after a reboot.
+constexpr uint16_t ROLLUP_MINUTE_SLOTS = 60;  // 1 hour of minute windows
+constexpr uint16_t ROLLUP_HOUR_SLOTS = 168;   // 1 week of hour windows
+constexpr uint16_t ROLLUP_DAY_SLOTS = 31;     // 1 month of day windows
+
+// Battery mode: wake on the RTC timer, sample, batch in RTC memory, deep sleep.
+// No AP, web server or flash log; WiFi and MQTT only come up to publish a batch.
+#define LOW_POWER_ENABLED 0
+constexpr unsigned long LOW_POWER_WAKE_INTERVAL = 60000; // Wake period in ms, awake time included
+constexpr uint16_t LOW_POWER_PUBLISH_EVERY = 15; // Publish the batch every N wakes
+constexpr uint16_t LOW_POWER_BATCH_MAX = 64; // Records kept in RTC slow memory, oldest dropped when full
+constexpr unsigned long LOW_POWER_SNTP_TIMEOUT = 3000; // Publish wakes wait this long for SNTP before sending (ms)
+
 // Timing constants
 constexpr unsigned long RESET_HOLD_TIME = 5000; // 5 seconds in milliseconds
 constexpr unsigned long WIFI_CHECK_INTERVAL = 10000; // Check every 10 seconds
 constexpr unsigned long AUTO_RECONNECT_TIMEOUT = 30000; // 30 seconds timeout
 constexpr unsigned long LED_BLINK_INTERVAL = 500; // 500ms blink interval
 constexpr unsigned long TEMP_READ_INTERVAL = 2000; // Read temperature every 2 seconds
+constexpr unsigned long DHT22_SAMPLE_INTERVAL = TEMP_READ_INTERVAL; // DHT22 needs >= 2 s between reads
+constexpr unsigned long DS18B20_SAMPLE_INTERVAL = TEMP_READ_INTERVAL;
 
 // WiFi Access Point settings
 constexpr char AP_PASSWORD[] = "12345678"; // Minimum 8 characters for WPA2
@@ -23,5 +73,67 @@ constexpr char AP_PASSWORD[] = "12345678"; // Minimum 8 characters for WPA2
 #define MQTT_USER "" // Leave empty if no authentication required
 #define MQTT_PASSWORD "" // Leave empty if no authentication required
 #define MQTT_PUBLISH_INTERVAL 2000 // Publish sensor data every 5 seconds
+#define MQTT_KEEPALIVE 15 // Seconds, a PINGREQ goes out after this long without traffic
+#define MQTT_CONNECT_TIMEOUT 10000 // Give up on DNS, TCP connect and CONNACK after this long (ms)
+#define MQTT_BACKOFF_BASE 1000 // First reconnect wait (ms), later waits grow with decorrelated jitter
+#define MQTT_BACKOFF_CAP 120000 // Longest wait between reconnect attempts (ms)
+#define MQTT_DNS_TTL 3600000 // Reuse the resolved broker address this long (ms)
+#define MQTT_QOS 1 // QoS of <base>/samples and the deep-sleep batch: 1 = at least once over a persistent session, repeats carry the same boot and seq
+#define MQTT_INFLIGHT_MAX 8 // QoS 1 messages sent ahead of their PUBACK (1 = stop-and-wait)
+#define MQTT_INFLIGHT_BYTES 16384 // Copies of unacknowledged QoS 1 messages, kept for retransmission
+#define MQTT_TOPIC_MAX 96 // Topics are built in a fixed buffer starting with the base topic
+#define MQTT_PAYLOAD_MAX 4608 // Static payload buffer (JSON or CBOR), one full sample batch must fit
+#define MQTT_REPORT_BY_EXCEPTION 1 // 1 = only publish channels that moved past their deadband
+#define MQTT_HEARTBEAT_INTERVAL 300000 // Publish unchanged channels at least every 5 minutes
+#define MQTT_CONSOLIDATED 0 // 1 = one <base>/state message per cycle with every channel
+#define MQTT_LEGACY_TOPICS 1 // 1 = per-value topics and <sensor>/data, for existing subscribers
+#define MQTT_BATCH_ENABLED 1 // 1 = also publish timestamped samples in batches to <base>/samples
+#define MQTT_BATCH_INTERVAL 30000 // Send a batch at least this often (ms)
+#define MQTT_BATCH_MAX 64 // Samples per batch message, a full batch is sent right away
+#define MQTT_QUEUE_RAM 512 // Samples held in RAM during an outage (24 bytes each), then spilled to the flash log
+#define MQTT_DRAIN_INTERVAL 250 // Min ms between batches while draining a backlog
+#define MQTT_ENCODING_JSON 0
+#define MQTT_ENCODING_CBOR 1
+#define MQTT_ENCODING MQTT_ENCODING_JSON // CBOR: <base>/samples and <base>/state go to .../cbor instead
+#define MQTT_CBOR_SCHEMA 2 // "v" field of CBOR payloads, bump when their layout changes
+
+// Web pages are minified and gzipped at build time (tools/build_web_assets.py).
+// Browsers reuse a page this long, then revalidate it with its ETag. The URLs
+// do not change with the firmware, so this is not "immutable".
+constexpr uint32_t WEB_PAGE_MAX_AGE = 86400; // s
+constexpr uint16_t WEB_EVENT_MAX = 256; // Largest /events frame, the first instance of every sensor
+constexpr uint8_t WEB_SCAN_MAX = 24; // Networks listed by /scan
+constexpr uint16_t WEB_SNAPSHOT_MAX = 768; // /api/sensor body, every instance of every sensor
+constexpr uint8_t WEB_ROUTE_MAX = 32; // HTTP routes with a request counter in /metrics
+// Largest buffer a chunked response waits for. AsyncTCP offers up to its whole
+// send buffer once the client acknowledges, so any token, record or header
+// that fits this goes out eventually; a larger one would wait forever.
+constexpr uint16_t WEB_CHUNK_MIN = 512;
+
+// SNTP servers for sample timestamps (UTC)
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+
+// Report-by-exception deadbands (see field tables in temperature.cpp for absolute/percent mode)
+constexpr float DHT22_TEMPERATURE_DEADBAND = 0.1; // °C
+constexpr float DHT22_HUMIDITY_DEADBAND = 0.5; // %RH
+constexpr float DHT22_HEAT_INDEX_DEADBAND = 1.0; // percent of last published value
+constexpr float DHT22_HEAT_INDEX_DEADBAND_MIN = 0.1; // °C, the percent band never gets narrower
+constexpr float DS18B20_TEMPERATURE_DEADBAND = 0.1; // °C
+
+// Sample filter pipeline (see FilterConfig in sensor.h and filter.h)
+#define FILTER_ENABLED 1 // 0 = pass readings through unfiltered
+constexpr uint8_t FILTER_MEDIAN_MAX = 7; // Largest median window, sizes the per-channel state
+constexpr uint8_t FILTER_REJECT_LIMIT = 3; // Accept a sustained step after this many rate rejections
+constexpr unsigned long FILTER_RESET_GAP = 60000; // Restart a channel's filter after this long without data
+
+// {maxRate unit/s, median N, EWMA alpha, Kalman Q, Kalman R}. Tuned on the
+// modelled traces in test/test_filter: maxRate sits above the fastest real
+// change (heater, shower, probe dropped into water), the 85 °C and DHT22
+// bit errors above it are dropped, the median removes the smaller ones.
+#define DHT22_TEMPERATURE_FILTER {0.5f, 3, 0.5f, 0.0f, 0.0f}
+#define DHT22_HUMIDITY_FILTER {2.0f, 3, 0.7f, 0.0f, 0.0f}
+#define DHT22_HEAT_INDEX_FILTER {4.0f, 5, 0.5f, 0.0f, 0.0f}
+#define DS18B20_TEMPERATURE_FILTER {5.0f, 1, 1.0f, 0.01f, 0.01f}
 
 #endif // CONFIG_H
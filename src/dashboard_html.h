@@ -1,7 +1,7 @@
 #ifndef DASHBOARD_HTML_H
 #define DASHBOARD_HTML_H
 
-// HTML for the temperature/humidity dashboard
+// HTML for the temperature/humidity dashboard, served gzipped from web_assets.h (tools/build_web_assets.py)
 const char dashboard_html[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
@@ -276,6 +276,13 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
 
     <script>
         let autoRefreshInterval;
+        let eventSource;
+        let latestData = {};
+
+        // null or missing shows as '--' instead of breaking the update
+        function formatValue(value) {
+            return typeof value === 'number' ? value.toFixed(1) : '--';
+        }
 
         function updateData(data) {
             const statusDHT22 = document.getElementById('statusDHT22');
@@ -288,9 +295,9 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
 
             // Update DHT22 data
             if (data.dht22 && data.dht22.valid) {
-                tempElement.textContent = data.dht22.temperature.toFixed(1);
-                humidityElement.textContent = data.dht22.humidity.toFixed(1);
-                heatIndexElement.textContent = data.dht22.heatIndex.toFixed(1);
+                tempElement.textContent = formatValue(data.dht22.temperature);
+                humidityElement.textContent = formatValue(data.dht22.humidity);
+                heatIndexElement.textContent = formatValue(data.dht22.heatIndex);
 
                 statusDHT22.className = 'status online';
                 statusDHT22.textContent = '📡 DHT22 Sensor Online';
@@ -305,7 +312,7 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
 
             // Update DS18B20 data
             if (data.ds18b20 && data.ds18b20.valid) {
-                tempDS18B20Element.textContent = data.ds18b20.temperature.toFixed(1);
+                tempDS18B20Element.textContent = formatValue(data.ds18b20.temperature);
 
                 statusDS18B20.className = 'status online';
                 statusDS18B20.textContent = '📡 DS18B20 Sensor Online';
@@ -333,6 +340,7 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
             fetch('/api/sensor')
                 .then(response => response.json())
                 .then(data => {
+                    latestData = data;
                     updateData(data);
                 })
                 .catch(error => {
@@ -352,23 +360,58 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
                 });
         }
 
-        // Auto-refresh every 5 seconds
-        function startAutoRefresh() {
+        // Fallback: poll every 5 seconds while live updates are unavailable
+        function startPolling() {
+            if (!autoRefreshInterval) {
+                autoRefreshInterval = setInterval(refreshData, 5000);
+            }
+        }
+
+        function stopPolling() {
+            clearInterval(autoRefreshInterval);
+            autoRefreshInterval = null;
+        }
+
+        // Live updates: the device pushes the sensors read in each cycle
+        function startLiveUpdates() {
             refreshData(); // Initial load
-            autoRefreshInterval = setInterval(refreshData, 5000);
+            if (!window.EventSource) {
+                startPolling();
+                return;
+            }
+            eventSource = new EventSource('/events');
+            eventSource.addEventListener('reading', function(event) {
+                stopPolling();
+                // Merge per sensor, a frame does not carry everything /api/sensor has (probes)
+                const update = JSON.parse(event.data);
+                for (const name in update) {
+                    latestData[name] = Object.assign({}, latestData[name], update[name]);
+                }
+                updateData(latestData);
+            });
+            // The browser reconnects by itself, poll until the next reading arrives
+            eventSource.onerror = startPolling;
+        }
+
+        function stopLiveUpdates() {
+            stopPolling();
+            if (eventSource) {
+                eventSource.close();
+                eventSource = null;
+            }
         }
 
-        // Stop auto-refresh when page is not visible
+        // Stop updates when page is not visible
         document.addEventListener('visibilitychange', function() {
             if (document.hidden) {
-                clearInterval(autoRefreshInterval);
+                stopLiveUpdates();
             } else {
-                startAutoRefresh();
+                startLiveUpdates();
             }
         });
 
-        // Start auto-refresh when page loads
-        window.addEventListener('load', startAutoRefresh);
+        // Start live updates when page loads
+        window.addEventListener('load', startLiveUpdates);
     </script>
 </body>
 </html>
@@ -1,7 +1,7 @@
 #ifndef DEVICEINFO_HTML_H
 #define DEVICEINFO_HTML_H
 
-// HTML for the device information page
+// HTML for the device information page, served gzipped from web_assets.h (tools/build_web_assets.py)
 const char deviceinfo_html[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
@@ -0,0 +1,129 @@
+#include "filter.h"
+#include <math.h>
+
+ChannelFilter::ChannelFilter() {
+    FilterConfig passThrough = {0.0f, 0, 1.0f, 0.0f, 0.0f};
+    configure(passThrough);
+}
+
+void ChannelFilter::configure(const FilterConfig& config) {
+    this->config = config;
+    if (this->config.median > FILTER_MEDIAN_MAX) {
+        this->config.median = FILTER_MEDIAN_MAX;
+    }
+
+    windowCount = 0;
+    windowHead = 0;
+    rejectRun = 0;
+    started = false;
+    lastRaw = 0;
+    lastTime = 0;
+    ewma = 0;
+    kalmanX = 0;
+    kalmanP = 0;
+    output = 0;
+    outputValid = false;
+    rejected = 0;
+}
+
+float ChannelFilter::median(uint8_t size) const {
+    uint8_t n = windowCount < size ? windowCount : size;
+    float sorted[FILTER_MEDIAN_MAX];
+
+    // Most recent n samples, insertion sorted
+    for (uint8_t i = 0; i < n; i++) {
+        float value = window[(windowHead + FILTER_MEDIAN_MAX - 1 - i) % FILTER_MEDIAN_MAX];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > value) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+
+    if (n % 2) {
+        return sorted[n / 2];
+    }
+    return (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+bool ChannelFilter::apply(SensorReading& reading) {
+    // Invalid readings pass through, the filter keeps its state across short dropouts
+    if (!reading.valid) {
+        outputValid = false;
+        return true;
+    }
+
+#if FILTER_ENABLED
+    float value = reading.value;
+
+    if (started && reading.timestamp - lastTime > FILTER_RESET_GAP) {
+        started = false;
+    }
+
+    // Rate-of-change limit against the last accepted raw sample
+    if (started && config.maxRate > 0) {
+        float seconds = (reading.timestamp - lastTime) / 1000.0f;
+        if (seconds < 0.001f) {
+            seconds = 0.001f;
+        }
+        if (fabsf(value - lastRaw) > config.maxRate * seconds) {
+            rejected++;
+            if (++rejectRun < FILTER_REJECT_LIMIT) {
+                return false;
+            }
+            // Still there after several samples, it's a real step: restart from it
+            started = false;
+        }
+    }
+    rejectRun = 0;
+
+    if (!started) {
+        started = true;
+        windowCount = 0;
+        windowHead = 0;
+        ewma = value;
+        kalmanX = value;
+        kalmanP = config.kalmanR;
+    }
+    lastRaw = value;
+    lastTime = reading.timestamp;
+
+    window[windowHead] = value;
+    windowHead = (windowHead + 1) % FILTER_MEDIAN_MAX;
+    if (windowCount < FILTER_MEDIAN_MAX) {
+        windowCount++;
+    }
+
+    if (config.median > 1) {
+        value = median(config.median);
+    }
+
+    if (config.ewmaAlpha < 1.0f) {
+        ewma += config.ewmaAlpha * (value - ewma);
+        value = ewma;
+    }
+
+    if (config.kalmanR > 0) {
+        kalmanP += config.kalmanQ;
+        float gain = kalmanP / (kalmanP + config.kalmanR);
+        kalmanX += gain * (value - kalmanX);
+        kalmanP *= 1.0f - gain;
+        value = kalmanX;
+    }
+
+    reading.value = value;
+#endif
+
+    output = reading.value;
+    outputValid = true;
+    return true;
+}
+
+bool ChannelFilter::getValue(float& value) const {
+    if (!outputValid) {
+        return false;
+    }
+    value = output;
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <stdint.h>
+#include "config.h"
+#include "sensor.h"
+
+// Outlier rejection and smoothing of one channel between acquisition and
+// consumers: rate-of-change limit, median-of-N, EWMA, then optional 1-D
+// Kalman. Fixed size, nothing is allocated, and it only needs the channel's
+// FilterConfig, so it runs on canned traces without any sensor code.
+class ChannelFilter {
+private:
+    FilterConfig config;
+    float window[FILTER_MEDIAN_MAX]; // last accepted raw samples, ring
+    uint8_t windowCount;
+    uint8_t windowHead;
+    uint8_t rejectRun;      // consecutive rate-limit rejections
+    bool started;
+    float lastRaw;          // last accepted raw sample, rate limit reference
+    uint32_t lastTime;      // millis() of lastRaw
+    float ewma;
+    float kalmanX;
+    float kalmanP;
+    float output;
+    bool outputValid;
+    uint32_t rejected;      // rate-limit rejections since boot
+
+    float median(uint8_t size) const;
+
+public:
+    ChannelFilter();
+
+    // Reset the filter and replace its settings
+    void configure(const FilterConfig& config);
+
+    // Filters reading.value in place. Returns false if the reading was
+    // rejected as an outlier and should be dropped.
+    bool apply(SensorReading& reading);
+
+    // Latest filtered value, false if there is no valid output
+    bool getValue(float& value) const;
+    uint32_t getRejectedCount() const { return rejected; }
+};
+
+#endif // FILTER_H
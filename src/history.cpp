@@ -0,0 +1,171 @@
+#include "history.h"
+#include <Arduino.h>
+
+SensorHistory::SensorHistory() {
+    for (uint8_t i = 0; i < CHANNEL_COUNT; i++) {
+        Channel& c = channels[i];
+        c.head = 0;
+        c.count = 0;
+        c.lastTime = 0;
+        c.windowStart = 0;
+        c.windowLast = 0;
+        c.windowSum = 0;
+        c.windowValid = 0;
+        c.windowReadings = 0;
+        c.openSeq = 0;
+        c.openTime = 0;
+        c.openValue = HISTORY_INVALID;
+    }
+}
+
+void SensorHistory::append(const SensorReading& reading) {
+    if (reading.channel >= CHANNEL_COUNT) {
+        return;
+    }
+
+    Channel& c = channels[reading.channel];
+    if (c.windowReadings > 0 && reading.timestamp - c.windowStart >= HISTORY_STEP_MS) {
+        int16_t value = c.windowValid > 0 ? scale(c.windowSum / c.windowValid) : HISTORY_INVALID;
+        store(c, c.windowLast, value);
+        c.windowReadings = 0;
+    }
+
+    if (c.windowReadings == 0) {
+        c.windowStart = reading.timestamp;
+        c.windowSum = 0;
+        c.windowValid = 0;
+    }
+    c.windowLast = reading.timestamp;
+    c.windowReadings++;
+    if (reading.valid) {
+        c.windowSum += reading.value;
+        c.windowValid++;
+    }
+
+    c.openSeq++; // odd, being written
+    c.openTime = c.windowLast;
+    c.openValue = c.windowValid > 0 ? scale(c.windowSum / c.windowValid) : HISTORY_INVALID;
+    c.openSeq++;
+}
+
+int16_t SensorHistory::scale(float average) {
+    float scaled = roundf(average * HISTORY_VALUE_SCALE);
+    if (scaled > INT16_MAX) scaled = INT16_MAX;
+    if (scaled < INT16_MIN + 1) scaled = INT16_MIN + 1;
+    return (int16_t)scaled;
+}
+
+void SensorHistory::copyOpen(const Channel& c, uint32_t& time, int16_t& value) {
+    for (;;) {
+        uint32_t seq = c.openSeq;
+        if (seq & 1) {
+            continue;
+        }
+        time = c.openTime;
+        value = c.openValue;
+        if (c.openSeq == seq) {
+            return;
+        }
+    }
+}
+
+void SensorHistory::store(Channel& c, uint32_t timestamp, int16_t value) {
+    if (c.count == 0) {
+        c.lastTime = timestamp - timestamp % HISTORY_TICK_MS;
+        push(c, value, 0);
+        return;
+    }
+
+    // Modulo 2^32, so correct across the millis() wrap
+    uint32_t ticks = (timestamp - c.lastTime) / HISTORY_TICK_MS;
+    while (ticks > UINT16_MAX) {
+        push(c, HISTORY_INVALID, UINT16_MAX);
+        c.lastTime += UINT16_MAX * HISTORY_TICK_MS;
+        ticks -= UINT16_MAX;
+    }
+    c.lastTime += ticks * HISTORY_TICK_MS;
+    push(c, value, (uint16_t)ticks);
+}
+
+void SensorHistory::push(Channel& c, int16_t value, uint16_t delta) {
+    HistorySample& sample = c.samples[c.head];
+    sample.value = value;
+    sample.delta = delta;
+
+    if (++c.head == HISTORY_CAPACITY) {
+        c.head = 0;
+    }
+    if (c.count < HISTORY_CAPACITY) {
+        c.count++;
+    }
+}
+
+bool SensorHistory::beginQuery(uint8_t channel, uint32_t since, HistoryCursor& cursor) const {
+    if (channel >= CHANNEL_COUNT) {
+        return false;
+    }
+
+    const Channel& c = channels[channel];
+    uint16_t count = c.count;
+    uint16_t head = c.head;
+    uint32_t time = c.lastTime;
+
+    // Walk back from the newest sample until we pass 'since'
+    uint16_t index = (head + HISTORY_CAPACITY - 1) % HISTORY_CAPACITY;
+    uint16_t found = 0;
+    uint32_t startTime = time;
+    while (found < count && (int32_t)(time - since) > 0) {
+        startTime = time;
+        found++;
+        time -= c.samples[index].delta * HISTORY_TICK_MS;
+        index = (index + HISTORY_CAPACITY - 1) % HISTORY_CAPACITY;
+    }
+
+    cursor.channel = channel;
+    cursor.index = (head + HISTORY_CAPACITY - found) % HISTORY_CAPACITY;
+    cursor.remaining = found;
+    cursor.time = startTime;
+
+    uint32_t openTime;
+    int16_t openValue;
+    copyOpen(c, openTime, openValue);
+    cursor.open = openValue != HISTORY_INVALID && (int32_t)(openTime - since) > 0;
+    return found > 0 || cursor.open;
+}
+
+bool SensorHistory::next(HistoryCursor& cursor, uint32_t& timestamp, float& value) const {
+    const Channel& c = channels[cursor.channel];
+
+    while (cursor.remaining > 0) {
+        const HistorySample& sample = c.samples[cursor.index];
+        uint32_t time = cursor.time;
+
+        cursor.remaining--;
+        if (++cursor.index == HISTORY_CAPACITY) {
+            cursor.index = 0;
+        }
+        if (cursor.remaining > 0) {
+            cursor.time += c.samples[cursor.index].delta * HISTORY_TICK_MS;
+        }
+
+        if (sample.value == HISTORY_INVALID) {
+            continue;
+        }
+        timestamp = time;
+        value = sample.value / HISTORY_VALUE_SCALE;
+        return true;
+    }
+
+    if (cursor.open) {
+        cursor.open = false;
+        uint32_t openTime;
+        int16_t openValue;
+        copyOpen(c, openTime, openValue);
+        if (openValue != HISTORY_INVALID) {
+            timestamp = openTime;
+            value = openValue / HISTORY_VALUE_SCALE;
+            return true;
+        }
+    }
+    return false;
+}
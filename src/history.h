@@ -0,0 +1,99 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+#include <atomic>
+#include "config.h"
+#include "sensor_reading.h"
+
+// Compact history sample, 4 bytes
+struct HistorySample {
+    int16_t value;  // value * HISTORY_VALUE_SCALE, HISTORY_INVALID if the read failed
+    uint16_t delta; // ticks (HISTORY_TICK_MS) since the previous sample of the channel
+};
+
+constexpr int16_t HISTORY_INVALID = INT16_MIN;
+constexpr float HISTORY_VALUE_SCALE = 100.0f; // 0.01 resolution, range +/-327.67
+constexpr uint32_t HISTORY_TICK_MS = 100;
+
+// Samples per channel, sized so all channels fit in HISTORY_RAM_BUDGET
+constexpr uint16_t HISTORY_CAPACITY = HISTORY_RAM_BUDGET / (CHANNEL_COUNT * sizeof(HistorySample));
+static_assert(HISTORY_CAPACITY > 0, "HISTORY_RAM_BUDGET too small for CHANNEL_COUNT");
+
+// Readings are averaged over windows of this length so HISTORY_SPAN fits the
+// ring. A day of 2 s readings on 7 channels would take 1.2 MB at full rate;
+// with the defaults one stored sample covers about 50 s.
+constexpr uint32_t HISTORY_STEP_MS = ((HISTORY_SPAN + HISTORY_CAPACITY - 1) / HISTORY_CAPACITY + HISTORY_TICK_MS - 1)
+                                     / HISTORY_TICK_MS * HISTORY_TICK_MS;
+
+// Read position for streaming a query result
+struct HistoryCursor {
+    uint8_t channel;
+    uint16_t index;     // ring slot of the next sample
+    uint16_t remaining; // samples left to visit
+    uint32_t time;      // millis() of the next sample
+    bool open;          // the open window is still to visit
+};
+
+// Fixed-capacity ring buffer per channel. Appends are O(1) and never allocate.
+// Readers may run on another task than the writer; a sample at the old end
+// can be overwritten mid-query, which only affects that one sample.
+//
+// Times are millis() and compared modulo 2^32, so the history survives the
+// 49.7 day wrap. A gap longer than a 16 bit delta (109 min) is bridged with
+// invalid samples rather than shifting every older timestamp.
+//
+// A query ends with the running average of the window still being filled,
+// so the newest readings are not hidden for up to a step. Once that window
+// closes it is stored with the time of its last reading, which is never
+// earlier, so a client polling with 'since' replaces its provisional last
+// sample with the final one.
+class SensorHistory {
+private:
+    struct Channel {
+        HistorySample samples[HISTORY_CAPACITY];
+        uint16_t head;     // next slot to write
+        uint16_t count;
+        uint32_t lastTime; // of the newest sample, on the tick grid
+
+        // Readings of the window being averaged
+        uint32_t windowStart;
+        uint32_t windowLast;
+        float windowSum;
+        uint16_t windowValid;
+        uint16_t windowReadings;
+
+        // Running average of the open window for readers. openSeq is odd
+        // while append() updates it, readers retry a copy that overlapped.
+        std::atomic<uint32_t> openSeq;
+        uint32_t openTime;
+        int16_t openValue;
+    };
+
+    Channel channels[CHANNEL_COUNT];
+
+    void store(Channel& c, uint32_t timestamp, int16_t value);
+    void push(Channel& c, int16_t value, uint16_t delta);
+    static int16_t scale(float average);
+    static void copyOpen(const Channel& c, uint32_t& time, int16_t& value);
+
+public:
+    SensorHistory();
+
+    // Readings are stored once their HISTORY_STEP_MS window is complete,
+    // until then queries see the window's running average
+    void append(const SensorReading& reading);
+
+    // Position cursor at the first sample newer than 'since' (millis, within
+    // 2^31 ms of the stored times), returns false if none. The open window
+    // counts as a sample when its last reading is newer than 'since'.
+    bool beginQuery(uint8_t channel, uint32_t since, HistoryCursor& cursor) const;
+    // Next valid sample in time order, the open window's average last;
+    // returns false when the query is exhausted
+    bool next(HistoryCursor& cursor, uint32_t& timestamp, float& value) const;
+
+    uint16_t getCount(uint8_t channel) const { return channels[channel].count; }
+    static constexpr uint16_t capacity() { return HISTORY_CAPACITY; }
+};
+
+#endif // HISTORY_H
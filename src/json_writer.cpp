@@ -0,0 +1,211 @@
+#include "json_writer.h"
+#include <math.h>
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity, uint32_t skip)
+    : out(buffer, capacity) {
+    this->capacity = capacity;
+    nesting.depth = 0;
+    nesting.hasItems = 0;
+    nesting.afterKey = false;
+    this->skip = skip;
+    tokens = 0;
+    mark = 0;
+    full = false;
+}
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity, const Nesting& nesting)
+    : out(buffer, capacity) {
+    this->capacity = capacity;
+    this->nesting = nesting;
+    skip = 0;
+    tokens = 0;
+    mark = 0;
+    full = false;
+}
+
+size_t JsonWriter::getRemaining() const {
+    // TextBuffer keeps one byte for the terminator
+    return capacity - 1 - out.getLength();
+}
+
+bool JsonWriter::startToken(bool separator) {
+    if (full) {
+        return false;
+    }
+    mark = out.getLength();
+    if (tokens < skip) {
+        return false;
+    }
+    if (separator && !nesting.afterKey && (nesting.hasItems & (1u << nesting.depth))) {
+        out.append(',');
+    }
+    return true;
+}
+
+bool JsonWriter::finishToken() {
+    if (full) {
+        return false;
+    }
+    if (out.hasOverflowed()) {
+        out.truncate(mark);
+        full = true;
+        return false;
+    }
+    tokens++;
+    return true;
+}
+
+void JsonWriter::addItem() {
+    nesting.afterKey = false;
+    nesting.hasItems |= 1u << nesting.depth;
+}
+
+void JsonWriter::beginObject() {
+    if (startToken(true)) {
+        out.append('{');
+    }
+    if (finishToken()) {
+        addItem();
+        if (nesting.depth < MAX_DEPTH) {
+            nesting.depth++;
+        }
+        nesting.hasItems &= ~(1u << nesting.depth);
+    }
+}
+
+void JsonWriter::endObject() {
+    if (startToken(false)) {
+        out.append('}');
+    }
+    if (finishToken() && nesting.depth > 0) {
+        nesting.depth--;
+    }
+}
+
+void JsonWriter::beginArray() {
+    if (startToken(true)) {
+        out.append('[');
+    }
+    if (finishToken()) {
+        addItem();
+        if (nesting.depth < MAX_DEPTH) {
+            nesting.depth++;
+        }
+        nesting.hasItems &= ~(1u << nesting.depth);
+    }
+}
+
+void JsonWriter::endArray() {
+    if (startToken(false)) {
+        out.append(']');
+    }
+    if (finishToken() && nesting.depth > 0) {
+        nesting.depth--;
+    }
+}
+
+void JsonWriter::key(const char* name) {
+    if (startToken(true)) {
+        appendEscaped(name);
+        out.append(':');
+    }
+    if (finishToken()) {
+        nesting.afterKey = true;
+    }
+}
+
+void JsonWriter::appendEscaped(const char* text) {
+    out.append('"');
+    for (const char* p = text; *p && !out.hasOverflowed(); p++) {
+        unsigned char c = *p;
+        switch (c) {
+        case '"':  out.append("\\\""); break;
+        case '\\': out.append("\\\\"); break;
+        case '\n': out.append("\\n"); break;
+        case '\r': out.append("\\r"); break;
+        case '\t': out.append("\\t"); break;
+        default:
+            if (c < 0x20) {
+                out.appendf("\\u%04x", c);
+            } else {
+                out.append((char)c);
+            }
+            break;
+        }
+    }
+    out.append('"');
+}
+
+void JsonWriter::value(const char* text) {
+    if (startToken(true)) {
+        appendEscaped(text);
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
+
+void JsonWriter::value(bool value) {
+    if (startToken(true)) {
+        out.append(value ? "true" : "false");
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
+
+void JsonWriter::value(int value) {
+    this->value((long long)value);
+}
+
+void JsonWriter::value(unsigned int value) {
+    this->value((unsigned long long)value);
+}
+
+void JsonWriter::value(long value) {
+    this->value((long long)value);
+}
+
+void JsonWriter::value(unsigned long value) {
+    this->value((unsigned long long)value);
+}
+
+void JsonWriter::value(long long value) {
+    if (startToken(true)) {
+        out.appendf("%lld", value);
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
+
+void JsonWriter::value(unsigned long long value) {
+    if (startToken(true)) {
+        out.appendf("%llu", value);
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
+
+void JsonWriter::value(double value) {
+    if (startToken(true)) {
+        if (isfinite(value)) {
+            out.appendFloat((float)value);
+        } else {
+            out.append("null");
+        }
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
+
+void JsonWriter::valueNull() {
+    if (startToken(true)) {
+        out.append("null");
+    }
+    if (finishToken()) {
+        addItem();
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "text_buffer.h"
+
+// Streaming JSON writer for HTTP responses, no allocation. Writes tokens
+// (keys, values, brackets) into a caller-owned buffer, such as the one an
+// AsyncWebServer fill callback hands out, and adds commas and string escapes.
+// A token that does not fit is dropped whole and the writer turns full. The
+// response then continues in the next buffer, either by
+// - replay: running the same code again with skip = getTokens(), tokens that
+//   were already sent are counted but not written (see sendJson() in
+//   webserver.cpp), or by
+// - resume: keeping getNesting() and the data cursor between buffers and
+//   checking getRemaining() before each record.
+class JsonWriter {
+public:
+    static constexpr uint8_t MAX_DEPTH = 31;
+
+    // Comma state, carried between buffers when resuming
+    struct Nesting {
+        uint8_t depth;
+        uint32_t hasItems;  // bit per level: the next item needs a comma
+        bool afterKey;
+    };
+
+private:
+    TextBuffer out;
+    size_t capacity;
+    Nesting nesting;
+    uint32_t skip;
+    uint32_t tokens;        // written or skipped
+    size_t mark;            // length before the current token
+    bool full;
+
+    // Every token is written between these two. start returns false if the
+    // token is skipped or the writer is full, finish rolls back a token that
+    // did not fit and returns true if it counts.
+    bool startToken(bool separator);
+    bool finishToken();
+    void addItem();
+    void appendEscaped(const char* text);
+
+public:
+    JsonWriter(char* buffer, size_t capacity, uint32_t skip = 0);
+    JsonWriter(char* buffer, size_t capacity, const Nesting& nesting);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    void key(const char* name);
+    void value(const char* text);
+    void value(bool value);
+    void value(int value);
+    void value(unsigned int value);
+    void value(long value);
+    void value(unsigned long value);
+    void value(long long value);
+    void value(unsigned long long value);
+    // Two decimals, null for nan and inf
+    void value(double value);
+    void valueNull();
+
+    template <typename T>
+    void field(const char* name, T v) {
+        key(name);
+        value(v);
+    }
+
+    size_t getLength() const { return out.getLength(); }
+    size_t getRemaining() const;
+    uint32_t getTokens() const { return tokens; }
+    bool isFull() const { return full; }
+    const Nesting& getNesting() const { return nesting; }
+};
+
+#endif // JSON_WRITER_H
@@ -0,0 +1,246 @@
+#include "low_power.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <esp_sleep.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <time.h>
+#include "wifi_manager.h"
+#include "mqtt.h"
+#include "sample_clock.h"
+
+constexpr uint32_t SLEEP_BATCH_MAGIC = 0x53424154; // "SBAT"
+constexpr uint32_t LOW_POWER_MIN_SLEEP_MS = 1000;
+
+// Survives deep sleep, initialised again on power-on
+RTC_DATA_ATTR static SleepBatch rtcBatch;
+
+bool SleepBatch::isValid() const {
+    return magic == SLEEP_BATCH_MAGIC && count <= LOW_POWER_BATCH_MAX;
+}
+
+void SleepBatch::reset() {
+    magic = SLEEP_BATCH_MAGIC;
+    powerOn = esp_random();
+    wakeCount = 0;
+    appended = 0;
+    timeSet = false;
+    wakesSincePublish = 0;
+    count = 0;
+    dropped = 0;
+    publishFailures = 0;
+    lastAwakeMs = 0;
+    maxAwakeMs = 0;
+    totalAwakeMs = 0;
+}
+
+void SleepBatch::append(const LogRecord& record) {
+    if (count == LOW_POWER_BATCH_MAX) {
+        memmove(&records[0], &records[1], (LOW_POWER_BATCH_MAX - 1) * sizeof(LogRecord));
+        count--;
+        dropped++;
+    }
+    records[count++] = record;
+    appended++;
+}
+
+bool SleepBatch::isPublishDue() const {
+    return wakesSincePublish >= LOW_POWER_PUBLISH_EVERY || count == LOW_POWER_BATCH_MAX;
+}
+
+void SleepBatch::published(bool success) {
+    // A failed attempt also waits N wakes, so a missing AP doesn't cost a connect every wake
+    wakesSincePublish = 0;
+    if (success) {
+        count = 0;
+    } else {
+        publishFailures++;
+    }
+}
+
+void SleepBatch::timeSynced(int64_t step) {
+    if (timeSet) {
+        return; // stamped with the RTC's epoch time, a later step only corrects its drift
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        records[i].timestamp = (uint32_t)(records[i].timestamp + step);
+    }
+    timeSet = true;
+}
+
+void SleepBatch::recordAwake(uint32_t awakeMs) {
+    lastAwakeMs = awakeMs;
+    totalAwakeMs += awakeMs;
+    if (awakeMs > maxAwakeMs) {
+        maxAwakeMs = awakeMs;
+    }
+}
+
+uint64_t SleepBatch::sleepTimeUs(uint32_t awakeMs) {
+    uint32_t sleepMs = LOW_POWER_MIN_SLEEP_MS;
+    if (awakeMs + LOW_POWER_MIN_SLEEP_MS < LOW_POWER_WAKE_INTERVAL) {
+        sleepMs = LOW_POWER_WAKE_INTERVAL - awakeMs;
+    }
+    return (uint64_t)sleepMs * 1000;
+}
+
+// Starts a sample on every sensor
+struct LowPowerMode::StartVisitor {
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        sensor.startSample();
+    }
+};
+
+// Polls pending sensors, 'pending' stays true while any is converting
+struct LowPowerMode::PollVisitor {
+    bool pending;
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        if (sensor.isSamplePending() && !sensor.pollSample()) {
+            pending = true;
+        }
+    }
+};
+
+// Copies every valid channel into a record, values in hundredths like the log
+struct LowPowerMode::RecordVisitor {
+    LogRecord* record;
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+            if (!sensor.isValid(i)) {
+                continue;
+            }
+            for (uint8_t f = 0; f < S::FIELDS; f++) {
+                uint8_t channel = firstChannel + i * S::FIELDS + f;
+                float scaled = roundf(sensor.getValue(i, f) * 100.0f);
+                if (scaled > INT16_MAX) scaled = INT16_MAX;
+                if (scaled < INT16_MIN) scaled = INT16_MIN;
+                record->values[channel] = (int16_t)scaled;
+                record->validMask |= (uint16_t)(1u << channel);
+            }
+        }
+    }
+};
+
+LowPowerMode::LowPowerMode(SensorSet* sensors) {
+    this->sensors = sensors;
+    batch = &rtcBatch;
+}
+
+void LowPowerMode::sample(LogRecord& record) {
+    memset(&record, 0, sizeof(record));
+    // The RTC keeps system time running through deep sleep: wall time once
+    // SNTP set it, otherwise seconds since power-on until syncTime() rebases them
+    record.timestamp = (uint32_t)time(nullptr);
+
+    StartVisitor start;
+    sensors->forEach(start);
+
+    unsigned long started = millis();
+    PollVisitor poll;
+    do {
+        poll.pending = false;
+        sensors->forEach(poll);
+        if (poll.pending) {
+            delay(SENSOR_POLL_INTERVAL);
+        }
+    } while (poll.pending && millis() - started < SENSOR_SAMPLE_TIMEOUT);
+
+    RecordVisitor collect;
+    collect.record = &record;
+    sensors->forEach(collect);
+}
+
+void LowPowerMode::syncTime() {
+    // Every publish wake syncs, the RTC slow clock drifts between them
+    time_t before = time(nullptr);
+    int64_t startMs = SampleClock::monotonicMs();
+    SampleClock clock;
+    clock.begin();
+    while (clock.getSyncCount() == 0 && SampleClock::monotonicMs() - startMs < (int64_t)LOW_POWER_SNTP_TIMEOUT) {
+        delay(SENSOR_POLL_INTERVAL);
+        clock.update();
+    }
+    if (clock.getSyncCount() == 0) {
+        Serial.println("[LOWPOWER] No SNTP answer, batch sent with the RTC's time");
+        return;
+    }
+
+    // How far the sync moved the system time, to the second like the records
+    int64_t elapsed = (SampleClock::monotonicMs() - startMs) / 1000;
+    batch->timeSynced((int64_t)time(nullptr) - before - elapsed);
+}
+
+bool LowPowerMode::publish() {
+    WiFiManager wifi;
+    wifi.begin();
+    if (!wifi.hasCredentials()) {
+        Serial.println("[LOWPOWER] No WiFi credentials, keeping batch");
+        return false;
+    }
+
+    WiFi.mode(WIFI_STA);
+    bool sent = false;
+    if (wifi.connectToWiFi()) {
+        syncTime();
+
+        // On the heap: with its outbound ring and payload buffer it is larger
+        // than the loop task stack
+        MQTTManager* mqtt = new MQTTManager(MQTT_SERVER, MQTT_PORT, MQTT_USER, MQTT_PASSWORD);
+        mqtt->begin(sensors, nullptr, nullptr, nullptr, nullptr);
+        if (mqtt->connect()) {
+            sent = mqtt->publishBatch(*batch);
+            // Without the PUBACK the batch stays in RTC memory and goes out again
+            if (!mqtt->disconnect()) {
+                sent = false;
+            }
+        }
+        delete mqtt;
+    }
+
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    return sent;
+}
+
+void LowPowerMode::run() {
+    if (!batch->isValid()) {
+        batch->reset();
+    }
+    batch->wakeCount++;
+    batch->wakesSincePublish++;
+
+    LogRecord record;
+    sample(record);
+    batch->append(record);
+
+    Serial.print("[LOWPOWER] Wake ");
+    Serial.print(batch->wakeCount);
+    Serial.print(", ");
+    Serial.print(batch->count);
+    Serial.print(" records batched, last cycle awake ");
+    Serial.print(batch->lastAwakeMs);
+    Serial.println(" ms");
+
+    if (batch->isPublishDue()) {
+        bool success = publish();
+        batch->published(success);
+        Serial.println(success ? "[LOWPOWER] Batch published" : "[LOWPOWER] Publish failed, batch kept");
+    }
+
+    // millis() counts from this boot, so this is the whole awake time of the cycle
+    uint32_t awakeMs = millis();
+    batch->recordAwake(awakeMs);
+
+    Serial.print("[LOWPOWER] Awake ");
+    Serial.print(awakeMs);
+    Serial.println(" ms, entering deep sleep");
+    Serial.flush();
+
+    esp_sleep_enable_timer_wakeup(SleepBatch::sleepTimeUs(awakeMs));
+    esp_deep_sleep_start();
+}
@@ -0,0 +1,70 @@
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#include <stdint.h>
+#include "config.h"
+#include "sensors.h"
+#include "sample_log.h"
+
+// Samples collected across deep sleep cycles. Lives in RTC slow memory and
+// only does bookkeeping, no hardware access.
+struct SleepBatch {
+    uint32_t magic;
+    uint32_t powerOn;           // random per power-on, "boot" of the batch message
+    uint32_t wakeCount;         // wakes since power-on
+    uint32_t appended;          // records since power-on, numbers them for dedup
+    bool timeSet;               // SNTP set the system time, records are epoch seconds
+    uint16_t wakesSincePublish;
+    uint16_t count;
+    uint32_t dropped;           // records lost to a full batch
+    uint32_t publishFailures;
+    uint32_t lastAwakeMs;       // awake time of the previous cycle
+    uint32_t maxAwakeMs;
+    uint32_t totalAwakeMs;
+    LogRecord records[LOW_POWER_BATCH_MAX]; // oldest first
+
+    bool isValid() const;
+    void reset();
+
+    // Adds a record, dropping the oldest if the batch is full
+    void append(const LogRecord& record);
+    // Number of records[0] since power-on. A batch sent again after a lost
+    // PUBACK starts at the same number, subscribers skip records they have.
+    uint32_t firstSeq() const { return appended - count; }
+    // True every LOW_POWER_PUBLISH_EVERY wakes, or earlier once the batch is full
+    bool isPublishDue() const;
+    // After a publish attempt, the batch is only emptied on success
+    void published(bool success);
+    void recordAwake(uint32_t awakeMs);
+    // After an SNTP sync that moved the system time by step seconds. The
+    // first one moves the records stamped since power-on to epoch time.
+    void timeSynced(int64_t step);
+
+    // Sleep so that wakes stay LOW_POWER_WAKE_INTERVAL apart
+    static uint64_t sleepTimeUs(uint32_t awakeMs);
+};
+
+// One wake cycle of battery mode (LOW_POWER_ENABLED). Called from setup()
+// instead of the normal startup, ends in deep sleep.
+class LowPowerMode {
+private:
+    struct StartVisitor;
+    struct PollVisitor;
+    struct RecordVisitor;
+
+    SensorSet* sensors;
+    SleepBatch* batch;
+
+    void sample(LogRecord& record);
+    // Waits up to LOW_POWER_SNTP_TIMEOUT for SNTP, WiFi must be up
+    void syncTime();
+    bool publish();
+
+public:
+    LowPowerMode(SensorSet* sensors);
+
+    // Samples, publishes when due and enters deep sleep, does not return
+    void run();
+};
+
+#endif // LOW_POWER_H
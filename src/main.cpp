@@ -1,17 +1,31 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include "config.h"
-#include "temperature.h"
+#include "sensors.h"
 #include "wifi_manager.h"
 #include "webserver.h"
 #include "mqtt.h"
+#include "sensor_task.h"
+#include "sensor_filters.h"
+#include "history.h"
+#include "sample_clock.h"
+#include "sample_log.h"
+#include "rollup.h"
+#include "low_power.h"
+#include "metrics.h"
 
 // Global objects
-TemperatureSensor* tempSensor = nullptr;
-DS18B20Sensor* ds18b20Sensor = nullptr;
+SensorSet sensors; // Compile-time sensor registry, statically allocated
 WiFiManager* wifiManager = nullptr;
 WebServer* webServer = nullptr;
 MQTTManager* mqttManager = nullptr;
+SensorTask* sensorTask = nullptr;
+SensorFilters* sensorFilters = nullptr;
+SensorHistory* sensorHistory = nullptr;
+SampleClock* sampleClock = nullptr;
+SampleLog* sampleLog = nullptr;
+RollupStore* rollupStore = nullptr;
+LowPowerMode* lowPowerMode = nullptr;
 
 // State variables
 bool isAPMode = false;
@@ -22,9 +36,6 @@ bool buttonPressed = false;
 unsigned long lastLEDToggle = 0;
 bool ledState = false;
 
-// Temperature reading variables
-unsigned long lastTempRead = 0;
-
 // MQTT publish variables
 unsigned long lastMQTTPublish = 0;
 
@@ -98,26 +109,51 @@ void setup() {
     pinMode(LED_PIN, OUTPUT);
     pinMode(RESET_BUTTON_PIN, INPUT_PULLUP); // Use internal pullup resistor
 
+#if LOW_POWER_ENABLED
+    // Battery mode: sample, batch in RTC memory and go back to deep sleep (does not return)
+    sensors.begin();
+    lowPowerMode = new LowPowerMode(&sensors);
+    lowPowerMode->run();
+#endif
+
     delay(1000);
     Serial.println("\n\n=== PPIOT Device Starting ===");
 
-    // Initialize temperature sensors
-    tempSensor = new TemperatureSensor(TEMP_SENSOR_PIN);
-    tempSensor->begin();
+    // Initialize all registered sensors
+    sensors.begin();
+
+    // Start sensor acquisition (own task, see SENSOR_TASK_ENABLED)
+    sensorTask = new SensorTask(&sensors);
+    sensorTask->begin();
+
+    // Initialize per-channel outlier rejection and smoothing
+    sensorFilters = new SensorFilters();
 
-    ds18b20Sensor = new DS18B20Sensor(DS18B20_PIN);
-    ds18b20Sensor->begin();
+    // Initialize sample history (fixed size, allocated once)
+    sensorHistory = new SensorHistory();
+
+    // Initialize sample timestamps (SNTP, runs once WiFi is up)
+    sampleClock = new SampleClock();
+    sampleClock->begin();
+
+    // Initialize flash sample log (persists across reboots)
+    sampleLog = new SampleLog();
+    sampleLog->begin(sampleClock);
+
+    // Initialize minute/hour/day rollups (day restored from NVS)
+    rollupStore = new RollupStore();
+    rollupStore->begin();
 
     // Initialize WiFi manager
     wifiManager = new WiFiManager();
     wifiManager->begin();
 
-    // Initialize web server (pass wifiManager, tempSensor, ds18b20Sensor, and isAPMode flag)
-    webServer = new WebServer(wifiManager, tempSensor, ds18b20Sensor, &isAPMode);
-
     // Initialize MQTT manager
     mqttManager = new MQTTManager(MQTT_SERVER, MQTT_PORT, MQTT_USER, MQTT_PASSWORD);
-    mqttManager->begin(tempSensor, ds18b20Sensor);
+    mqttManager->begin(&sensors, sensorFilters, sampleClock, sampleLog, rollupStore);
+
+    // Initialize web server (pass wifiManager, sensors, sensorTask, mqttManager, history, log, rollups, and isAPMode flag)
+    webServer = new WebServer(wifiManager, &sensors, sensorTask, mqttManager, sensorHistory, sampleLog, rollupStore, &isAPMode);
 
     // Check for factory reset button press
     checkFactoryReset();
@@ -150,6 +186,9 @@ void setup() {
 }
 
 void loop() {
+    // Iteration time for /metrics, counts the early returns below too
+    Metrics::markLoop();
+
     // Handle async web server save request
     if (webServer->isSaveInProgress()) {
         webServer->handleSaveRequest();
@@ -192,13 +231,26 @@ void loop() {
         digitalWrite(LED_PIN, LOW);
     }
 
-    // Read temperature periodically
-    unsigned long currentMillis = millis();
-    if (currentMillis - lastTempRead >= TEMP_READ_INTERVAL) {
-        lastTempRead = currentMillis;
-        tempSensor->readTemperature();  // DHT22 sensor
-        ds18b20Sensor->readTemperature();  // DS18B20 sensor
+    // Apply SNTP syncs to the sample clock
+    sampleClock->update();
+
+    // Sensor sampling (inline mode) and drain readings from the acquisition task
+    sensorTask->loop();
+    SensorReading reading;
+    while (sensorTask->popReading(reading)) {
+        if (!sensorFilters->apply(reading)) {
+            continue; // outlier, rejected by the rate-of-change limit
+        }
+        sensorHistory->append(reading);
+        sampleLog->append(reading);
+        rollupStore->add(reading, sampleLog->now());
+        mqttManager->queueReading(reading);
+        webServer->queueReading(reading);
     }
+    webServer->updateSnapshot();
+    webServer->publishEvents();
+
+    unsigned long currentMillis = millis();
 
     // Handle MQTT connection and publishing
     mqttManager->loop();
@@ -0,0 +1,182 @@
+#include "metrics.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+static const struct {
+    const char* name;
+    const char* help;
+} counterInfo[METRIC_COUNTER_COUNT] = {
+    { "ppiot_wifi_disconnects_total", "WiFi link losses that started an auto-reconnect" },
+    { "ppiot_wifi_reconnects_total", "Successful WiFi auto-reconnects" },
+    { "ppiot_mqtt_publishes_total", "MQTT messages handed to the client" },
+    { "ppiot_mqtt_publish_failures_total", "MQTT messages the client could not take (offline, buffer or window full)" },
+    { "ppiot_mqtt_sent_bytes_total", "Bytes written to the MQTT connection, including retransmissions" },
+};
+
+std::atomic<uint32_t> Metrics::counters[METRIC_COUNTER_COUNT];
+Metrics::Route Metrics::routes[WEB_ROUTE_MAX];
+uint8_t Metrics::routeCount = 0;
+DurationHistogram Metrics::loopTime;
+uint32_t Metrics::lastLoopUs = 0;
+
+const char* Metrics::getName(MetricCounter counter) {
+    return counterInfo[counter].name;
+}
+
+const char* Metrics::getHelp(MetricCounter counter) {
+    return counterInfo[counter].help;
+}
+
+int8_t Metrics::addRoute(const char* path, const char* method) {
+    if (routeCount >= WEB_ROUTE_MAX) {
+        Serial.print("[METRICS] WEB_ROUTE_MAX reached, not counting ");
+        Serial.println(path);
+        return -1;
+    }
+    Route& route = routes[routeCount];
+    route.path = path;
+    route.method = method;
+    route.requests = 0;
+    return routeCount++;
+}
+
+void Metrics::markLoop() {
+    uint32_t now = micros();
+    if (lastLoopUs != 0) {
+        loopTime.record(now - lastLoopUs);
+    }
+    lastLoopUs = now;
+}
+
+PrometheusWriter::PrometheusWriter(char* buffer, size_t capacity, uint32_t skip)
+    : out(buffer, capacity) {
+    this->skip = skip;
+    lines = 0;
+    mark = 0;
+    full = false;
+}
+
+bool PrometheusWriter::startLine() {
+    if (full) {
+        return false;
+    }
+    mark = out.getLength();
+    return lines >= skip;
+}
+
+void PrometheusWriter::finishLine() {
+    if (full) {
+        return;
+    }
+    if (out.hasOverflowed()) {
+        out.truncate(mark);
+        full = true;
+        return;
+    }
+    lines++;
+}
+
+void PrometheusWriter::appendSeries(const char* name, const char* suffix, const char* labels, const char* le) {
+    out.append(name);
+    if (suffix) {
+        out.append(suffix);
+    }
+    bool hasLabels = labels && labels[0];
+    if (hasLabels || le) {
+        out.append('{');
+        if (hasLabels) {
+            out.append(labels);
+        }
+        if (le) {
+            out.appendf("%sle=\"%s\"", hasLabels ? "," : "", le);
+        }
+        out.append('}');
+    }
+    out.append(' ');
+}
+
+void PrometheusWriter::appendSeconds(uint64_t us) {
+    // Integer formatting only, like TextBuffer::appendFloat()
+    out.appendf("%lu.%06lu", (unsigned long)(us / 1000000), (unsigned long)(us % 1000000));
+}
+
+void PrometheusWriter::appendLabel(TextBuffer& labels, const char* name, const char* value) {
+    if (labels.getLength() > 0) {
+        labels.append(',');
+    }
+    labels.append(name);
+    labels.append("=\"");
+    for (const char* p = value; *p; p++) {
+        switch (*p) {
+        case '\\': labels.append("\\\\"); break;
+        case '"':  labels.append("\\\""); break;
+        case '\n': labels.append("\\n"); break;
+        default:   labels.append(*p); break;
+        }
+    }
+    labels.append('"');
+}
+
+void PrometheusWriter::family(const char* name, const char* type, const char* help) {
+    if (startLine()) {
+        out.appendf("# HELP %s %s\n", name, help);
+    }
+    finishLine();
+    if (startLine()) {
+        out.appendf("# TYPE %s %s\n", name, type);
+    }
+    finishLine();
+}
+
+void PrometheusWriter::sample(const char* name, const char* labels, int64_t value) {
+    if (startLine()) {
+        appendSeries(name, nullptr, labels, nullptr);
+        out.appendf("%lld\n", (long long)value);
+    }
+    finishLine();
+}
+
+void PrometheusWriter::sampleSeconds(const char* name, const char* labels, uint64_t us) {
+    if (startLine()) {
+        appendSeries(name, nullptr, labels, nullptr);
+        appendSeconds(us);
+        out.append('\n');
+    }
+    finishLine();
+}
+
+void PrometheusWriter::histogram(const char* name, const char* labels, const DurationHistogram& hist) {
+    // Buckets are read while another task may record, so the total is summed
+    // from them rather than taken from count, which keeps the series monotonic
+    uint32_t cumulative = 0;
+    char le[16];
+    for (uint8_t k = 0; k < SENSOR_STATS_BUCKETS; k++) {
+        cumulative += hist.buckets[k];
+        if (k == SENSOR_STATS_BUCKETS - 1) {
+            break; // the last bucket is open-ended, only +Inf covers it
+        }
+        uint32_t bound = DurationHistogram::bucketStart(k + 1);
+        snprintf(le, sizeof(le), "%lu.%06lu", (unsigned long)(bound / 1000000), (unsigned long)(bound % 1000000));
+        if (startLine()) {
+            appendSeries(name, "_bucket", labels, le);
+            out.appendf("%lu\n", (unsigned long)cumulative);
+        }
+        finishLine();
+    }
+    if (startLine()) {
+        appendSeries(name, "_bucket", labels, "+Inf");
+        out.appendf("%lu\n", (unsigned long)cumulative);
+    }
+    finishLine();
+    if (startLine()) {
+        appendSeries(name, "_sum", labels, nullptr);
+        appendSeconds(hist.totalUs);
+        out.append('\n');
+    }
+    finishLine();
+    if (startLine()) {
+        appendSeries(name, "_count", labels, nullptr);
+        out.appendf("%lu\n", (unsigned long)cumulative);
+    }
+    finishLine();
+}
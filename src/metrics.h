@@ -0,0 +1,105 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "config.h"
+#include "sensor_stats.h"
+#include "text_buffer.h"
+
+// Counters that exist only for /metrics. Everything a subsystem already
+// counts itself is read from its getters when the page is rendered.
+enum MetricCounter : uint8_t {
+    METRIC_WIFI_DISCONNECTS = 0,
+    METRIC_WIFI_RECONNECTS,
+    METRIC_MQTT_PUBLISHES,
+    METRIC_MQTT_PUBLISH_FAILURES,
+    METRIC_MQTT_BYTES_SENT,
+    METRIC_COUNTER_COUNT
+};
+
+// Static metric registry. Counters are relaxed atomics: any task or lwIP
+// callback can count with one atomic add, no lock. HTTP routes get a slot
+// when they are registered at startup.
+class Metrics {
+private:
+    struct Route {
+        const char* path;
+        const char* method;
+        std::atomic<uint32_t> requests;
+    };
+
+    static std::atomic<uint32_t> counters[METRIC_COUNTER_COUNT];
+    static Route routes[WEB_ROUTE_MAX];
+    static uint8_t routeCount;
+
+    // Time between loop() starts, written by the loop task only
+    static DurationHistogram loopTime;
+    static uint32_t lastLoopUs;
+
+public:
+    static void add(MetricCounter counter, uint32_t n = 1) {
+        counters[counter].fetch_add(n, std::memory_order_relaxed);
+    }
+    static uint32_t get(MetricCounter counter) { return counters[counter].load(std::memory_order_relaxed); }
+    static const char* getName(MetricCounter counter);
+    static const char* getHelp(MetricCounter counter);
+
+    // Call while setting up routes, returns -1 once WEB_ROUTE_MAX are registered
+    static int8_t addRoute(const char* path, const char* method);
+    static void countRequest(int8_t route) {
+        if (route >= 0) {
+            routes[route].requests.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    static uint8_t getRouteCount() { return routeCount; }
+    static const char* getRoutePath(uint8_t route) { return routes[route].path; }
+    static const char* getRouteMethod(uint8_t route) { return routes[route].method; }
+    static uint32_t getRouteRequests(uint8_t route) { return routes[route].requests.load(std::memory_order_relaxed); }
+
+    // Call first thing in loop(), records the time since the previous call
+    static void markLoop();
+    static const DurationHistogram& getLoopTime() { return loopTime; }
+};
+
+// Prometheus text exposition format into a caller-owned buffer. Works like
+// JsonWriter in replay mode: a line that does not fit is dropped and the
+// writer turns full, the next buffer runs the same code again with
+// skip = getTokens(). Label sets are passed preformatted, e.g. sensor="dht22",
+// build them with appendLabel().
+class PrometheusWriter {
+private:
+    TextBuffer out;
+    uint32_t skip;
+    uint32_t lines;         // written or skipped
+    size_t mark;            // length before the current line
+    bool full;
+
+    bool startLine();
+    void finishLine();
+    // name[suffix][{labels[,le="..."]}] and the separating space
+    void appendSeries(const char* name, const char* suffix, const char* labels, const char* le);
+    void appendSeconds(uint64_t us);
+
+public:
+    PrometheusWriter(char* buffer, size_t capacity, uint32_t skip = 0);
+
+    // # HELP and # TYPE of a metric family, type is counter, gauge or histogram
+    void family(const char* name, const char* type, const char* help);
+    void sample(const char* name, const char* labels, int64_t value);
+    // Microseconds written as seconds, the Prometheus base unit
+    void sampleSeconds(const char* name, const char* labels, uint64_t us);
+    // Cumulative _bucket series with le in seconds, then _sum and _count
+    void histogram(const char* name, const char* labels, const DurationHistogram& hist);
+
+    // Adds name="value" to a label set, comma-separated, with backslash,
+    // double quote and newline escaped in the value
+    static void appendLabel(TextBuffer& labels, const char* name, const char* value);
+
+    size_t getLength() const { return out.getLength(); }
+    uint32_t getTokens() const { return lines; }
+    bool isFull() const { return full; }
+};
+
+#endif // METRICS_H
@@ -1,20 +1,71 @@
 #include "mqtt.h"
 #include <Arduino.h>
 #include "wifi_manager.h"
+#include <Preferences.h>
+#include <esp_system.h>
+#include <time.h>
 
 MQTTManager::MQTTManager(const char* server, int port, const char* user, const char* password)
-    : mqttServer(server), mqttPort(port), mqttUser(user), mqttPassword(password) {
-    mqttClient = new PubSubClient(espClient);
+    : mqttServer(server), mqttPort(port), mqttUser(user), mqttPassword(password),
+      topic(topicBuffer, sizeof(topicBuffer)), payload(payloadBuffer, sizeof(payloadBuffer)) {
+    mqttClient = new MqttClient();
     lastReconnectAttempt = 0;
-    reconnectInterval = 5000; // Try to reconnect every 5 seconds
+    reconnectInterval = 0; // First attempt right away
+    backoff = MQTT_BACKOFF_BASE;
+    storedAddress = 0;
     enabled = true;
-    tempSensor = nullptr;
-    ds18b20Sensor = nullptr;
+    sensors = nullptr;
+    filters = nullptr;
+    clock = nullptr;
+    sampleLog = nullptr;
+    rollupStore = nullptr;
+    for (int t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        publishedRollups[t] = 0;
+    }
     wasConnected = false;
+    online = false;
+    attempting = false;
+    wifiDown = false;
+    connectAttempts = 0;
+    connectFailures = 0;
+    sessions = 0;
+    offline = true;
+    offlineSince = 0;
+    outageAttempts = 0;
+    lastReconnectMs = 0;
+    maxReconnectMs = 0;
+    lastReconnectAttempts = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        channelState[ch].value = 0;
+        channelState[ch].time = 0;
+        channelState[ch].published = false;
+        channelState[ch].valid = false;
+    }
+    publishCount = 0;
+    suppressedCount = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        lastSampleMillis[ch] = 0;
+        latestValues[ch] = 0;
+        latestValid[ch] = false;
+    }
+    bootId = esp_random();
+    batchSeq = 0;
+    lastBatchPublish = 0;
+    batchRefused = false;
+    draining = false;
+    drainStart = 0;
+    drainSamples = 0;
+    drainRate = 0;
+    cycleMask = 0;
+    cycleInvalid = 0;
+    cycleUnsent = 0;
 
     // Generate unique client ID using MAC address
-    clientId = "ppiot-" + WiFiManager::getMacLastDigits();
-    baseTopic = "ppiot/" + WiFiManager::getMacLastDigits();
+    String macDigits = WiFiManager::getMacLastDigits();
+    snprintf(clientId, sizeof(clientId), "ppiot-%s", macDigits.c_str());
+    snprintf(baseTopic, sizeof(baseTopic), "ppiot/%s", macDigits.c_str());
+    topic.append(baseTopic);
+    baseTopicLength = topic.getLength();
 }
 
 MQTTManager::~MQTTManager() {
@@ -24,11 +75,29 @@ MQTTManager::~MQTTManager() {
     }
 }
 
-void MQTTManager::begin(TemperatureSensor* tempSensor, DS18B20Sensor* ds18b20Sensor) {
-    this->tempSensor = tempSensor;
-    this->ds18b20Sensor = ds18b20Sensor;
+void MQTTManager::begin(SensorSet* sensors, SensorFilters* filters, SampleClock* clock, SampleLog* sampleLog, RollupStore* rollupStore) {
+    this->sensors = sensors;
+    this->filters = filters;
+    this->clock = clock;
+    outbound.begin(sampleLog, clock);
+    this->sampleLog = sampleLog;
+    this->rollupStore = rollupStore;
 
     mqttClient->setServer(mqttServer, mqttPort);
+    mqttClient->setKeepAlive(MQTT_KEEPALIVE);
+    mqttClient->setConnectTimeout(MQTT_CONNECT_TIMEOUT);
+    mqttClient->setDnsTtl(MQTT_DNS_TTL);
+    // QoS 1 needs the broker to keep the session for retransmissions after a reconnect
+    mqttClient->setCleanSession(MQTT_QOS == 0);
+
+    // Broker address of the last session, used when DNS is down
+    Preferences preferences;
+    if (preferences.begin("mqtt", true)) {
+        storedAddress = preferences.getUInt("ip", 0);
+        preferences.end();
+    }
+    mqttClient->setFallbackAddress(storedAddress);
+    offlineSince = millis();
 
     Serial.println("=== MQTT Manager Initialized ===");
     Serial.print("Server: ");
@@ -52,41 +121,82 @@ bool MQTTManager::reconnect() {
         return false;
     }
 
-    Serial.print("Attempting MQTT connection to ");
+    Serial.print("[MQTT] Connecting to ");
     Serial.print(mqttServer);
     Serial.print(":");
     Serial.print(mqttPort);
     Serial.print(" as ");
-    Serial.print(clientId);
-    Serial.print("...");
+    Serial.println(clientId);
 
-    // Attempt to connect with username and password
-    bool connected = false;
-    if (mqttUser && strlen(mqttUser) > 0) {
-        connected = mqttClient->connect(clientId.c_str(), mqttUser, mqttPassword);
-    } else {
-        connected = mqttClient->connect(clientId.c_str());
-    }
+    // Returns right away, DNS, TCP and CONNACK complete in the background
+    connectAttempts++;
+    outageAttempts++;
+    return mqttClient->connect(clientId, mqttUser, mqttPassword);
+}
 
-    if (connected) {
-        Serial.println(" Connected!");
+void MQTTManager::scheduleRetry() {
+    // Decorrelated jitter: random in [base, 3 * previous wait], capped. Devices
+    // that lost the same broker spread out instead of retrying in lockstep.
+    unsigned long next = random(MQTT_BACKOFF_BASE, backoff * 3 + 1);
+    backoff = next < MQTT_BACKOFF_CAP ? next : MQTT_BACKOFF_CAP;
+    reconnectInterval = backoff;
+    lastReconnectAttempt = millis();
+}
 
-        // Publish connection status
-        String statusTopic = baseTopic + "/status";
-        mqttClient->publish(statusTopic.c_str(), "online", true); // retained message
+void MQTTManager::scheduleFastRetry() {
+    backoff = MQTT_BACKOFF_BASE;
+    reconnectInterval = random(0, MQTT_BACKOFF_BASE);
+    lastReconnectAttempt = millis();
+}
 
-        // Publish device info
-        String deviceInfoTopic = baseTopic + "/device/info";
-        String deviceInfo = "{\"clientId\":\"" + clientId + "\",\"ip\":\"" + WiFi.localIP().toString() + "\"}";
-        mqttClient->publish(deviceInfoTopic.c_str(), deviceInfo.c_str());
+void MQTTManager::markOffline() {
+    if (!offline) {
+        offline = true;
+        offlineSince = millis();
+        outageAttempts = 0;
+    }
+}
 
-        return true;
-    } else {
-        Serial.print(" Failed, rc=");
-        Serial.print(mqttClient->state());
-        Serial.println();
-        return false;
+void MQTTManager::onConnected() {
+    sessions++;
+    if (offline) {
+        offline = false;
+        lastReconnectMs = millis() - offlineSince;
+        lastReconnectAttempts = outageAttempts;
+        if (lastReconnectMs > maxReconnectMs) {
+            maxReconnectMs = lastReconnectMs;
+        }
+    }
+    backoff = MQTT_BACKOFF_BASE;
+
+    Serial.print("[MQTT] Connected after ");
+    Serial.print(lastReconnectAttempts);
+    Serial.print(" attempt(s) in ");
+    Serial.print(lastReconnectMs);
+    Serial.println(" ms");
+
+    // Keep the broker address for when DNS is down, written only when it changes
+    uint32_t address = mqttClient->getAddress();
+    if (address != storedAddress) {
+        Preferences preferences;
+        preferences.begin("mqtt", false);
+        preferences.putUInt("ip", address);
+        preferences.end();
+        storedAddress = address;
     }
+
+    // Publish connection status
+    mqttClient->publish(makeTopic("status"), "online", true); // retained message
+
+    // Publish device info
+    IPAddress ip = WiFi.localIP();
+    payload.clear();
+    payload.appendf("{\"clientId\":\"%s\",\"ip\":\"%u.%u.%u.%u\"}", clientId, ip[0], ip[1], ip[2], ip[3]);
+    mqttClient->publish(makeTopic("device", "info"), payload.c_str());
+
+#if MQTT_ENCODING == MQTT_ENCODING_CBOR
+    publishSchema();
+#endif
 }
 
 void MQTTManager::loop() {
@@ -100,84 +210,673 @@ void MQTTManager::loop() {
             Serial.println("[MQTT] WiFi disconnected, MQTT will reconnect when WiFi is back");
             wasConnected = false;
         }
+        if (!wifiDown) {
+            // The session does not survive this, start clean once WiFi is back
+            wifiDown = true;
+            mqttClient->disconnect();
+            online = false;
+            attempting = false;
+            markOffline();
+        }
         return;
     }
+    if (wifiDown) {
+        wifiDown = false;
+        scheduleFastRetry();
+    }
 
-    if (!mqttClient->connected()) {
-        unsigned long now = millis();
-        if (now - lastReconnectAttempt > reconnectInterval) {
-            lastReconnectAttempt = now;
-            if (reconnect()) {
-                wasConnected = true;
-                lastReconnectAttempt = 0;
-            }
+    mqttClient->loop();
+
+    if (mqttClient->connected()) {
+        if (!online) {
+            online = true;
+            attempting = false;
+            onConnected();
         }
-    } else {
         wasConnected = true;
-        mqttClient->loop();
+        publishReplay();
+        publishRollups();
+        publishSamples();
+        return;
+    }
+
+    if (online) {
+        online = false;
+        Serial.print("[MQTT] Connection lost, rc=");
+        Serial.println(mqttClient->getError());
+        markOffline();
+        scheduleFastRetry();
+    }
+    if (mqttClient->getState() != MqttClient::STATE_DISCONNECTED) {
+        return; // attempt in progress
+    }
+    if (attempting) {
+        attempting = false;
+        connectFailures++;
+        scheduleRetry();
+        Serial.print("[MQTT] Connection failed, rc=");
+        Serial.print(mqttClient->getError());
+        Serial.print(", retry in ");
+        Serial.print(reconnectInterval);
+        Serial.println(" ms");
+    }
+
+    if (millis() - lastReconnectAttempt >= reconnectInterval) {
+        attempting = reconnect();
+        if (!attempting) {
+            connectFailures++;
+            scheduleRetry();
+        }
     }
 }
 
-void MQTTManager::publishDHT22Data() {
-    if (!mqttClient->connected() || !tempSensor || !tempSensor->isValid()) {
+void MQTTManager::queueReading(const SensorReading& reading) {
+    if (reading.channel >= CHANNEL_COUNT) {
+        return;
+    }
+    latestValid[reading.channel] = reading.valid;
+    if (!reading.valid) {
+        return;
+    }
+    latestValues[reading.channel] = reading.value;
+    lastSampleMillis[reading.channel] = reading.timestamp;
+
+#if MQTT_BATCH_ENABLED
+    if (!clock) {
+        return;
+    }
+    QueuedSample sample;
+    sample.epochMs = clock->toEpochMs(reading.timestamp);
+    // The log stamps the cycle when its first reading arrives (append() runs
+    // before this), take that rather than recomputing it a moment later
+    LogRecord cycle;
+    uint32_t cycleMillis;
+    if (sampleLog && sampleLog->getPending(cycle, cycleMillis) && cycleMillis == reading.timestamp) {
+        sample.logTimestamp = cycle.timestamp;
+    } else {
+        sample.logTimestamp = (uint32_t)(sample.epochMs / 1000);
+    }
+    sample.channel = reading.channel;
+    sample.value = reading.value;
+    outbound.push(sample);
+#endif
+}
+
+void MQTTManager::publishSamples() {
+    if (outbound.isEmpty()) {
+        return;
+    }
+
+    // A backlog drains one batch per MQTT_DRAIN_INTERVAL, leaving room for live
+    // publishing. A refused batch is retried as often, not a full interval later.
+    unsigned long now = millis();
+    bool backlog = outbound.hasBacklog();
+    if (now - lastBatchPublish < (backlog || batchRefused ? MQTT_DRAIN_INTERVAL : MQTT_BATCH_INTERVAL)) {
+        return;
+    }
+    lastBatchPublish = now;
+
+    uint16_t count = outbound.peek(batchBuffer, MQTT_BATCH_MAX);
+    if (count == 0) {
+        return;
+    }
+
+#if MQTT_ENCODING == MQTT_ENCODING_CBOR
+    CborWriter writer((uint8_t*)payloadBuffer, sizeof(payloadBuffer));
+    encodeSamplesCbor(writer, batchBuffer, count, clock->isSynced(), bootId, batchSeq);
+    if (writer.hasOverflowed()) {
+        // It would never fit, keeping it would block the queue for good
+        Serial.println("[MQTT] Sample batch exceeds MQTT_PAYLOAD_MAX, dropped");
+        outbound.drop(count);
+        return;
+    }
+    if (!publishLarge(makeTopic("samples", "cbor"), (const uint8_t*)payloadBuffer, writer.getLength(), MQTT_QOS)) {
+        batchRefused = true;
+        return; // stays queued
+    }
+#else
+    encodeSamplesJson(payload, batchBuffer, count, clock->isSynced(), bootId, batchSeq);
+    if (payload.hasOverflowed()) {
+        Serial.println("[MQTT] Sample batch exceeds MQTT_PAYLOAD_MAX, dropped");
+        outbound.drop(count);
         return;
     }
+    if (!publishLarge(makeTopic("samples"), payload, MQTT_QOS)) {
+        batchRefused = true;
+        return; // stays queued
+    }
+#endif
+    outbound.commit(count);
+    batchRefused = false;
+    batchSeq++;
+
+    // Drain throughput of the current backlog, reported once it is cleared
+    if (backlog && !draining) {
+        draining = true;
+        drainStart = now;
+        drainSamples = 0;
+    }
+    if (draining) {
+        drainSamples += count;
+        if (!outbound.hasBacklog()) {
+            draining = false;
+            drainRate = drainSamples * 1000 / (millis() - drainStart + 1);
+            Serial.print("[MQTT] Backlog drained, ");
+            Serial.print(drainSamples);
+            Serial.print(" samples at ");
+            Serial.print(drainRate);
+            Serial.println(" samples/s");
+        }
+    }
+}
 
-    // Publish individual readings
-    String tempTopic = baseTopic + "/dht22/temperature";
-    String humidityTopic = baseTopic + "/dht22/humidity";
-    String heatIndexTopic = baseTopic + "/dht22/heatindex";
+void MQTTManager::publishRollups() {
+    if (!rollupStore) {
+        return;
+    }
 
-    char tempStr[8];
-    char humidityStr[8];
-    char heatIndexStr[8];
+    char channelName[CHANNEL_NAME_MAX];
 
-    dtostrf(tempSensor->getTemperature(), 6, 2, tempStr);
-    dtostrf(tempSensor->getHumidity(), 6, 2, humidityStr);
-    dtostrf(tempSensor->getHeatIndex(), 6, 2, heatIndexStr);
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        uint32_t closed = rollupStore->getClosedCount(t);
+        uint16_t count = rollupStore->getCount(t);
+        if (closed == publishedRollups[t]) {
+            continue;
+        }
+        if (count == 0) {
+            publishedRollups[t] = closed;
+            continue;
+        }
 
-    mqttClient->publish(tempTopic.c_str(), tempStr);
-    mqttClient->publish(humidityTopic.c_str(), humidityStr);
-    mqttClient->publish(heatIndexTopic.c_str(), heatIndexStr);
+        payload.clear();
+        payload.appendf("{\"start\":%lu,\"seconds\":%lu",
+                        (unsigned long)rollupStore->getBucketStart(t, count - 1),
+                        (unsigned long)rollupStore->getWindowSeconds(t));
 
-    // Publish combined JSON data
-    String dataTopic = baseTopic + "/dht22/data";
-    String jsonData = "{\"temperature\":" + String(tempStr) +
-                      ",\"humidity\":" + String(humidityStr) +
-                      ",\"heatIndex\":" + String(heatIndexStr) + "}";
+        RollupBucket bucket;
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            if (!rollupStore->getBucket(t, ch, count - 1, bucket) || bucket.count == 0) {
+                continue;
+            }
+            formatChannelName(ch, channelName, sizeof(channelName));
+            payload.appendf(",\"%s\":{\"min\":", channelName);
+            payload.appendFloat(bucket.min / 100.0f);
+            payload.append(",\"max\":");
+            payload.appendFloat(bucket.max / 100.0f);
+            payload.append(",\"avg\":");
+            payload.appendFloat(bucket.sum / 100.0f / bucket.count);
+            payload.append(",\"last\":");
+            payload.appendFloat(bucket.last / 100.0f);
+            payload.appendf(",\"count\":%u}", (unsigned)bucket.count);
+        }
+        payload.append("}");
 
-    mqttClient->publish(dataTopic.c_str(), jsonData.c_str());
+        // Tried again on the next loop until the client takes it
+        const char* rollupTopic = makeTopic("rollup", RollupStore::tierName(t));
+        if (!publishLarge(rollupTopic, payload)) {
+            continue;
+        }
+        publishedRollups[t] = closed;
 
-    Serial.print("[MQTT] Published DHT22 data to ");
-    Serial.println(dataTopic);
+        Serial.print("[MQTT] Published rollup to ");
+        Serial.println(rollupTopic);
+    }
 }
 
-void MQTTManager::publishDS18B20Data() {
-    if (!mqttClient->connected() || !ds18b20Sensor || !ds18b20Sensor->isValid()) {
+void MQTTManager::publishReplay() {
+    if (!sampleLog || !sampleLog->isReplayActive()) {
         return;
     }
 
-    // Publish DS18B20 temperature
-    String tempTopic = baseTopic + "/ds18b20/temperature";
+    const char* replayTopic = makeTopic("log", "replay");
+    LogRecord record;
+
+    for (int n = 0; n < LOG_REPLAY_BATCH && sampleLog->peekReplay(record); n++) {
+        payload.clear();
+        appendRecord(payload, record);
+        if (!mqttClient->publish(replayTopic, payload.c_str())) {
+            return; // send buffer full, the same record is tried on the next loop
+        }
+        sampleLog->advanceReplay();
+    }
+
+    if (!sampleLog->isReplayActive()) {
+        Serial.println("[MQTT] Log replay finished");
+    }
+}
+
+void MQTTManager::appendRecord(TextBuffer& out, const LogRecord& record) {
+    char channelName[CHANNEL_NAME_MAX];
+    out.appendf("{\"t\":%lu", (unsigned long)record.timestamp);
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (!(record.validMask & (1u << ch))) {
+            continue;
+        }
+        formatChannelName(ch, channelName, sizeof(channelName));
+        out.appendf(",\"%s\":", channelName);
+        out.appendFloat(record.values[ch] / 100.0f);
+    }
+    out.append('}');
+}
+
+struct MQTTManager::PublishVisitor {
+    MQTTManager* manager;
+    TextBuffer* state;
+    bool changed;
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        if (manager->publishSensor(sensor, firstChannel, state)) {
+            changed = true;
+        }
+    }
+};
+
+bool MQTTManager::hasChanged(uint8_t channel, bool valid, float value, const SensorField& field, unsigned long now) const {
+#if MQTT_REPORT_BY_EXCEPTION
+    const ChannelState& state = channelState[channel];
+    if (!state.published || valid != state.valid || now - state.time >= MQTT_HEARTBEAT_INTERVAL) {
+        return true;
+    }
+    if (!valid) {
+        return false;
+    }
+
+    float band = field.deadband;
+    if (field.deadbandMode == DEADBAND_PERCENT) {
+        band = fabsf(state.value) * field.deadband / 100.0f;
+        if (band < field.deadbandMin) {
+            band = field.deadbandMin;
+        }
+    }
+    return fabsf(value - state.value) > band;
+#else
+    return true;
+#endif
+}
+
+void MQTTManager::markPublished(uint8_t channel, bool valid, float value, unsigned long now) {
+    channelState[channel].value = value;
+    channelState[channel].time = now;
+    channelState[channel].published = true;
+    channelState[channel].valid = valid;
+}
+
+const char* MQTTManager::makeTopic(const char* a, const char* b, const char* c) {
+    topic.truncate(baseTopicLength);
+    topic.append('/');
+    topic.append(a);
+    if (b) {
+        topic.append('/');
+        topic.append(b);
+    }
+    if (c) {
+        topic.append('/');
+        topic.append(c);
+    }
+    return topic.c_str();
+}
+
+bool MQTTManager::publishValue(const char* topic, const char* payload) {
+    if (!mqttClient->publish(topic, payload)) {
+        return false;
+    }
+    publishCount++;
+    return true;
+}
+
+bool MQTTManager::publishLarge(const char* topic, const uint8_t* payload, size_t length, uint8_t qos) {
+    if (!mqttClient->publish(topic, payload, length, false, qos)) {
+        return false;
+    }
+    publishCount++;
+    return true;
+}
 
-    char tempStr[8];
-    dtostrf(ds18b20Sensor->getTemperature(), 6, 2, tempStr);
+void MQTTManager::publishSchema() {
+    payload.clear();
+    payload.appendf("{\"v\":%d,\"scale\":100,\"channels\":[", MQTT_CBOR_SCHEMA);
+    char channelName[CHANNEL_NAME_MAX];
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        formatChannelName(ch, channelName, sizeof(channelName));
+        payload.appendf("%s\"%s\"", ch ? "," : "", channelName);
+    }
+    payload.append("]}");
+    mqttClient->publish(makeTopic("schema"), payload.c_str(), true);
+}
 
-    mqttClient->publish(tempTopic.c_str(), tempStr);
+uint64_t MQTTManager::getSampleTime(uint8_t channel) {
+    if (!clock || lastSampleMillis[channel] == 0) {
+        return 0;
+    }
+    return clock->toEpochMs(lastSampleMillis[channel]);
+}
 
-    // Publish JSON data
-    String dataTopic = baseTopic + "/ds18b20/data";
-    String jsonData = "{\"temperature\":" + String(tempStr) + "}";
+template <typename S>
+void MQTTManager::appendFields(TextBuffer& out, const float* values, bool valid, uint8_t channel, uint8_t width) {
+    for (uint8_t f = 0; f < S::FIELDS; f++) {
+        out.appendf("%s\"%s\":", f ? "," : "", S::field(f).key);
+        if (valid) {
+            out.appendFloat(values[f], width);
+        } else {
+            out.append("null");
+        }
+    }
+    // Sample time in epoch ms, receivers must not assume arrival time
+    uint64_t sampleTime = getSampleTime(channel);
+    if (sampleTime) {
+        out.appendf(",\"ts\":%llu", (unsigned long long)sampleTime);
+    }
+}
 
-    mqttClient->publish(dataTopic.c_str(), jsonData.c_str());
+template <typename S>
+bool MQTTManager::publishSensor(S& sensor, uint8_t firstChannel, TextBuffer* state) {
+    unsigned long now = millis();
+    char valueBuffer[16];
+    TextBuffer value(valueBuffer, sizeof(valueBuffer));
+    char dataBuffer[160];
+    TextBuffer data(dataBuffer, sizeof(dataBuffer));
+    bool changed[S::FIELDS];
+    bool sent[S::FIELDS];
+    float values[S::FIELDS];
+    bool sensorChanged = false;
+    bool stateOpen = false;
+    bool probesOpen = false;
+
+    for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+        // A failed read is reported once as null, then stays quiet until
+        // the instance recovers or the heartbeat is due
+        uint8_t instanceChannel = firstChannel + i * S::FIELDS;
+        bool valid = latestValid[instanceChannel];
+
+        // Only filtered values go out, like everywhere else. A reading the
+        // loop has not passed through the filter yet waits for the next cycle.
+        bool filtered = true;
+        for (uint8_t f = 0; f < S::FIELDS; f++) {
+            values[f] = 0;
+            if (valid) {
+                if (!filters) {
+                    values[f] = latestValues[instanceChannel + f];
+                } else if (!filters->getValue(instanceChannel + f, values[f])) {
+                    filtered = false;
+                }
+            }
+        }
+        if (!filtered) {
+            continue;
+        }
+
+        // Decide per channel whether it moved past its deadband or is due a heartbeat
+        bool anyChanged = false;
+        for (uint8_t f = 0; f < S::FIELDS; f++) {
+            uint8_t channel = instanceChannel + f;
+            changed[f] = hasChanged(channel, valid, values[f], S::field(f), now);
+            sent[f] = changed[f];
+            anyChanged = anyChanged || changed[f];
+        }
+        sensorChanged = sensorChanged || anyChanged;
+
+#if MQTT_LEGACY_TOPICS
+        // Multi-instance sensors publish each instance under its own subtopic (e.g. ROM address).
+        // These and the flat topics are plain numbers: a failed read skips
+        // them, only data and the newer formats report it as null.
+        if (S::MAX_INSTANCES > 1 && valid) {
+            for (uint8_t f = 0; f < S::FIELDS; f++) {
+                if (!changed[f]) {
+                    suppressedCount++;
+                    continue;
+                }
+                value.clear();
+                value.appendFloat(values[f], 6);
+                sent[f] = publishValue(makeTopic(S::name(), sensor.getInstanceId(i), S::field(f).topic), value.c_str()) && sent[f];
+            }
+        }
+
+        // First instance also goes to the flat topics plus a combined JSON
+        if (i == 0) {
+            for (uint8_t f = 0; f < S::FIELDS && valid; f++) {
+                if (!changed[f]) {
+                    suppressedCount++;
+                    continue;
+                }
+                value.clear();
+                value.appendFloat(values[f], 6);
+                sent[f] = publishValue(makeTopic(S::name(), S::field(f).topic), value.c_str()) && sent[f];
+            }
+
+            // Combined JSON data goes out whenever any field changed
+            if (anyChanged) {
+                data.clear();
+                data.append('{');
+                appendFields<S>(data, values, valid, instanceChannel, 6);
+                data.append('}');
+                bool dataSent = publishValue(makeTopic(S::name(), "data"), data.c_str());
+                if (dataSent) {
+                    Serial.print("[MQTT] Published ");
+                    Serial.print(S::name());
+                    Serial.print(" data to ");
+                    Serial.println(topic.c_str());
+                }
+                for (uint8_t f = 0; f < S::FIELDS; f++) {
+                    sent[f] = sent[f] && dataSent;
+                }
+            } else {
+                suppressedCount++;
+            }
+        }
+#endif
+
+        // Consolidated state: first instance flat like /api/sensor, every instance under "probes"
+        if (state) {
+            if (!stateOpen) {
+                state->appendf("%s\"%s\":{", state->getLength() > 1 ? "," : "", S::name());
+                stateOpen = true;
+            }
+            if (i == 0) {
+                appendFields<S>(*state, values, valid, instanceChannel, 0);
+            }
+            if (S::MAX_INSTANCES > 1) {
+                if (probesOpen) {
+                    state->append(',');
+                } else {
+                    state->append(i == 0 ? ",\"probes\":[" : "\"probes\":[");
+                    probesOpen = true;
+                }
+                state->append('{');
+                appendFields<S>(*state, values, valid, instanceChannel, 0);
+                state->appendf(",\"id\":\"%s\"}", sensor.getInstanceId(i));
+            }
+        }
+
+        for (uint8_t f = 0; f < S::FIELDS; f++) {
+            uint8_t channel = instanceChannel + f;
+            cycleValues[channel] = values[f];
+            if (valid) {
+                cycleMask |= 1u << channel;
+            } else {
+                cycleInvalid |= 1u << channel;
+            }
+#if MQTT_CONSOLIDATED
+            // The consolidated state marks the channel once it is out, see
+            // markCycle(), unless one of its legacy topics failed
+            if (changed[f] && !sent[f]) {
+                cycleUnsent |= 1u << channel;
+            }
+#else
+            if (sent[f]) {
+                markPublished(channel, valid, values[f], now);
+            }
+#endif
+        }
+    }
+
+    if (stateOpen) {
+        state->append(probesOpen ? "]}" : "}");
+    }
+    return sensorChanged;
+}
 
-    Serial.print("[MQTT] Published DS18B20 data to ");
-    Serial.println(dataTopic);
+void MQTTManager::markCycle() {
+    unsigned long now = millis();
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (cycleUnsent & (1u << ch)) {
+            continue; // changed but not on every topic, goes out again next cycle
+        }
+        if (cycleMask & (1u << ch)) {
+            markPublished(ch, true, cycleValues[ch], now);
+        } else if (cycleInvalid & (1u << ch)) {
+            markPublished(ch, false, 0, now);
+        }
+    }
 }
 
 void MQTTManager::publishAllSensorData() {
-    publishDHT22Data();
-    publishDS18B20Data();
+    if (!mqttClient->connected() || !sensors) {
+        return;
+    }
+
+    PublishVisitor visitor;
+    visitor.manager = this;
+    visitor.changed = false;
+    cycleMask = 0;
+    cycleInvalid = 0;
+    cycleUnsent = 0;
+#if MQTT_CONSOLIDATED && MQTT_ENCODING == MQTT_ENCODING_CBOR
+    // Channel names are in <base>/schema
+    visitor.state = nullptr;
+    sensors->forEach(visitor);
+
+    if (!visitor.changed) {
+        suppressedCount++;
+        return;
+    }
+
+    // Sample time of the cycle, like "ts" of the JSON formats: its earliest reading
+    uint64_t sampleTime = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        uint64_t channelTime = (cycleMask & (1u << ch)) ? getSampleTime(ch) : 0;
+        if (channelTime && (sampleTime == 0 || channelTime < sampleTime)) {
+            sampleTime = channelTime;
+        }
+    }
+
+    CborWriter writer((uint8_t*)payloadBuffer, sizeof(payloadBuffer));
+    encodeStateCbor(writer, sampleTime, cycleValues, cycleMask);
+
+    const char* stateTopic = makeTopic("state", "cbor");
+    if (!writer.hasOverflowed() && publishLarge(stateTopic, (const uint8_t*)payloadBuffer, writer.getLength())) {
+        markCycle();
+        Serial.print("[MQTT] Published state to ");
+        Serial.println(stateTopic);
+    }
+#elif MQTT_CONSOLIDATED
+    // One message per cycle with every channel, sent whenever any channel changed
+    payload.clear();
+    payload.append('{');
+    visitor.state = &payload;
+    sensors->forEach(visitor);
+    payload.append('}');
+
+    if (!visitor.changed) {
+        suppressedCount++;
+        return;
+    }
+    if (payload.hasOverflowed()) {
+        Serial.println("[MQTT] State exceeds MQTT_PAYLOAD_MAX, not published");
+        return;
+    }
+    const char* stateTopic = makeTopic("state");
+    if (publishLarge(stateTopic, payload)) {
+        markCycle();
+        Serial.print("[MQTT] Published state to ");
+        Serial.println(stateTopic);
+    }
+#else
+    visitor.state = nullptr;
+    sensors->forEach(visitor);
+#endif
+}
+
+bool MQTTManager::connect() {
+    if (mqttClient->connected()) {
+        return true;
+    }
+    if (!reconnect()) {
+        return false;
+    }
+    while (mqttClient->getState() != MqttClient::STATE_DISCONNECTED && !mqttClient->connected()) {
+        mqttClient->loop();
+        delay(10);
+    }
+    if (!mqttClient->connected()) {
+        connectFailures++;
+        Serial.print("[MQTT] Connection failed, rc=");
+        Serial.println(mqttClient->getError());
+        return false;
+    }
+    online = true;
+    onConnected();
+    return true;
+}
+
+bool MQTTManager::disconnect() {
+    bool flushed = mqttClient->flush(MQTT_CONNECT_TIMEOUT);
+    mqttClient->disconnect();
+    online = false;
+    return flushed;
+}
+
+bool MQTTManager::publishBatch(const SleepBatch& batch) {
+    uint32_t completedWakes = batch.wakeCount > 1 ? batch.wakeCount - 1 : 1;
+    const char* batchTopic = makeTopic("batch");
+    // Read once, both passes must produce the same bytes
+    unsigned long now = (unsigned long)time(nullptr);
+
+    // A full batch is larger than the payload buffer: the first pass only sizes
+    // the message, the second streams it a record at a time
+    size_t length = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1 && !mqttClient->beginPublish(batchTopic, length, false, MQTT_QOS)) {
+            return false;
+        }
+
+        for (int r = -1; r <= (int)batch.count; r++) {
+            payload.clear();
+            if (r < 0) {
+                payload.appendf("{\"boot\":%lu,\"seq\":%lu,\"now\":%lu,\"synced\":%s,\"wake\":%lu,"
+                                "\"awake_ms\":%lu,\"awake_avg_ms\":%lu,\"awake_max_ms\":%lu,\"dropped\":%lu,\"records\":[",
+                                (unsigned long)batch.powerOn, (unsigned long)batch.firstSeq(),
+                                now, batch.timeSet ? "true" : "false",
+                                (unsigned long)batch.wakeCount, (unsigned long)batch.lastAwakeMs,
+                                (unsigned long)(batch.totalAwakeMs / completedWakes),
+                                (unsigned long)batch.maxAwakeMs, (unsigned long)batch.dropped);
+            } else if (r < batch.count) {
+                if (r) payload.append(',');
+                appendRecord(payload, batch.records[r]);
+            } else {
+                payload.append("]}");
+            }
+
+            if (pass == 0) {
+                length += payload.getLength();
+            } else if (mqttClient->write((const uint8_t*)payload.c_str(), payload.getLength()) != payload.getLength()) {
+                // Stalled until the timeout: the batch stays in RTC memory
+                mqttClient->endPublish();
+                Serial.println("[MQTT] Batch upload stalled, kept for the next attempt");
+                return false;
+            }
+        }
+    }
+    if (!mqttClient->endPublish()) {
+        return false;
+    }
+    publishCount++;
+
+    Serial.print("[MQTT] Published batch of ");
+    Serial.print(batch.count);
+    Serial.print(" records to ");
+    Serial.println(batchTopic);
+    return true;
 }
 
 bool MQTTManager::isConnected() {
@@ -188,8 +887,11 @@ void MQTTManager::setEnabled(bool enable) {
     enabled = enable;
     if (!enabled && mqttClient->connected()) {
         // Publish offline status before disconnecting
-        String statusTopic = baseTopic + "/status";
-        mqttClient->publish(statusTopic.c_str(), "offline", true);
+        mqttClient->publish(makeTopic("status"), "offline", true);
+    }
+    if (!enabled) {
         mqttClient->disconnect();
+        online = false;
+        attempting = false;
     }
 }
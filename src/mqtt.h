@@ -2,49 +2,200 @@
 #define MQTT_H
 
 #include <WiFi.h>
-#include <PubSubClient.h>
-#include "temperature.h"
+#include "mqtt_client.h"
+#include "sensors.h"
+#include "sensor_filters.h"
+#include "sample_log.h"
+#include "rollup.h"
+#include "low_power.h"
+#include "sample_clock.h"
+#include "outbound_queue.h"
+#include "payload_encoding.h"
+
+static_assert(CHANNEL_COUNT <= 16, "cycleMask, cycleInvalid and cycleUnsent hold 16 channels");
 
 class MQTTManager {
 private:
-    WiFiClient espClient;
-    PubSubClient* mqttClient;
+    MqttClient* mqttClient;
     const char* mqttServer;
     int mqttPort;
     const char* mqttUser;
     const char* mqttPassword;
-    String clientId;
-    String baseTopic;
+    char clientId[24];
+    char baseTopic[24];
+
+    // Publishing builds topics and payloads in these, never on the heap
+    char topicBuffer[MQTT_TOPIC_MAX];
+    char payloadBuffer[MQTT_PAYLOAD_MAX];
+    TextBuffer topic;           // starts with baseTopic, see makeTopic()
+    size_t baseTopicLength;
+    TextBuffer payload;
 
-    unsigned long lastReconnectAttempt;
+    unsigned long lastReconnectAttempt;   // start of the wait, see scheduleRetry()
     unsigned long reconnectInterval;
+    unsigned long backoff;                // last decorrelated jitter wait
+    uint32_t storedAddress;               // known-good broker address in NVS
     bool enabled;
 
-    // Sensor references
-    TemperatureSensor* tempSensor;
-    DS18B20Sensor* ds18b20Sensor;
+    // Sensor registry
+    SensorSet* sensors;
+    struct PublishVisitor;
+    SensorFilters* filters;
+    SampleClock* clock;
+    SampleLog* sampleLog;
+    RollupStore* rollupStore;
+    uint32_t publishedRollups[ROLLUP_TIER_COUNT];
 
     // Connection state
     bool wasConnected;
+    bool online;            // session announced, see onConnected()
+    bool attempting;
+    bool wifiDown;
+
+    // Reconnect metrics, an outage runs from losing the session (or WiFi) to the next CONNACK
+    uint32_t connectAttempts;
+    uint32_t connectFailures;
+    uint32_t sessions;
+    bool offline;
+    unsigned long offlineSince;
+    uint32_t outageAttempts;
+    uint32_t lastReconnectMs;
+    uint32_t maxReconnectMs;
+    uint32_t lastReconnectAttempts;
+
+    // Report-by-exception state, last value and validity sent per channel
+    struct ChannelState {
+        float value;
+        unsigned long time;
+        bool published;
+        bool valid;     // false: null was sent for a failed read
+    };
+    ChannelState channelState[CHANNEL_COUNT];
+    uint32_t publishCount;
+    uint32_t suppressedCount;
+
+    // Sample time of each channel's latest reading (millis), 0 = none yet
+    uint32_t lastSampleMillis[CHANNEL_COUNT];
+    // Latest reading of each channel as it came off the sensor task's queue.
+    // Publishing works from these, the sensor objects belong to that task.
+    float latestValues[CHANNEL_COUNT];
+    bool latestValid[CHANNEL_COUNT];
 
-    // Reconnect logic
+    // Timestamped samples for <baseTopic>/samples, kept through outages
+    OutboundQueue outbound;
+    QueuedSample batchBuffer[MQTT_BATCH_MAX];
+    uint32_t bootId;        // random per boot, with batchSeq the dedup key of a batch
+    uint32_t batchSeq;      // of the next batch, a batch sent again keeps its number
+    unsigned long lastBatchPublish; // last attempt, sent or refused
+    bool batchRefused;      // the client refused the last batch, retry soon
+    bool draining;
+    unsigned long drainStart;
+    uint32_t drainSamples;
+    uint32_t drainRate;     // samples/s of the last drained backlog
+
+    // Channels read this cycle, for the consolidated state message
+    float cycleValues[CHANNEL_COUNT];
+    uint16_t cycleMask;
+    uint16_t cycleInvalid;  // channels of instances whose read failed
+    uint16_t cycleUnsent;   // changed channels a legacy topic failed for
+
+    bool hasChanged(uint8_t channel, bool valid, float value, const SensorField& field, unsigned long now) const;
+    // Only after the message carrying the value was accepted by the client
+    void markPublished(uint8_t channel, bool valid, float value, unsigned long now);
+    // Marks every channel of the consolidated state that just went out
+    void markCycle();
+
+    // Reconnect logic: starts an attempt, loop() follows it without blocking
     bool reconnect();
+    // Status, device info and schema after each CONNACK
+    void onConnected();
+    // Wait before the next attempt: decorrelated jitter after a failure,
+    // a short jittered wait after the session or WiFi came back
+    void scheduleRetry();
+    void scheduleFastRetry();
+    void markOffline();
+
+    // <baseTopic>/a[/b[/c]], valid until the next call
+    const char* makeTopic(const char* a, const char* b = nullptr, const char* c = nullptr);
+
+    // Publish one sensor: flat topics for the first instance plus per-instance subtopics
+    // (MQTT_LEGACY_TOPICS), and/or append it to a consolidated state object.
+    // Returns true if any of its channels changed.
+    template <typename S>
+    bool publishSensor(S& sensor, uint8_t firstChannel, TextBuffer* state);
+    // "key":value,... of one instance (null if its read failed), plus "ts" once it has a sample time
+    template <typename S>
+    void appendFields(TextBuffer& out, const float* values, bool valid, uint8_t channel, uint8_t width);
+    // {"t":timestamp,"channel":value,...} of a log record
+    void appendRecord(TextBuffer& out, const LogRecord& record);
+    // Epoch ms of a channel's latest sample, 0 before the first one
+    uint64_t getSampleTime(uint8_t channel);
+    bool publishValue(const char* topic, const char* payload);
+    // Publish a payload buffer, QoS 1 goes through the client's in-flight window
+    bool publishLarge(const char* topic, const uint8_t* payload, size_t length, uint8_t qos = 0);
+    bool publishLarge(const char* topic, const TextBuffer& text, uint8_t qos = 0) {
+        return publishLarge(topic, (const uint8_t*)text.c_str(), text.getLength(), qos);
+    }
+
+    // Retained <baseTopic>/schema mapping CBOR channel indexes to names
+    void publishSchema();
+
+    // Publish queued samples when the batch is full or MQTT_BATCH_INTERVAL passed,
+    // a backlog drains oldest first at one batch per MQTT_DRAIN_INTERVAL, as
+    // does a batch the client refused
+    void publishSamples();
+
+    // Publish a few replayed log records per loop
+    void publishReplay();
+
+    // Publish the last closed window of each rollup tier
+    void publishRollups();
 
 public:
     MQTTManager(const char* server, int port, const char* user, const char* password);
     ~MQTTManager();
 
-    void begin(TemperatureSensor* tempSensor, DS18B20Sensor* ds18b20Sensor);
+    void begin(SensorSet* sensors, SensorFilters* filters, SampleClock* clock, SampleLog* sampleLog, RollupStore* rollupStore);
     void loop();
 
     // Publishing methods
-    void publishDHT22Data();
-    void publishDS18B20Data();
     void publishAllSensorData();
 
+    // Feed every (filtered) reading, published values, timestamps and
+    // batches are built from these
+    void queueReading(const SensorReading& reading);
+
+    // Blocking connect/disconnect for battery mode, which has no loop().
+    // disconnect() waits until published data was acknowledged and returns
+    // false if some of it was not.
+    bool connect();
+    bool disconnect();
+    // Publish a deep-sleep batch to <baseTopic>/batch in one message. Record i
+    // is number "seq" + i of power-on "boot", repeats after a lost PUBACK or
+    // a failed attempt carry the same numbers. "now" is the device time at
+    // publishing: with "synced" false the record times count from power-on
+    // and are placed by their distance to it.
+    bool publishBatch(const SleepBatch& batch);
+
     // Connection status
     bool isConnected();
 
+    // Publish statistics
+    uint32_t getPublishCount() const { return publishCount; }
+    uint32_t getSuppressedCount() const { return suppressedCount; }
+    const OutboundQueue& getOutboundQueue() const { return outbound; }
+    uint32_t getDrainRate() const { return drainRate; }
+
+    // Reconnect statistics
+    const MqttClient& getClient() const { return *mqttClient; }
+    uint32_t getConnectAttempts() const { return connectAttempts; }
+    uint32_t getConnectFailures() const { return connectFailures; }
+    uint32_t getSessions() const { return sessions; }
+    uint32_t getLastReconnectMs() const { return lastReconnectMs; }
+    uint32_t getMaxReconnectMs() const { return maxReconnectMs; }
+    uint32_t getLastReconnectAttempts() const { return lastReconnectAttempts; }
+    unsigned long getRetryDelay() const { return reconnectInterval; }
+
     // Enable/disable MQTT
     void setEnabled(bool enable);
     bool isEnabled() const { return enabled; }
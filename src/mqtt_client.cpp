@@ -0,0 +1,767 @@
+#include "mqtt_client.h"
+#include "metrics.h"
+#include <lwip/tcpip.h>
+
+// Control packet types (high nibble of the fixed header)
+constexpr uint8_t MQTT_CONNECT = 1;
+constexpr uint8_t MQTT_CONNACK = 2;
+constexpr uint8_t MQTT_PUBLISH = 3;
+constexpr uint8_t MQTT_PUBACK = 4;
+constexpr uint8_t MQTT_PINGREQ = 12;
+constexpr uint8_t MQTT_PINGRESP = 13;
+constexpr uint8_t MQTT_DISCONNECT = 14;
+
+constexpr uint8_t PUBLISH_DUP = 0x08;
+constexpr uint8_t PUBLISH_QOS1 = 0x02;
+constexpr uint8_t PUBLISH_RETAIN = 0x01;
+
+static_assert(MQTT_INFLIGHT_BYTES <= 0xFFFF, "Inflight offsets are 16 bit");
+static_assert(4 * MQTT_INFLIGHT_MAX <= 255, "PUBACK ring indexes are 8 bit");
+
+// Fixed header plus remaining length, returns its size (2..5 bytes)
+static size_t writeFixedHeader(uint8_t* out, uint8_t header, size_t remaining) {
+    size_t n = 0;
+    out[n++] = header;
+    do {
+        uint8_t digit = remaining & 0x7F;
+        remaining >>= 7;
+        out[n++] = remaining ? digit | 0x80 : digit;
+    } while (remaining);
+    return n;
+}
+
+static size_t writeString(uint8_t* out, const char* value, size_t length) {
+    out[0] = length >> 8;
+    out[1] = length & 0xFF;
+    memcpy(out + 2, value, length);
+    return length + 2;
+}
+
+MqttClient::MqttClient() {
+    client = new AsyncClient();
+    host = nullptr;
+    port = 1883;
+    keepAlive = 15;
+    connectTimeout = 10000;
+    cleanSession = true;
+    dnsTtl = 3600000;
+    address = 0;
+    cachedAddress = 0;
+    cachedAt = 0;
+    cacheValid = false;
+    attemptCached = false;
+    knownGood = 0;
+    dnsState = DNS_IDLE;
+    dnsResult = 0;
+    dnsLookups = 0;
+    dnsCacheHits = 0;
+    dnsFailures = 0;
+    dnsFallbacks = 0;
+    established = false;
+    clientId = nullptr;
+    user = nullptr;
+    password = nullptr;
+    state = STATE_DISCONNECTED;
+    error = ERROR_NONE;
+    attemptStart = 0;
+    lastIn = 0;
+    lastOut = 0;
+    pingOutstanding = false;
+    unacked = 0;
+    rxStage = RX_HEADER;
+    rxHeader = 0;
+    rxRemaining = 0;
+    rxShift = 0;
+    rxBodyLength = 0;
+    streamRemaining = 0;
+    streamPacketId = 0;
+    inflightHead = 0;
+    inflightCount = 0;
+    inflightSent = 0;
+    storeUsed = 0;
+    nextPacketId = 0;
+    inflightLimit = MQTT_INFLIGHT_MAX;
+    resumed = false;
+    sessionPresent = false;
+    ackHead = 0;
+    ackTail = 0;
+    pubacks = 0;
+    retransmits = 0;
+    duplicateAcks = 0;
+    inflightLost = 0;
+
+    client->setNoDelay(true);
+    client->onConnect([](void* arg, AsyncClient*) {
+        static_cast<MqttClient*>(arg)->handleConnect();
+    }, this);
+    client->onDisconnect([](void* arg, AsyncClient*) {
+        static_cast<MqttClient*>(arg)->handleDisconnect();
+    }, this);
+    client->onData([](void* arg, AsyncClient*, void* data, size_t length) {
+        static_cast<MqttClient*>(arg)->handleData((const uint8_t*)data, length);
+    }, this);
+    client->onAck([](void* arg, AsyncClient*, size_t length, uint32_t) {
+        static_cast<MqttClient*>(arg)->handleAck(length);
+    }, this);
+}
+
+MqttClient::~MqttClient() {
+    client->close(true);
+    delete client;
+}
+
+void MqttClient::setServer(const char* host, uint16_t port) {
+    this->host = host;
+    this->port = port;
+}
+
+void MqttClient::setKeepAlive(uint16_t seconds) {
+    keepAlive = seconds;
+}
+
+void MqttClient::setConnectTimeout(uint32_t ms) {
+    connectTimeout = ms;
+}
+
+void MqttClient::setDnsTtl(uint32_t ms) {
+    dnsTtl = ms;
+}
+
+void MqttClient::setInflightLimit(uint8_t limit) {
+    inflightLimit = limit < 1 ? 1 : limit > MQTT_INFLIGHT_MAX ? MQTT_INFLIGHT_MAX : limit;
+}
+
+bool MqttClient::connect(const char* clientId, const char* user, const char* password) {
+    if (state != STATE_DISCONNECTED || !host) {
+        return false;
+    }
+    this->clientId = clientId;
+    this->user = user;
+    this->password = password;
+
+    // A cached address that did not get us a session may be stale
+    if (attemptCached && !established) {
+        cacheValid = false;
+    }
+
+    error = ERROR_NONE;
+    established = false;
+    resumed = false;
+    rxStage = RX_HEADER;
+    unacked = 0;
+    attemptStart = millis();
+
+    IPAddress literal;
+    if (literal.fromString(host)) {
+        return connectTo((uint32_t)literal);
+    }
+    if (cacheValid && attemptStart - cachedAt < dnsTtl) {
+        dnsCacheHits++;
+        attemptCached = true;
+        return connectTo(cachedAddress);
+    }
+
+    // Asynchronous lookup, loop() picks up the result
+    dnsLookups++;
+    attemptCached = false;
+    state = STATE_RESOLVING;
+    dnsState = DNS_PENDING;
+    // The DNS client is lwIP core state and core locking is off in the
+    // Arduino sdkconfig, so the query is started from the tcpip thread
+    if (tcpip_callback(startDnsLookup, this) != ERR_OK) {
+        dnsState = DNS_IDLE;
+        return connectResolved(0);
+    }
+    return true;
+}
+
+void MqttClient::startDnsLookup(void* arg) {
+    // tcpip task
+    MqttClient* self = static_cast<MqttClient*>(arg);
+    ip_addr_t result;
+    err_t err = dns_gethostbyname(self->host, &result, handleDnsFound, self);
+    if (err == ERR_OK) {
+        handleDnsFound(self->host, &result, self);
+    } else if (err != ERR_INPROGRESS) {
+        handleDnsFound(self->host, nullptr, self);
+    }
+}
+
+void MqttClient::handleDnsFound(const char* name, const ip_addr_t* result, void* arg) {
+    // tcpip task
+    MqttClient* self = static_cast<MqttClient*>(arg);
+    self->dnsResult = (result && IP_IS_V4(result)) ? ip4_addr_get_u32(ip_2_ip4(result)) : 0;
+    self->dnsState = DNS_DONE;
+}
+
+bool MqttClient::connectResolved(uint32_t resolved) {
+    if (resolved) {
+        cachedAddress = resolved;
+        cachedAt = millis();
+        cacheValid = true;
+        return connectTo(resolved);
+    }
+
+    dnsFailures++;
+    if (knownGood) {
+        dnsFallbacks++;
+        return connectTo(knownGood);
+    }
+    fail(ERROR_DNS);
+    return false;
+}
+
+bool MqttClient::connectTo(uint32_t address) {
+    this->address = address;
+    state = STATE_CONNECTING;
+
+    // Returns once the SYN is on its way
+    if (!client->connect(IPAddress(address), port)) {
+        fail(ERROR_TCP);
+        return false;
+    }
+    return true;
+}
+
+void MqttClient::disconnect() {
+    if (state == STATE_CONNECTED) {
+        uint8_t packet[2] = { MQTT_DISCONNECT << 4, 0 };
+        send(packet, sizeof(packet));
+    }
+    state = STATE_DISCONNECTED;
+    client->close(false); // graceful, queued data still goes out
+}
+
+void MqttClient::fail(int8_t reason) {
+    // Keep the first reason, closing the socket reports ERROR_TCP after it
+    int8_t none = ERROR_NONE;
+    error.compare_exchange_strong(none, reason);
+    state = STATE_DISCONNECTED;
+    client->close(true);
+}
+
+void MqttClient::loop() {
+    uint32_t now = millis();
+    uint8_t current = state;
+
+    if (current == STATE_RESOLVING && dnsState == DNS_DONE) {
+        dnsState = DNS_IDLE;
+        connectResolved(dnsResult);
+        current = state;
+    }
+    if (current == STATE_RESOLVING || current == STATE_CONNECTING || current == STATE_HANDSHAKE) {
+        // A black-holed broker never answers the SYN or the CONNECT
+        if (now - attemptStart >= connectTimeout) {
+            fail(ERROR_TIMEOUT);
+        }
+        return;
+    }
+    if (current != STATE_CONNECTED) {
+        return;
+    }
+    if (knownGood != address) {
+        knownGood = address;
+    }
+
+    processAcks();
+    sendPending();
+    // TCP is reliable, a PUBACK that never comes means the broker or the path is gone
+    if (inflightSent > 0) {
+        const Inflight& oldest = inflightAt(0);
+        if (!oldest.acked && now - oldest.sentAt >= connectTimeout) {
+            fail(ERROR_ACK);
+            return;
+        }
+    }
+
+    if (keepAlive == 0) {
+        return;
+    }
+
+    uint32_t interval = keepAlive * 1000UL;
+    if (now - lastIn >= interval || now - lastOut >= interval) {
+        if (pingOutstanding) {
+            fail(ERROR_KEEPALIVE);
+            return;
+        }
+        // Flag first, the PINGRESP can arrive before send() returns
+        uint8_t packet[2] = { MQTT_PINGREQ << 4, 0 };
+        pingOutstanding = true;
+        lastIn = now;
+        if (!send(packet, sizeof(packet))) {
+            pingOutstanding = false;
+        }
+    }
+}
+
+void MqttClient::handleConnect() {
+    // The attempt may have timed out while DNS or the SYN were in flight
+    if (state != STATE_CONNECTING) {
+        client->close(true);
+        return;
+    }
+    state = STATE_HANDSHAKE;
+    sendConnect();
+}
+
+void MqttClient::handleDisconnect() {
+    if (state.exchange(STATE_DISCONNECTED) != STATE_DISCONNECTED) {
+        int8_t none = ERROR_NONE;
+        error.compare_exchange_strong(none, ERROR_TCP);
+    }
+}
+
+void MqttClient::handleAck(size_t length) {
+    // Runs on the async_tcp task while the loop task adds to unacked, so the
+    // read and the write must be one step
+    uint32_t pending = unacked.load();
+    uint32_t left;
+    do {
+        left = length < pending ? pending - length : 0;
+    } while (!unacked.compare_exchange_weak(pending, left));
+}
+
+void MqttClient::sendConnect() {
+    size_t idLength = strlen(clientId);
+    size_t userLength = user ? strlen(user) : 0;
+    size_t passwordLength = password ? strlen(password) : 0;
+
+    uint8_t flags = cleanSession ? 0x02 : 0;
+    size_t remaining = 10 + 2 + idLength;
+    if (userLength) {
+        flags |= 0x80;
+        remaining += 2 + userLength;
+        if (passwordLength) {
+            flags |= 0x40;
+            remaining += 2 + passwordLength;
+        }
+    }
+
+    uint8_t packet[160];
+    if (remaining + 5 > sizeof(packet)) {
+        fail(ERROR_PARAMS);
+        return;
+    }
+
+    size_t n = writeFixedHeader(packet, MQTT_CONNECT << 4, remaining);
+    static const uint8_t protocol[] = { 0, 4, 'M', 'Q', 'T', 'T', 4 };
+    memcpy(packet + n, protocol, sizeof(protocol));
+    n += sizeof(protocol);
+    packet[n++] = flags;
+    packet[n++] = keepAlive >> 8;
+    packet[n++] = keepAlive & 0xFF;
+    n += writeString(packet + n, clientId, idLength);
+    if (flags & 0x80) {
+        n += writeString(packet + n, user, userLength);
+    }
+    if (flags & 0x40) {
+        n += writeString(packet + n, password, passwordLength);
+    }
+
+    if (!send(packet, n)) {
+        fail(ERROR_TCP);
+    }
+}
+
+void MqttClient::handleData(const uint8_t* data, size_t length) {
+    lastIn = millis();
+
+    for (size_t i = 0; i < length; i++) {
+        uint8_t b = data[i];
+        switch (rxStage) {
+        case RX_HEADER:
+            rxHeader = b;
+            rxRemaining = 0;
+            rxShift = 0;
+            rxBodyLength = 0;
+            rxStage = RX_LENGTH;
+            break;
+
+        case RX_LENGTH:
+            rxRemaining |= (uint32_t)(b & 0x7F) << rxShift;
+            rxShift += 7;
+            if (b & 0x80) {
+                if (rxShift > 21) {
+                    fail(ERROR_PROTOCOL);
+                    return;
+                }
+            } else if (rxRemaining == 0) {
+                handlePacket();
+                rxStage = RX_HEADER;
+            } else {
+                rxStage = RX_BODY;
+            }
+            break;
+
+        case RX_BODY:
+            if (rxBodyLength < sizeof(rxBody)) {
+                rxBody[rxBodyLength++] = b;
+            }
+            if (--rxRemaining == 0) {
+                handlePacket();
+                rxStage = RX_HEADER;
+            }
+            break;
+        }
+    }
+}
+
+void MqttClient::handlePacket() {
+    switch (rxHeader >> 4) {
+    case MQTT_CONNACK:
+        if (state != STATE_HANDSHAKE || rxBodyLength < 2) {
+            fail(ERROR_PROTOCOL);
+            return;
+        }
+        if (rxBody[1] != 0) {
+            fail((int8_t)rxBody[1]); // refused, 1..5
+            return;
+        }
+        sessionPresent = rxBody[0] & 0x01;
+        pingOutstanding = false;
+        lastOut = millis();
+        established = true;
+        state = STATE_CONNECTED;
+        break;
+
+    case MQTT_PINGRESP:
+        pingOutstanding = false;
+        break;
+
+    case MQTT_PUBACK: {
+        if (rxBodyLength < 2) {
+            fail(ERROR_PROTOCOL);
+            return;
+        }
+        // Handed to loop(), the window belongs to the caller's task. A full
+        // ring drops the id, the ack timeout then recovers through a reconnect.
+        uint8_t head = ackHead;
+        uint8_t next = (head + 1) % ACK_RING;
+        if (next != ackTail) {
+            ackRing[head] = (rxBody[0] << 8) | rxBody[1];
+            ackHead = next;
+        }
+        break;
+    }
+
+    default:
+        // Nothing is subscribed, anything else is ignored
+        break;
+    }
+}
+
+bool MqttClient::add(const uint8_t* data, size_t length) {
+    if (client->add((const char*)data, length) != length) {
+        return false;
+    }
+    unacked += length;
+    Metrics::add(METRIC_MQTT_BYTES_SENT, length);
+    return true;
+}
+
+bool MqttClient::send(const uint8_t* data, size_t length) {
+    if (!add(data, length)) {
+        return false;
+    }
+    lastOut = millis();
+    return client->send();
+}
+
+bool MqttClient::countPublish(bool published) {
+    Metrics::add(published ? METRIC_MQTT_PUBLISHES : METRIC_MQTT_PUBLISH_FAILURES);
+    return published;
+}
+
+bool MqttClient::publish(const char* topic, const uint8_t* payload, size_t length, bool retained, uint8_t qos) {
+    return countPublish(writePublish(topic, payload, length, retained, qos));
+}
+
+bool MqttClient::writePublish(const char* topic, const uint8_t* payload, size_t length, bool retained, uint8_t qos) {
+    if (state != STATE_CONNECTED) {
+        return false;
+    }
+    size_t topicLength = strlen(topic);
+    if (qos == 0) {
+        size_t remaining = 2 + topicLength + length;
+        uint8_t header[5 + 2 + MQTT_TOPIC_MAX];
+        if (topicLength > MQTT_TOPIC_MAX) {
+            return false;
+        }
+        if (client->space() < remaining + 5) {
+            return false; // send buffer full, nothing written
+        }
+        // Header and payload leave in one segment, even with Nagle off
+        size_t n = writeFixedHeader(header, (MQTT_PUBLISH << 4) | (retained ? PUBLISH_RETAIN : 0), remaining);
+        n += writeString(header + n, topic, topicLength);
+        if (!add(header, n) || !add(payload, length)) {
+            fail(ERROR_PROTOCOL); // part of a packet may be out
+            return false;
+        }
+        lastOut = millis();
+        return client->send();
+    }
+
+    processAcks();
+    size_t remaining = 2 + topicLength + 2 + length;
+    if (inflightCount >= inflightLimit || storeUsed + remaining + 5 > sizeof(store)) {
+        return false; // window full, caller keeps the message
+    }
+
+    uint16_t packetId = allocatePacketId();
+    uint8_t* packet = store + storeUsed;
+    size_t n = writeFixedHeader(packet, (MQTT_PUBLISH << 4) | PUBLISH_QOS1 | (retained ? PUBLISH_RETAIN : 0), remaining);
+    n += writeString(packet + n, topic, topicLength);
+    packet[n++] = packetId >> 8;
+    packet[n++] = packetId & 0xFF;
+    memcpy(packet + n, payload, length);
+    n += length;
+
+    Inflight& slot = inflightAt(inflightCount);
+    slot.packetId = packetId;
+    slot.offset = storeUsed;
+    slot.length = n;
+    slot.acked = false;
+    slot.sentAt = 0;
+    storeUsed += n;
+    inflightCount++;
+
+    sendPending();
+    return true;
+}
+
+uint16_t MqttClient::allocatePacketId() {
+    // Never 0, never one still in flight
+    for (;;) {
+        if (++nextPacketId == 0) {
+            nextPacketId = 1;
+        }
+        bool used = false;
+        for (uint8_t i = 0; i < inflightCount && !used; i++) {
+            used = inflightAt(i).packetId == nextPacketId;
+        }
+        if (!used) {
+            return nextPacketId;
+        }
+    }
+}
+
+void MqttClient::processAcks() {
+    uint8_t tail = ackTail;
+    while (tail != ackHead) {
+        uint16_t packetId = ackRing[tail];
+        tail = (tail + 1) % ACK_RING;
+
+        bool found = false;
+        for (uint8_t i = 0; i < inflightCount; i++) {
+            Inflight& slot = inflightAt(i);
+            if (slot.packetId == packetId && !slot.acked) {
+                slot.acked = true;
+                found = true;
+                break;
+            }
+        }
+        if (found) {
+            pubacks++;
+        } else {
+            duplicateAcks++; // e.g. the broker acked a retransmission twice
+        }
+    }
+    ackTail = tail;
+
+    // Release in order, the head's copy always starts the store
+    while (inflightCount > 0 && inflight[inflightHead].acked) {
+        uint16_t length = inflight[inflightHead].length;
+        if (length) {
+            storeUsed -= length;
+            memmove(store, store + length, storeUsed);
+            for (uint8_t i = 1; i < inflightCount; i++) {
+                inflightAt(i).offset -= length;
+            }
+        }
+        inflightHead = (inflightHead + 1) % MQTT_INFLIGHT_MAX;
+        inflightCount--;
+        if (inflightSent > 0) {
+            inflightSent--;
+        }
+    }
+}
+
+void MqttClient::resumeInflight() {
+    resumed = true;
+    inflightSent = 0;
+    // A broker without the session has never seen these packet ids, they
+    // are new publishes to it rather than retransmissions
+    bool retransmit = sessionPresent;
+    for (uint8_t i = 0; i < inflightCount; i++) {
+        Inflight& slot = inflightAt(i);
+        if (slot.acked) {
+            continue;
+        }
+        if (slot.length == 0) {
+            slot.acked = true; // streamed, nothing kept to resend
+            inflightLost++;
+            continue;
+        }
+        if (retransmit) {
+            store[slot.offset] |= PUBLISH_DUP;
+            retransmits++;
+        } else {
+            store[slot.offset] &= ~PUBLISH_DUP;
+        }
+    }
+}
+
+void MqttClient::sendPending() {
+    if (state != STATE_CONNECTED) {
+        return;
+    }
+    if (!resumed) {
+        resumeInflight();
+    }
+    while (inflightSent < inflightCount) {
+        Inflight& slot = inflightAt(inflightSent);
+        if (!slot.acked) {
+            // Whole packets only, the rest goes out as the broker acknowledges
+            if (client->space() < slot.length) {
+                return;
+            }
+            if (!send(store + slot.offset, slot.length)) {
+                fail(ERROR_PROTOCOL);
+                return;
+            }
+            slot.sentAt = millis();
+        }
+        inflightSent++;
+    }
+}
+
+bool MqttClient::publish(const char* topic, const char* payload, bool retained) {
+    return publish(topic, (const uint8_t*)payload, strlen(payload), retained);
+}
+
+bool MqttClient::beginPublish(const char* topic, size_t length, bool retained, uint8_t qos) {
+    if (!startPublish(topic, length, retained, qos)) {
+        return countPublish(false);
+    }
+    return true;
+}
+
+bool MqttClient::startPublish(const char* topic, size_t length, bool retained, uint8_t qos) {
+    if (state != STATE_CONNECTED) {
+        return false;
+    }
+    size_t topicLength = strlen(topic);
+    uint8_t header[5 + 2 + 128 + 2];
+    if (topicLength > sizeof(header) - 9) {
+        return false;
+    }
+    if (qos) {
+        // Streamed messages are not kept, so they go after everything pending
+        sendPending();
+        if (inflightCount >= inflightLimit || inflightSent < inflightCount) {
+            return false;
+        }
+    }
+
+    uint8_t flags = (qos ? PUBLISH_QOS1 : 0) | (retained ? PUBLISH_RETAIN : 0);
+    size_t n = writeFixedHeader(header, (MQTT_PUBLISH << 4) | flags, 2 + topicLength + (qos ? 2 : 0) + length);
+    n += writeString(header + n, topic, topicLength);
+    uint16_t packetId = 0;
+    if (qos) {
+        packetId = allocatePacketId();
+        header[n++] = packetId >> 8;
+        header[n++] = packetId & 0xFF;
+    }
+    if (!send(header, n)) {
+        fail(ERROR_PROTOCOL); // part of a packet may be out, the stream is unusable
+        return false;
+    }
+
+    if (qos) {
+        Inflight& slot = inflightAt(inflightCount);
+        slot.packetId = packetId;
+        slot.offset = storeUsed;
+        slot.length = 0;
+        slot.acked = false;
+        slot.sentAt = millis();
+        inflightCount++;
+        inflightSent++;
+    }
+    streamPacketId = packetId;
+    streamRemaining = length;
+    return true;
+}
+
+size_t MqttClient::write(const uint8_t* data, size_t length) {
+    size_t written = 0;
+    uint32_t started = millis();
+
+    while (written < length && state == STATE_CONNECTED) {
+        size_t room = client->space();
+        if (room == 0) {
+            // Space only frees up as the broker acknowledges, so what was
+            // added has to be on the wire before waiting
+            client->send();
+            if (millis() - started >= connectTimeout) {
+                break;
+            }
+            delay(1);
+            continue;
+        }
+        size_t n = client->add((const char*)data + written, room < length - written ? room : length - written);
+        if (n == 0) {
+            delay(1);
+            continue;
+        }
+        written += n;
+        unacked += n;
+    }
+    Metrics::add(METRIC_MQTT_BYTES_SENT, written);
+
+    streamRemaining -= written < streamRemaining ? written : streamRemaining;
+    return written;
+}
+
+bool MqttClient::endPublish() {
+    return countPublish(finishPublish());
+}
+
+bool MqttClient::finishPublish() {
+    uint16_t packetId = streamPacketId;
+    streamPacketId = 0;
+    if (streamRemaining != 0) {
+        streamRemaining = 0;
+        fail(ERROR_PROTOCOL);
+        // The broker never gets this packet whole, release its slot instead
+        // of resending nothing on the next session. startPublish() added it
+        // last, and only the head is freed while a stream is open.
+        if (packetId && inflightCount > 0) {
+            Inflight& slot = inflightAt(inflightCount - 1);
+            if (slot.packetId == packetId && slot.length == 0) {
+                inflightCount--;
+                if (inflightSent > inflightCount) {
+                    inflightSent = inflightCount;
+                }
+            }
+        }
+        return false;
+    }
+    lastOut = millis();
+    return client->send();
+}
+
+bool MqttClient::flush(uint32_t timeoutMs) {
+    uint32_t started = millis();
+    for (;;) {
+        processAcks();
+        sendPending();
+        if ((unacked == 0 && inflightCount == 0) || state != STATE_CONNECTED) {
+            break;
+        }
+        if (millis() - started >= timeoutMs) {
+            return false;
+        }
+        delay(5);
+    }
+    return unacked == 0 && inflightCount == 0;
+}
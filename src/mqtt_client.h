@@ -0,0 +1,218 @@
+#ifndef MQTT_CLIENT_H
+#define MQTT_CLIENT_H
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <lwip/dns.h>
+#include <atomic>
+#include "config.h"
+
+// Publish-only MQTT 3.1.1 client on AsyncTCP. Nothing here blocks the caller:
+// DNS (cached for a TTL) and the TCP connect run in the lwIP/async_tcp tasks,
+// CONNACK and PINGRESP arrive through the data callback, and a publish either
+// fits the TCP send buffer right away or fails. Callbacks run in the lwIP and
+// async_tcp tasks and only touch the atomics and send CONNECT; timeouts and
+// keepalive are driven by loop() in the caller's task.
+//
+// QoS 1 messages go through a window of up to MQTT_INFLIGHT_MAX unacknowledged
+// publishes, pipelined rather than stop-and-wait. Each is kept until its PUBACK
+// and sent again after a reconnect, with clean session off so the broker keeps
+// its side of the session: DUP set if the CONNACK reports the session present,
+// as new publishes if the broker lost it.
+class MqttClient {
+public:
+    enum State : uint8_t {
+        STATE_DISCONNECTED = 0,
+        STATE_RESOLVING,    // DNS lookup
+        STATE_CONNECTING,   // TCP connect
+        STATE_HANDSHAKE,    // CONNECT sent, waiting for CONNACK
+        STATE_CONNECTED
+    };
+
+    // Why the last attempt or session ended, CONNACK refusals are 1..5
+    enum Error : int8_t {
+        ERROR_NONE = 0,
+        ERROR_TCP = -1,         // TCP connect failed or connection lost
+        ERROR_TIMEOUT = -2,     // no CONNACK within the connect timeout
+        ERROR_KEEPALIVE = -3,   // no PINGRESP within the keepalive interval
+        ERROR_PROTOCOL = -4,    // unexpected packet or a publish cut short
+        ERROR_PARAMS = -5,      // client id, user and password too long
+        ERROR_DNS = -6,         // lookup failed and no known-good address
+        ERROR_ACK = -7          // no PUBACK within the connect timeout, half-dead connection
+    };
+
+private:
+    AsyncClient* client;
+    const char* host;
+    uint16_t port;
+    uint16_t keepAlive;         // s, 0 = off
+    uint32_t connectTimeout;    // ms from connect() to CONNACK
+    bool cleanSession;
+
+    const char* clientId;
+    const char* user;
+    const char* password;
+
+    // Broker address, IPv4 in network byte order. A lookup is cached for dnsTtl;
+    // the last address that got a CONNACK is used when DNS fails.
+    uint32_t dnsTtl;
+    uint32_t address;           // target of the current attempt
+    uint32_t cachedAddress;
+    uint32_t cachedAt;
+    bool cacheValid;
+    bool attemptCached;         // current attempt uses cachedAddress
+    uint32_t knownGood;
+    enum DnsState : uint8_t { DNS_IDLE, DNS_PENDING, DNS_DONE };
+    std::atomic<uint8_t> dnsState;
+    std::atomic<uint32_t> dnsResult; // 0 = lookup failed
+    uint32_t dnsLookups;
+    uint32_t dnsCacheHits;
+    uint32_t dnsFailures;
+    uint32_t dnsFallbacks;
+
+    std::atomic<uint8_t> state;
+    std::atomic<bool> established;  // the current attempt got its CONNACK
+    std::atomic<int8_t> error;
+    uint32_t attemptStart;
+    std::atomic<uint32_t> lastIn;
+    std::atomic<uint32_t> lastOut;
+    std::atomic<bool> pingOutstanding;
+    std::atomic<uint32_t> unacked;  // bytes sent but not yet acknowledged by TCP
+
+    // Incoming packet parser (async_tcp task)
+    enum RxStage : uint8_t { RX_HEADER, RX_LENGTH, RX_BODY };
+    RxStage rxStage;
+    uint8_t rxHeader;
+    uint32_t rxRemaining;
+    uint8_t rxShift;
+    uint8_t rxBody[4];          // longer bodies are skipped past this
+    uint8_t rxBodyLength;
+
+    size_t streamRemaining;     // payload bytes beginPublish() still expects
+    uint16_t streamPacketId;    // QoS 1 stream in progress, 0 = none
+
+    // QoS 1 window, oldest first. Packets are copied to store for retransmission,
+    // a streamed one (length 0) is not kept and is lost if the session drops.
+    struct Inflight {
+        uint16_t packetId;
+        uint16_t offset;        // in store
+        uint16_t length;
+        bool acked;
+        uint32_t sentAt;
+    };
+    Inflight inflight[MQTT_INFLIGHT_MAX];
+    uint8_t inflightHead;
+    uint8_t inflightCount;
+    uint8_t inflightSent;       // slots from the head handed to TCP, the rest wait for room
+    uint8_t store[MQTT_INFLIGHT_BYTES];
+    size_t storeUsed;
+    uint16_t nextPacketId;
+    uint8_t inflightLimit;
+    bool resumed;               // window restarted for the current session
+    std::atomic<bool> sessionPresent;   // from the CONNACK
+
+    // PUBACK packet ids from the async_tcp task, applied by the caller's task
+    static constexpr uint8_t ACK_RING = 4 * MQTT_INFLIGHT_MAX;
+    uint16_t ackRing[ACK_RING];
+    std::atomic<uint8_t> ackHead;
+    std::atomic<uint8_t> ackTail;
+
+    uint32_t pubacks;
+    uint32_t retransmits;
+    uint32_t duplicateAcks;     // PUBACK for a packet id no longer in flight
+    uint32_t inflightLost;      // streamed QoS 1 publishes dropped by a reconnect
+
+    // AsyncTCP callbacks
+    void handleConnect();
+    void handleDisconnect();
+    void handleData(const uint8_t* data, size_t length);
+    void handleAck(size_t length);
+    void handlePacket();
+
+    static void startDnsLookup(void* arg);
+    static void handleDnsFound(const char* name, const ip_addr_t* result, void* arg);
+    bool connectResolved(uint32_t resolved);
+    bool connectTo(uint32_t address);
+
+    void sendConnect();
+    // publish(), beginPublish() and endPublish() without the metrics, the
+    // public ones count each message once as published or failed
+    bool writePublish(const char* topic, const uint8_t* payload, size_t length, bool retained, uint8_t qos);
+    bool startPublish(const char* topic, size_t length, bool retained, uint8_t qos);
+    bool finishPublish();
+    static bool countPublish(bool published);
+    uint16_t allocatePacketId();
+    Inflight& inflightAt(uint8_t i) { return inflight[(inflightHead + i) % MQTT_INFLIGHT_MAX]; }
+    // Apply received PUBACKs and free acknowledged slots from the head
+    void processAcks();
+    // Hand waiting window packets to TCP while they fit
+    void sendPending();
+    // New session: resend everything unacknowledged with DUP set
+    void resumeInflight();
+    // add() only queues in the TCP send buffer, send() also pushes it out
+    bool add(const uint8_t* data, size_t length);
+    bool send(const uint8_t* data, size_t length);
+    void fail(int8_t reason);
+
+public:
+    MqttClient();
+    ~MqttClient();
+
+    void setServer(const char* host, uint16_t port);
+    void setKeepAlive(uint16_t seconds);
+    void setConnectTimeout(uint32_t ms);
+    void setDnsTtl(uint32_t ms);
+    // Off for QoS 1, the broker then keeps the session across reconnects
+    void setCleanSession(bool clean) { cleanSession = clean; }
+    // Seed the DNS fallback, e.g. with a known-good address kept across reboots
+    void setFallbackAddress(uint32_t address) { knownGood = address; }
+    // QoS 1 messages sent ahead of their PUBACK, 1..MQTT_INFLIGHT_MAX
+    void setInflightLimit(uint8_t limit);
+
+    // Starts connecting and returns at once, follow progress with getState().
+    // The strings must stay valid until the attempt ends.
+    bool connect(const char* clientId, const char* user, const char* password);
+    void disconnect();
+    // Connect timeout, keepalive and the QoS 1 window, call every loop
+    void loop();
+
+    bool connected() const { return state == STATE_CONNECTED; }
+    State getState() const { return (State)state.load(); }
+    int8_t getError() const { return error; }
+
+    // Last address that reached CONNACK, 0 = none yet
+    uint32_t getFallbackAddress() const { return knownGood; }
+    uint32_t getAddress() const { return address; }
+    uint32_t getDnsLookups() const { return dnsLookups; }
+    uint32_t getDnsCacheHits() const { return dnsCacheHits; }
+    uint32_t getDnsFailures() const { return dnsFailures; }
+    uint32_t getDnsFallbacks() const { return dnsFallbacks; }
+
+    uint8_t getInflight() const { return inflightCount; }
+    uint32_t getPubacks() const { return pubacks; }
+    uint32_t getRetransmits() const { return retransmits; }
+    uint32_t getDuplicateAcks() const { return duplicateAcks; }
+    uint32_t getInflightLost() const { return inflightLost; }
+
+    // QoS 0 is all or nothing: false without sending anything if the message
+    // does not fit the TCP send buffer right now. QoS 1 is false if the window
+    // is full, otherwise the message is kept until its PUBACK and goes out as
+    // soon as there is room.
+    bool publish(const char* topic, const uint8_t* payload, size_t length, bool retained = false, uint8_t qos = 0);
+    bool publish(const char* topic, const char* payload, bool retained = false);
+
+    // Stream a message larger than the send buffer. write() waits for buffer
+    // space (up to the connect timeout), so this is for the blocking battery
+    // path, not for loop(). If write() comes back short, call endPublish():
+    // it fails, drops the connection the partial packet went out on and frees
+    // the message's QoS 1 slot, the caller still has the data to send again.
+    bool beginPublish(const char* topic, size_t length, bool retained, uint8_t qos = 0);
+    size_t write(const uint8_t* data, size_t length);
+    bool endPublish();
+
+    // Wait until everything sent was acknowledged by the broker's TCP stack
+    // and every QoS 1 message got its PUBACK
+    bool flush(uint32_t timeoutMs);
+};
+
+#endif // MQTT_CLIENT_H
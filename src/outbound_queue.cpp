@@ -0,0 +1,230 @@
+#include "outbound_queue.h"
+
+static_assert(MQTT_BATCH_MAX >= CHANNEL_COUNT, "a batch must hold one full log record");
+
+OutboundQueue::OutboundQueue() {
+    head = 0;
+    count = 0;
+    sampleLog = nullptr;
+    clock = nullptr;
+    spilled = false;
+    cursorOpen = false;
+    lastDrained = 0;
+    drainedAtLast = 0;
+    peekLast = 0;
+    peekAtLast = 0;
+    resumeSkip = 0;
+    sentCycle = 0;
+    sentMask = 0;
+    pushed = 0;
+    committed = 0;
+    dropped = 0;
+    spills = 0;
+    fromFlash = 0;
+}
+
+void OutboundQueue::begin(SampleLog* sampleLog, SampleClock* clock) {
+    this->sampleLog = sampleLog;
+    this->clock = clock;
+}
+
+void OutboundQueue::push(const QueuedSample& sample) {
+    pushed++;
+
+    // The log already has it, draining will get there
+    if (spilled) {
+        return;
+    }
+
+    if (count == MQTT_QUEUE_RAM) {
+        if (sampleLog && sampleLog->isReady()) {
+            // Long outage: drop the ring and resume from the log at its oldest sample
+            spilled = true;
+            spills++;
+            cursorOpen = false;
+            lastDrained = ring[head].logTimestamp;
+            drainedAtLast = 0;
+            resumeSkip = sentCycle == lastDrained ? sentMask : 0;
+            head = 0;
+            count = 0;
+            return;
+        }
+        head = (head + 1) % MQTT_QUEUE_RAM;
+        count--;
+        dropped++;
+    }
+
+    ring[(head + count) % MQTT_QUEUE_RAM] = sample;
+    count++;
+}
+
+uint16_t OutboundQueue::peek(QueuedSample* out, uint16_t max) {
+    if (spilled) {
+        uint16_t n = peekFlash(out, max);
+        if (spilled) {
+            return n;
+        }
+    }
+
+    uint16_t n = count < max ? count : max;
+    for (uint16_t i = 0; i < n; i++) {
+        out[i] = ring[(head + i) % MQTT_QUEUE_RAM];
+    }
+    return n;
+}
+
+void OutboundQueue::commit(uint16_t n) {
+    committed += n;
+    remove(n);
+}
+
+void OutboundQueue::drop(uint16_t n) {
+    dropped += n;
+    remove(n);
+}
+
+void OutboundQueue::remove(uint16_t n) {
+    if (spilled) {
+        cursor = peekCursor;
+        lastDrained = peekLast;
+        drainedAtLast = peekAtLast;
+        resumeSkip = 0;
+        fromFlash += n;
+        return;
+    }
+
+    if (n > count) {
+        n = count;
+    }
+    for (uint16_t i = 0; i < n; i++) {
+        const QueuedSample& sample = ring[head];
+        if (sample.logTimestamp != sentCycle) {
+            sentCycle = sample.logTimestamp;
+            sentMask = 0;
+        }
+        sentMask |= (uint16_t)(1u << sample.channel);
+        head = (head + 1) % MQTT_QUEUE_RAM;
+    }
+    count -= n;
+}
+
+bool OutboundQueue::openCursor() {
+    if (!sampleLog->beginQuery(lastDrained, LOG_ERASED - 1, cursor)) {
+        return false;
+    }
+
+    // Skip the records of that second that were already published
+    for (uint16_t i = 0; i < drainedAtLast; i++) {
+        LogCursor before = cursor;
+        LogRecord record;
+        if (!sampleLog->next(cursor, record)) {
+            break;
+        }
+        if (record.timestamp != lastDrained) {
+            cursor = before;
+            break;
+        }
+    }
+
+    cursorOpen = true;
+    return true;
+}
+
+uint16_t OutboundQueue::peekFlash(QueuedSample* out, uint16_t max) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (!cursorOpen && !openCursor()) {
+            break;
+        }
+
+        LogCursor position = cursor;
+        uint32_t last = lastDrained;
+        uint16_t atLast = drainedAtLast;
+        uint16_t n = 0;
+        LogRecord record;
+
+        for (;;) {
+            LogCursor before = position;
+            if (!sampleLog->next(position, record)) {
+                break;
+            }
+
+            // Channels of the cycle the spill resumes at that already went out from the ring
+            uint16_t mask = record.validMask;
+            if (record.timestamp == lastDrained && atLast == 0) {
+                mask &= ~resumeSkip;
+            }
+            uint8_t valid = 0;
+            for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                if (mask & (1u << ch)) {
+                    valid++;
+                }
+            }
+            // Whole records only, the rest goes in the next batch
+            if (n + valid > max) {
+                position = before;
+                break;
+            }
+
+            for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                if (mask & (1u << ch)) {
+                    out[n].epochMs = (uint64_t)record.timestamp * 1000;
+                    out[n].logTimestamp = record.timestamp;
+                    out[n].channel = ch;
+                    out[n].value = record.values[ch] / 100.0f;
+                    n++;
+                }
+            }
+            if (record.timestamp == last) {
+                atLast++;
+            } else {
+                last = record.timestamp;
+                atLast = 1;
+            }
+        }
+
+        if (n > 0) {
+            peekCursor = position;
+            peekLast = last;
+            peekAtLast = atLast;
+            return n;
+        }
+
+        // Caught up with what is on flash: write out finished cycles and look once more
+        cursorOpen = false;
+        if (attempt == 0) {
+            sampleLog->flushCompleted();
+        }
+    }
+
+    rejoin();
+    return 0;
+}
+
+void OutboundQueue::rejoin() {
+    // Log drained, new samples go to the ring again. Readings of the cycle
+    // still being sampled were skipped by push(), they are taken from the
+    // open log record; the rest of the cycle follows through push().
+    spilled = false;
+    cursorOpen = false;
+
+    LogRecord record;
+    uint32_t sampleMillis;
+    if (!sampleLog->getPending(record, sampleMillis)) {
+        return;
+    }
+    uint16_t mask = record.validMask;
+    if (record.timestamp == lastDrained && drainedAtLast == 0) {
+        mask &= ~resumeSkip;
+    }
+    uint64_t epochMs = clock ? clock->toEpochMs(sampleMillis) : (uint64_t)record.timestamp * 1000;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT && count < MQTT_QUEUE_RAM; ch++) {
+        if (mask & (1u << ch)) {
+            QueuedSample& sample = ring[(head + count) % MQTT_QUEUE_RAM];
+            sample.epochMs = epochMs;
+            sample.logTimestamp = record.timestamp;
+            sample.channel = ch;
+            sample.value = record.values[ch] / 100.0f;
+            count++;
+        }
+    }
+}
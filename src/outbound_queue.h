@@ -0,0 +1,87 @@
+#ifndef OUTBOUND_QUEUE_H
+#define OUTBOUND_QUEUE_H
+
+#include <stdint.h>
+#include "config.h"
+#include "sample_log.h"
+
+static_assert(CHANNEL_COUNT <= 16, "sentMask holds 16 channels");
+
+// One timestamped channel value waiting to be published
+struct QueuedSample {
+    uint64_t epochMs;
+    uint32_t logTimestamp;  // of the log record holding the same cycle, where a spill resumes
+    uint8_t channel;
+    float value;
+};
+
+// Store-and-forward queue for outbound samples. Short outages fit in a RAM
+// ring. When the ring overflows, the queue switches to the flash sample log,
+// which already holds every reading: the ring is dropped and draining
+// continues from the log, oldest first, until it is caught up. The cycle
+// still being sampled then moves back to the ring, it is not split on flash.
+// Samples are peeked, published and then committed, so a failed publish
+// loses nothing.
+class OutboundQueue {
+private:
+    QueuedSample ring[MQTT_QUEUE_RAM];
+    uint16_t head;          // oldest sample
+    uint16_t count;
+
+    SampleLog* sampleLog;
+    SampleClock* clock;
+    bool spilled;           // draining from the flash log
+    bool cursorOpen;
+    LogCursor cursor;
+    LogCursor peekCursor;   // cursor after the last peek, applied by commit()
+    uint32_t lastDrained;   // timestamp of the last committed log record
+    uint16_t drainedAtLast; // committed records with that timestamp
+    uint32_t peekLast;      // lastDrained and drainedAtLast after the last peek
+    uint16_t peekAtLast;
+    uint16_t resumeSkip;    // channels of the first record drained that the ring already sent
+    uint32_t sentCycle;     // log timestamp of the last sample committed from the ring
+    uint16_t sentMask;      // its channels committed so far, a batch can end mid-cycle
+
+    // Metrics
+    uint32_t pushed;
+    uint32_t committed;
+    uint32_t dropped;
+    uint32_t spills;
+    uint32_t fromFlash;
+
+    bool openCursor();
+    uint16_t peekFlash(QueuedSample* out, uint16_t max);
+    void rejoin();
+    void remove(uint16_t n);
+
+public:
+    OutboundQueue();
+
+    // sampleLog may be null, the ring then drops its oldest samples when full
+    void begin(SampleLog* sampleLog, SampleClock* clock);
+
+    void push(const QueuedSample& sample);
+
+    // Copies up to max of the oldest samples without removing them. From
+    // the log only whole records are returned, so max >= CHANNEL_COUNT.
+    uint16_t peek(QueuedSample* out, uint16_t max);
+    // Removes what the last peek returned
+    void commit(uint16_t n);
+    // Removes what the last peek returned without it being sent, e.g. a
+    // batch that cannot be encoded. Counted in getDropped().
+    void drop(uint16_t n);
+
+    // Samples waiting in RAM; a spilled queue also has a backlog on flash
+    uint16_t getDepth() const { return count; }
+    bool isSpilled() const { return spilled; }
+    bool hasBacklog() const { return spilled || count >= MQTT_BATCH_MAX; }
+    bool isEmpty() const { return !spilled && count == 0; }
+
+    uint32_t getPushed() const { return pushed; }
+    uint32_t getCommitted() const { return committed; }
+    uint32_t getDropped() const { return dropped; }
+    uint32_t getSpills() const { return spills; }
+    uint32_t getFromFlash() const { return fromFlash; }
+};
+
+#endif // OUTBOUND_QUEUE_H
@@ -0,0 +1,85 @@
+#include "payload_encoding.h"
+#include <math.h>
+#include "sensor_reading.h"
+
+// Worst case sample entry: },{"t":<ms>,"<channel>":<value>, plus the header
+static_assert(MQTT_BATCH_MAX * (CHANNEL_NAME_MAX + 42) + 64 <= MQTT_PAYLOAD_MAX,
+              "MQTT_PAYLOAD_MAX must hold a full sample batch");
+
+void encodeSamplesJson(TextBuffer& out, const QueuedSample* samples, uint16_t count, bool synced,
+                       uint32_t boot, uint32_t seq) {
+    out.clear();
+    out.appendf("{\"boot\":%lu,\"seq\":%lu,\"synced\":%s,\"samples\":[",
+                (unsigned long)boot, (unsigned long)seq, synced ? "true" : "false");
+    char channelName[CHANNEL_NAME_MAX];
+    for (uint16_t i = 0; i < count; i++) {
+        const QueuedSample& sample = samples[i];
+        if (i == 0 || sample.epochMs != samples[i - 1].epochMs) {
+            out.appendf("%s{\"t\":%llu", i ? "}," : "", (unsigned long long)sample.epochMs);
+        }
+        formatChannelName(sample.channel, channelName, sizeof(channelName));
+        out.appendf(",\"%s\":", channelName);
+        out.appendFloat(sample.value);
+    }
+    out.append(count ? "}]}" : "]}");
+}
+
+void encodeSamplesCbor(CborWriter& out, const QueuedSample* samples, uint16_t count, bool synced,
+                       uint32_t boot, uint32_t seq) {
+    uint16_t groups = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (i == 0 || samples[i].epochMs != samples[i - 1].epochMs) {
+            groups++;
+        }
+    }
+
+    out.beginMap(5);
+    out.writeString("v");
+    out.writeUint(MQTT_CBOR_SCHEMA);
+    out.writeString("b");
+    out.writeUint(boot);
+    out.writeString("n");
+    out.writeUint(seq);
+    out.writeString("s");
+    out.writeBool(synced);
+    out.writeString("r");
+    out.beginArray(groups);
+    for (uint16_t i = 0; i < count;) {
+        uint16_t end = i + 1;
+        while (end < count && samples[end].epochMs == samples[i].epochMs) {
+            end++;
+        }
+        out.beginArray(2);
+        out.writeUint(samples[i].epochMs);
+        out.beginMap(end - i);
+        for (; i < end; i++) {
+            out.writeUint(samples[i].channel);
+            out.writeInt(lroundf(samples[i].value * 100));
+        }
+    }
+}
+
+void encodeStateCbor(CborWriter& out, uint64_t sampleTime, const float* values, uint16_t mask) {
+    uint8_t channels = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (mask & (1u << ch)) {
+            channels++;
+        }
+    }
+
+    out.beginMap(sampleTime ? 3 : 2);
+    out.writeString("v");
+    out.writeUint(MQTT_CBOR_SCHEMA);
+    if (sampleTime) {
+        out.writeString("t");
+        out.writeUint(sampleTime);
+    }
+    out.writeString("c");
+    out.beginMap(channels);
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        if (mask & (1u << ch)) {
+            out.writeUint(ch);
+            out.writeInt(lroundf(values[ch] * 100));
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef PAYLOAD_ENCODING_H
+#define PAYLOAD_ENCODING_H
+
+#include <stdint.h>
+#include "config.h"
+#include "cbor.h"
+#include "text_buffer.h"
+#include "outbound_queue.h"
+
+static_assert(CHANNEL_COUNT <= 16, "encodeStateCbor() takes a 16 channel mask");
+
+// Encoders for <base>/samples and the CBOR <base>/state. Both encodings are
+// always built so the host tests can compare them; MQTT_ENCODING picks the
+// one that is published.
+
+// A batch carries the sender's boot id and its sequence number within that
+// boot. QoS 1 is at least once: a batch the broker got but whose PUBACK was
+// lost arrives again after a reconnect, byte for byte, so subscribers drop
+// repeats of (client id, boot, seq). Samples that survived a reboot in the
+// flash log go out again under the new boot; with "synced" true, (channel,
+// "t") identifies a sample across boots as well.
+
+// {"boot":id,"seq":n,"synced":b,"samples":[{"t":ms,"<channel>":value,...},...]},
+// samples of one cycle share a timestamp and are grouped into one object
+void encodeSamplesJson(TextBuffer& out, const QueuedSample* samples, uint16_t count, bool synced,
+                       uint32_t boot, uint32_t seq);
+
+// {"v":schema,"b":boot,"n":seq,"s":synced,"r":[[t,{channel:value*100,...}],...]},
+// grouped the same way
+void encodeSamplesCbor(CborWriter& out, const QueuedSample* samples, uint16_t count, bool synced,
+                       uint32_t boot, uint32_t seq);
+
+// {"v":schema,"t":ms,"c":{channel:value*100,...}} for the channels in mask.
+// "t" is the sample time, left out while it is unknown (0).
+void encodeStateCbor(CborWriter& out, uint64_t sampleTime, const float* values, uint16_t mask);
+
+#endif // PAYLOAD_ENCODING_H
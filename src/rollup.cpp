@@ -0,0 +1,243 @@
+#include "rollup.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Each day slot is an NVS blob: its data in 32-byte entries plus a header
+// and a blob index entry. All of them share the 16 KB the 20 KB nvs
+// partition can fill (one page stays free) with the WiFi and MQTT settings.
+constexpr size_t ROLLUP_SLOT_BYTES = CHANNEL_COUNT * sizeof(RollupBucket);
+static_assert(ROLLUP_DAY_SLOTS * ((ROLLUP_SLOT_BYTES + 31) / 32 + 2) * 32 <= 8192,
+              "persisted day rollups too large for the nvs partition");
+
+RollupStore::RollupStore() {
+    tiers[ROLLUP_MINUTE].seconds = 60;
+    tiers[ROLLUP_MINUTE].capacity = ROLLUP_MINUTE_SLOTS;
+    tiers[ROLLUP_MINUTE].slots = minuteSlots;
+    tiers[ROLLUP_HOUR].seconds = 3600;
+    tiers[ROLLUP_HOUR].capacity = ROLLUP_HOUR_SLOTS;
+    tiers[ROLLUP_HOUR].slots = hourSlots;
+    tiers[ROLLUP_DAY].seconds = 86400;
+    tiers[ROLLUP_DAY].capacity = ROLLUP_DAY_SLOTS;
+    tiers[ROLLUP_DAY].slots = daySlots;
+
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        tiers[t].head = 0;
+        tiers[t].count = 0;
+        tiers[t].windowStart = 0;
+        tiers[t].closedCount = 0;
+        tiers[t].started = false;
+        tiers[t].persisted = t == ROLLUP_DAY;
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            resetBucket(tiers[t].current[ch]);
+        }
+    }
+}
+
+void RollupStore::begin() {
+    Preferences preferences;
+    if (!preferences.begin("rollup", true)) {
+        return; // nothing saved yet
+    }
+
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        Tier& tier = tiers[t];
+        if (!tier.persisted) {
+            continue;
+        }
+
+        char key[16];
+        snprintf(key, sizeof(key), "%s_at", tierName(t));
+        SavedTier saved;
+        if (preferences.getBytes(key, &saved, sizeof(saved)) != sizeof(saved) ||
+            saved.seconds != tier.seconds || saved.capacity != tier.capacity || saved.channels != CHANNEL_COUNT ||
+            saved.head >= tier.capacity || saved.count > tier.capacity) {
+            continue;
+        }
+
+        // The open window was not saved, it continues empty
+        tier.head = saved.head;
+        tier.count = saved.count;
+        tier.windowStart = saved.windowStart;
+        tier.started = true;
+
+        // A slot that is missing or the wrong size reads as an empty window
+        for (uint16_t i = 0; i < tier.count; i++) {
+            uint16_t slot = (tier.head + tier.capacity - tier.count + i) % tier.capacity;
+            RollupBucket buckets[CHANNEL_COUNT];
+            snprintf(key, sizeof(key), "%s%u", tierName(t), slot);
+            if (preferences.getBytesLength(key) != sizeof(buckets) ||
+                preferences.getBytes(key, buckets, sizeof(buckets)) != sizeof(buckets)) {
+                for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                    resetBucket(buckets[ch]);
+                }
+            }
+            for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                tier.slots[ch * tier.capacity + slot] = buckets[ch];
+            }
+        }
+
+        Serial.print("[ROLLUP] Restored ");
+        Serial.print(tier.count);
+        Serial.print(" ");
+        Serial.print(tierName(t));
+        Serial.println(" windows");
+    }
+    preferences.end();
+}
+
+void RollupStore::save(uint8_t t, uint32_t closed) {
+    const Tier& tier = tiers[t];
+    SavedTier saved;
+    saved.seconds = tier.seconds;
+    saved.capacity = tier.capacity;
+    saved.channels = CHANNEL_COUNT;
+    saved.reserved = 0;
+    saved.head = tier.head;
+    saved.count = tier.count;
+    saved.windowStart = tier.windowStart;
+
+    Preferences preferences;
+    if (!preferences.begin("rollup", false)) {
+        Serial.println("[ROLLUP] NVS not available, rollups not saved");
+        return;
+    }
+    // Slots first: a reset between the writes leaves the previous ring
+    // position, which at worst shows the newest window in place of the oldest
+    char key[16];
+    for (uint32_t n = closed; n > 0; n--) {
+        uint16_t slot = (tier.head + tier.capacity - n) % tier.capacity;
+        RollupBucket buckets[CHANNEL_COUNT];
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            buckets[ch] = tier.slots[ch * tier.capacity + slot];
+        }
+        snprintf(key, sizeof(key), "%s%u", tierName(t), slot);
+        preferences.putBytes(key, buckets, sizeof(buckets));
+    }
+    snprintf(key, sizeof(key), "%s_at", tierName(t));
+    preferences.putBytes(key, &saved, sizeof(saved));
+    preferences.end();
+}
+
+void RollupStore::resetBucket(RollupBucket& bucket) {
+    bucket.sum = 0;
+    bucket.min = INT16_MAX;
+    bucket.max = INT16_MIN;
+    bucket.last = 0;
+    bucket.count = 0;
+}
+
+void RollupStore::restart(Tier& tier, uint32_t timestamp) {
+    tier.head = 0;
+    tier.count = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        resetBucket(tier.current[ch]);
+    }
+    tier.windowStart = timestamp - timestamp % tier.seconds;
+    tier.started = true;
+}
+
+void RollupStore::advance(uint32_t timestamp) {
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        Tier& tier = tiers[t];
+
+        if (!tier.started) {
+            restart(tier, timestamp);
+            continue;
+        }
+
+        if (timestamp < tier.windowStart + tier.seconds) {
+            continue;
+        }
+        uint32_t elapsed = (timestamp - tier.windowStart) / tier.seconds;
+        tier.closedCount += elapsed;
+
+        // Gap longer than the ring, everything kept would be empty windows
+        if (elapsed > tier.capacity) {
+            restart(tier, timestamp);
+            if (tier.persisted) {
+                save(t, 0);
+            }
+            continue;
+        }
+
+        // Close the open window and any empty ones after it
+        for (uint32_t n = 0; n < elapsed; n++) {
+            for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                tier.slots[ch * tier.capacity + tier.head] = tier.current[ch];
+                resetBucket(tier.current[ch]);
+            }
+            if (++tier.head == tier.capacity) {
+                tier.head = 0;
+            }
+            if (tier.count < tier.capacity) {
+                tier.count++;
+            }
+        }
+        tier.windowStart += elapsed * tier.seconds;
+        if (tier.persisted) {
+            save(t, elapsed);
+        }
+    }
+}
+
+void RollupStore::add(const SensorReading& reading, uint32_t timestamp) {
+    if (reading.channel >= CHANNEL_COUNT) {
+        return;
+    }
+
+    advance(timestamp);
+
+    if (!reading.valid) {
+        return;
+    }
+
+    float scaled = roundf(reading.value * 100.0f);
+    if (scaled > INT16_MAX) scaled = INT16_MAX;
+    if (scaled < INT16_MIN) scaled = INT16_MIN;
+    int16_t value = (int16_t)scaled;
+
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        RollupBucket& bucket = tiers[t].current[reading.channel];
+        if (value < bucket.min) bucket.min = value;
+        if (value > bucket.max) bucket.max = value;
+        bucket.sum += value;
+        bucket.last = value;
+        if (bucket.count < UINT16_MAX) {
+            bucket.count++;
+        }
+    }
+}
+
+bool RollupStore::getBucket(uint8_t tier, uint8_t channel, uint16_t index, RollupBucket& bucket) const {
+    if (tier >= ROLLUP_TIER_COUNT || channel >= CHANNEL_COUNT || index >= tiers[tier].count) {
+        return false;
+    }
+
+    const Tier& t = tiers[tier];
+    uint16_t slot = (t.head + t.capacity - t.count + index) % t.capacity;
+    bucket = t.slots[channel * t.capacity + slot];
+    return true;
+}
+
+uint32_t RollupStore::getBucketStart(uint8_t tier, uint16_t index) const {
+    const Tier& t = tiers[tier];
+    return t.windowStart - (uint32_t)(t.count - index) * t.seconds;
+}
+
+const char* RollupStore::tierName(uint8_t tier) {
+    switch (tier) {
+        case ROLLUP_MINUTE: return "minute";
+        case ROLLUP_HOUR:   return "hour";
+        case ROLLUP_DAY:    return "day";
+        default:            return "unknown";
+    }
+}
+
+int RollupStore::parseTier(const char* name) {
+    for (uint8_t t = 0; t < ROLLUP_TIER_COUNT; t++) {
+        if (strcmp(name, tierName(t)) == 0) {
+            return t;
+        }
+    }
+    return -1;
+}
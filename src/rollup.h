@@ -0,0 +1,89 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <stdint.h>
+#include "config.h"
+#include "sensor_reading.h"
+
+enum RollupTier : uint8_t {
+    ROLLUP_MINUTE = 0,
+    ROLLUP_HOUR,
+    ROLLUP_DAY,
+    ROLLUP_TIER_COUNT
+};
+
+// Aggregate of one window, values in hundredths like the history
+struct RollupBucket {
+    int32_t sum;
+    int16_t min;
+    int16_t max;
+    int16_t last;
+    uint16_t count; // 0 = no valid sample in the window
+};
+
+// Minute, hour and day aggregates updated incrementally from every reading.
+// All channels of a tier share window boundaries, so each tier closes every
+// channel's window at once and keeps them in one fixed-size ring. Each day
+// window is written to NVS once, when it closes, under its own ring slot key.
+class RollupStore {
+private:
+    struct Tier {
+        uint32_t seconds;     // window length
+        uint16_t capacity;    // closed windows kept
+        uint16_t head;        // next ring slot
+        uint16_t count;
+        uint32_t windowStart; // start of the open window
+        uint32_t closedCount; // windows closed since boot
+        bool started;         // windowStart is set
+        bool persisted;       // saved to NVS
+        RollupBucket* slots;  // [CHANNEL_COUNT][capacity]
+        RollupBucket current[CHANNEL_COUNT];
+    };
+
+    // Ring position saved next to the slots, the layout fields reject a
+    // blob written by a build with other sizes
+    struct SavedTier {
+        uint32_t seconds;
+        uint16_t capacity;
+        uint8_t channels;
+        uint8_t reserved;
+        uint16_t head;
+        uint16_t count;
+        uint32_t windowStart;
+    };
+
+    Tier tiers[ROLLUP_TIER_COUNT];
+
+    RollupBucket minuteSlots[CHANNEL_COUNT * ROLLUP_MINUTE_SLOTS];
+    RollupBucket hourSlots[CHANNEL_COUNT * ROLLUP_HOUR_SLOTS];
+    RollupBucket daySlots[CHANNEL_COUNT * ROLLUP_DAY_SLOTS];
+
+    void advance(uint32_t timestamp);
+    void restart(Tier& tier, uint32_t timestamp);
+    // Writes the 'closed' slots before head and the ring position
+    void save(uint8_t tier, uint32_t closed);
+    static void resetBucket(RollupBucket& bucket);
+
+public:
+    RollupStore();
+
+    // Restores the day ring saved by the previous boot
+    void begin();
+
+    // timestamp is seconds on the sample log clock
+    void add(const SensorReading& reading, uint32_t timestamp);
+
+    // Closed windows, index 0 = oldest. Returns false if out of range.
+    bool getBucket(uint8_t tier, uint8_t channel, uint16_t index, RollupBucket& bucket) const;
+    uint16_t getCount(uint8_t tier) const { return tiers[tier].count; }
+    uint32_t getWindowSeconds(uint8_t tier) const { return tiers[tier].seconds; }
+    // Start time of the bucket at 'index'
+    uint32_t getBucketStart(uint8_t tier, uint16_t index) const;
+    // Increments every time a window of the tier closes
+    uint32_t getClosedCount(uint8_t tier) const { return tiers[tier].closedCount; }
+
+    static const char* tierName(uint8_t tier);
+    static int parseTier(const char* name); // -1 if unknown
+};
+
+#endif // ROLLUP_H
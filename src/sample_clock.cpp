@@ -0,0 +1,115 @@
+#include "sample_clock.h"
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <esp_sntp.h>
+#include <freertos/FreeRTOS.h>
+#include <sys/time.h>
+#include <time.h>
+
+// Drift estimates beyond this are treated as clock steps, not crystal error
+constexpr float CLOCK_MAX_DRIFT = 500e-6f;
+// Wall clock counts as set once it is past 2020-01-01
+constexpr time_t CLOCK_WALL_VALID = 1577836800;
+
+bool SampleClock::syncPending = false;
+int64_t SampleClock::syncEpochMs = 0;
+int64_t SampleClock::syncAtMonoMs = 0;
+static portMUX_TYPE syncMux = portMUX_INITIALIZER_UNLOCKED;
+
+SampleClock::SampleClock() {
+    synced = false;
+    offsetMs = 0;
+    syncMonoMs = 0;
+    drift = 0;
+    syncCount = 0;
+    fallbackBase = 0;
+    lastReturnedMs = 0;
+}
+
+void SampleClock::begin() {
+    // System time survives software resets and deep sleep, use it until SNTP confirms
+    time_t wall = time(nullptr);
+    if (wall > CLOCK_WALL_VALID) {
+        offsetMs = (int64_t)wall * 1000 - monotonicMs();
+        syncMonoMs = monotonicMs();
+        synced = true;
+    }
+
+    sntp_set_time_sync_notification_cb(onTimeSync);
+    configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2);
+
+    Serial.print("[CLOCK] SNTP started (");
+    Serial.print(NTP_SERVER_1);
+    Serial.println(")");
+}
+
+void SampleClock::onTimeSync(struct timeval* tv) {
+    int64_t epochMs = (int64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000;
+    int64_t mono = monotonicMs();
+    portENTER_CRITICAL(&syncMux);
+    syncEpochMs = epochMs;
+    syncAtMonoMs = mono;
+    syncPending = true;
+    portEXIT_CRITICAL(&syncMux);
+}
+
+void SampleClock::update() {
+    portENTER_CRITICAL(&syncMux);
+    bool pending = syncPending;
+    int64_t epochMs = syncEpochMs;
+    int64_t mono = syncAtMonoMs;
+    syncPending = false;
+    portEXIT_CRITICAL(&syncMux);
+    if (!pending) {
+        return;
+    }
+
+    int64_t newOffset = epochMs - mono;
+
+    // Drift from how far the previous SNTP anchor had moved by this sync
+    if (syncCount > 0 && mono > syncMonoMs) {
+        float measured = (float)(newOffset - offsetMs) / (float)(mono - syncMonoMs);
+        if (measured > -CLOCK_MAX_DRIFT && measured < CLOCK_MAX_DRIFT) {
+            drift = measured;
+        }
+    }
+
+    offsetMs = newOffset;
+    syncMonoMs = mono;
+    synced = true;
+    syncCount++;
+
+    Serial.print("[CLOCK] SNTP sync ");
+    Serial.print(syncCount);
+    Serial.print(", drift ");
+    Serial.print(getDriftPpm());
+    Serial.println(" ppm");
+}
+
+int64_t SampleClock::monotonicMs() {
+    return esp_timer_get_time() / 1000;
+}
+
+uint64_t SampleClock::nowMs() {
+    int64_t mono = monotonicMs();
+    uint64_t result;
+
+    if (synced) {
+        result = (uint64_t)(mono + offsetMs + (int64_t)(drift * (float)(mono - syncMonoMs)));
+    } else {
+        result = (uint64_t)fallbackBase * 1000 + (uint64_t)mono;
+    }
+
+    // A sync that moves the clock back holds it until real time catches up
+    if (result < lastReturnedMs) {
+        result = lastReturnedMs;
+    }
+    lastReturnedMs = result;
+    return result;
+}
+
+uint64_t SampleClock::toEpochMs(uint32_t millisStamp) {
+    // Unsigned subtraction gives the right age across the millis() wrap
+    uint32_t ageMs = millis() - millisStamp;
+    return nowMs() - ageMs;
+}
@@ -0,0 +1,54 @@
+#ifndef SAMPLE_CLOCK_H
+#define SAMPLE_CLOCK_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Epoch time for sample timestamps. Runs on the 64-bit esp_timer, so it
+// never wraps and never steps backwards. Each SNTP sync re-anchors it
+// and updates a drift estimate, which keeps it on time while the network
+// is down.
+class SampleClock {
+private:
+    bool synced;
+    int64_t offsetMs;       // epoch ms minus monotonic ms at the last sync
+    int64_t syncMonoMs;     // monotonic ms of the last sync
+    float drift;            // epoch ms gained per monotonic ms, from the last two syncs
+    uint32_t syncCount;
+    uint32_t fallbackBase;  // epoch-like seconds at boot while never synced
+    uint64_t lastReturnedMs;
+
+    // Set from the SNTP callback (lwIP task), consumed by update(), both
+    // under syncMux so a sync can't land between the two 64-bit reads
+    static bool syncPending;
+    static int64_t syncEpochMs;
+    static int64_t syncAtMonoMs;
+    static void onTimeSync(struct timeval* tv);
+
+public:
+    SampleClock();
+
+    // Starts SNTP, syncs happen in the background once WiFi is up
+    void begin();
+    // Applies a completed sync, call from loop()
+    void update();
+
+    // Continue from here while never synced (e.g. the log's last timestamp)
+    void setFallbackBase(uint32_t seconds) { fallbackBase = seconds; }
+
+    bool isSynced() const { return synced; }
+    uint32_t getSyncCount() const { return syncCount; }
+    float getDriftPpm() const { return drift * 1e6f; }
+
+    // Current time in epoch ms, or fallback-based ms while never synced
+    uint64_t nowMs();
+    uint32_t now() { return (uint32_t)(nowMs() / 1000); }
+
+    // Converts a millis() sample stamp, correct across the 49-day millis() wrap
+    uint64_t toEpochMs(uint32_t millisStamp);
+
+    // Monotonic milliseconds since boot, 64-bit
+    static int64_t monotonicMs();
+};
+
+#endif // SAMPLE_CLOCK_H
@@ -0,0 +1,389 @@
+#include "sample_log.h"
+
+SampleLog::SampleLog() {
+    partition = nullptr;
+    clock = nullptr;
+    mutex = nullptr;
+    segmentCount = 0;
+    headSegment = 0;
+    headSequence = 0;
+    headSlots = 0;
+    hasData = false;
+    pageCount = 0;
+    pendingMillis = 0;
+    pendingActive = false;
+    lastTimestamp = 0;
+    recordsWritten = 0;
+    replayActive = false;
+    replayPeeked = false;
+    replayRequested = false;
+    replayFrom = 0;
+    replayTo = 0;
+    for (uint16_t i = 0; i < LOG_MAX_SEGMENTS; i++) {
+        segmentFirst[i] = LOG_ERASED;
+    }
+}
+
+bool SampleLog::begin(SampleClock* clock) {
+    this->clock = clock;
+    partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                         (esp_partition_subtype_t)LOG_PARTITION_SUBTYPE,
+                                         LOG_PARTITION_LABEL);
+    if (partition == nullptr) {
+        Serial.println("Warning: samplelog partition not found, flash log disabled");
+        return false;
+    }
+
+    mutex = xSemaphoreCreateMutex();
+    segmentCount = partition->size / LOG_SEGMENT_SIZE;
+    if (segmentCount > LOG_MAX_SEGMENTS) {
+        segmentCount = LOG_MAX_SEGMENTS;
+    }
+
+    // Rebuild the index from segment headers only, newest sequence is the head
+    for (uint16_t i = 0; i < segmentCount; i++) {
+        SegmentHeader header;
+        esp_partition_read(partition, segmentOffset(i), &header, sizeof(header));
+        if (header.magic != LOG_SEGMENT_MAGIC) {
+            continue;
+        }
+        segmentFirst[i] = header.firstTimestamp;
+        if (!hasData || header.sequence > headSequence) {
+            headSegment = i;
+            headSequence = header.sequence;
+            hasData = true;
+        }
+    }
+
+    if (hasData) {
+        // Records are written in order, binary search the first erased slot
+        uint16_t low = 0;
+        uint16_t high = LOG_RECORDS_PER_SEGMENT;
+        while (low < high) {
+            uint16_t mid = (low + high) / 2;
+            if (readTimestamp(headSegment, mid) == LOG_ERASED) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        headSlots = low;
+        lastTimestamp = headSlots > 0 ? readTimestamp(headSegment, headSlots - 1) : segmentFirst[headSegment];
+
+        // Until SNTP syncs, continue the clock where the previous boot stopped
+        clock->setFallbackBase(lastTimestamp + 1);
+    }
+
+    Serial.println("=== Sample Log Initialized ===");
+    Serial.print("Segments: ");
+    Serial.print(usedSegments());
+    Serial.print("/");
+    Serial.println(segmentCount);
+    Serial.print("Capacity: ");
+    Serial.print(getCapacityRecords());
+    Serial.println(" records");
+    Serial.print("Last timestamp: ");
+    Serial.println(lastTimestamp);
+    Serial.println("==============================");
+    return true;
+}
+
+uint32_t SampleLog::now() {
+    return clock->now();
+}
+
+void SampleLog::append(const SensorReading& reading) {
+    if (partition == nullptr || reading.channel >= CHANNEL_COUNT) {
+        return;
+    }
+
+    // All readings of one sampling cycle share a timestamp
+    if (pendingActive && reading.timestamp != pendingMillis) {
+        commitPending();
+    }
+    if (!pendingActive) {
+        memset(&pending, 0, sizeof(pending));
+        pending.timestamp = now() - (millis() - reading.timestamp) / 1000;
+        if (pending.timestamp < lastTimestamp) {
+            pending.timestamp = lastTimestamp; // keep records ordered if the wall clock steps back
+        }
+        pendingMillis = reading.timestamp;
+        pendingActive = true;
+    }
+
+    if (reading.valid) {
+        float scaled = roundf(reading.value * 100.0f);
+        if (scaled > INT16_MAX) scaled = INT16_MAX;
+        if (scaled < INT16_MIN) scaled = INT16_MIN;
+        pending.values[reading.channel] = (int16_t)scaled;
+        pending.validMask |= (uint16_t)(1u << reading.channel);
+    }
+}
+
+void SampleLog::commitPending() {
+    pendingActive = false;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    page[pageCount++] = pending;
+    lastTimestamp = pending.timestamp;
+    xSemaphoreGive(mutex);
+
+    // Written once the rest of the current flash page is filled
+    if (pageCount == LOG_BATCH_RECORDS - headSlots % LOG_BATCH_RECORDS) {
+        flushPage();
+    }
+}
+
+void SampleLog::flush() {
+    if (partition == nullptr) {
+        return;
+    }
+    if (pendingActive) {
+        commitPending();
+    }
+    if (pageCount > 0) {
+        flushPage();
+    }
+}
+
+void SampleLog::flushCompleted() {
+    if (partition != nullptr && pageCount > 0) {
+        flushPage();
+    }
+}
+
+bool SampleLog::getPending(LogRecord& record, uint32_t& sampleMillis) const {
+    if (!pendingActive) {
+        return false;
+    }
+    record = pending;
+    sampleMillis = pendingMillis;
+    return true;
+}
+
+void SampleLog::flushPage() {
+    while (pageCount > 0) {
+        if (!hasData || headSlots >= LOG_RECORDS_PER_SEGMENT) {
+            openSegment(page[0].timestamp);
+        }
+
+        // Up to the end of the flash page, never across it
+        uint16_t count = pageCount;
+        uint16_t pageRoom = LOG_BATCH_RECORDS - headSlots % LOG_BATCH_RECORDS;
+        if (count > pageRoom) {
+            count = pageRoom;
+        }
+
+        // page[i] is always slot headSlots + i of the head segment for readers
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        esp_partition_write(partition, slotOffset(headSegment, headSlots), page, count * sizeof(LogRecord));
+        headSlots += count;
+        pageCount -= count;
+        memmove(page, page + count, pageCount * sizeof(LogRecord));
+        recordsWritten += count;
+        xSemaphoreGive(mutex);
+    }
+}
+
+void SampleLog::openSegment(uint32_t firstTimestamp) {
+    // Advance the ring, the erased segment held the oldest data
+    uint16_t next = hasData ? (headSegment + 1) % segmentCount : headSegment;
+
+    // Drop it from the index first so new queries skip it. The erase takes
+    // tens of ms and runs without the mutex, readers keep going meanwhile; a
+    // query already inside this segment sees erased slots and moves on.
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    segmentFirst[next] = LOG_ERASED;
+    xSemaphoreGive(mutex);
+
+    esp_partition_erase_range(partition, segmentOffset(next), LOG_SEGMENT_SIZE);
+
+    SegmentHeader header;
+    header.magic = LOG_SEGMENT_MAGIC;
+    header.sequence = hasData ? headSequence + 1 : 0;
+    header.firstTimestamp = firstTimestamp;
+    header.reserved = LOG_ERASED;
+    esp_partition_write(partition, segmentOffset(next), &header, sizeof(header));
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    segmentFirst[next] = firstTimestamp;
+    headSegment = next;
+    headSequence = header.sequence;
+    headSlots = 0;
+    hasData = true;
+    xSemaphoreGive(mutex);
+}
+
+uint32_t SampleLog::readTimestamp(uint16_t segment, uint16_t slot) const {
+    uint32_t timestamp = LOG_ERASED;
+    esp_partition_read(partition, slotOffset(segment, slot), &timestamp, sizeof(timestamp));
+    return timestamp;
+}
+
+bool SampleLog::readRecord(uint16_t segment, uint16_t slot, LogRecord& record) const {
+    // Records past the flushed end of the head segment are still in the page buffer
+    if (segment == headSegment && slot >= headSlots) {
+        uint16_t index = slot - headSlots;
+        if (index >= pageCount) {
+            return false;
+        }
+        record = page[index];
+        return true;
+    }
+    if (slot >= LOG_RECORDS_PER_SEGMENT) {
+        return false;
+    }
+    esp_partition_read(partition, slotOffset(segment, slot), &record, sizeof(record));
+    return record.timestamp != LOG_ERASED;
+}
+
+uint16_t SampleLog::oldestSegment() const {
+    for (uint16_t i = 1; i <= segmentCount; i++) {
+        uint16_t segment = (headSegment + i) % segmentCount;
+        if (segmentFirst[segment] != LOG_ERASED) {
+            return segment;
+        }
+    }
+    return headSegment;
+}
+
+uint16_t SampleLog::usedSegments() const {
+    uint16_t used = 0;
+    for (uint16_t i = 0; i < segmentCount; i++) {
+        if (segmentFirst[i] != LOG_ERASED) {
+            used++;
+        }
+    }
+    return used;
+}
+
+bool SampleLog::beginQuery(uint32_t from, uint32_t to, LogCursor& cursor) {
+    if (partition == nullptr) {
+        return false;
+    }
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    if (!hasData && pageCount == 0) {
+        xSemaphoreGive(mutex);
+        return false;
+    }
+
+    // Binary search the segments (oldest to newest) for the last one starting at or before 'from'
+    uint16_t oldest = oldestSegment();
+    uint16_t used = hasData ? usedSegments() : 1;
+    uint16_t low = 0;
+    uint16_t high = used;
+    while (low + 1 < high) {
+        uint16_t mid = (low + high) / 2;
+        if (segmentFirst[(oldest + mid) % segmentCount] <= from) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    uint16_t segment = (oldest + low) % segmentCount;
+
+    // Binary search the flushed slots of that segment, next() skips the rest
+    uint16_t slotLow = 0;
+    uint16_t slotHigh = (segment == headSegment) ? headSlots : LOG_RECORDS_PER_SEGMENT;
+    while (slotLow < slotHigh) {
+        uint16_t mid = (slotLow + slotHigh) / 2;
+        if (readTimestamp(segment, mid) < from) {
+            slotLow = mid + 1;
+        } else {
+            slotHigh = mid;
+        }
+    }
+
+    cursor.segment = segment;
+    cursor.slot = slotLow;
+    cursor.segmentsLeft = used - low;
+    cursor.from = from;
+    cursor.to = to;
+
+    xSemaphoreGive(mutex);
+    return true;
+}
+
+bool SampleLog::next(LogCursor& cursor, LogRecord& record) {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    while (cursor.segmentsLeft > 0) {
+        if (!readRecord(cursor.segment, cursor.slot, record)) {
+            // End of this segment, the head segment is the end of the log
+            if (cursor.segment == headSegment) {
+                cursor.segmentsLeft = 0;
+                break;
+            }
+            cursor.segment = (cursor.segment + 1) % segmentCount;
+            cursor.slot = 0;
+            cursor.segmentsLeft--;
+            continue;
+        }
+
+        cursor.slot++;
+        if (record.timestamp < cursor.from) {
+            continue;
+        }
+        if (record.timestamp > cursor.to) {
+            cursor.segmentsLeft = 0;
+            break;
+        }
+
+        xSemaphoreGive(mutex);
+        return true;
+    }
+
+    xSemaphoreGive(mutex);
+    return false;
+}
+
+bool SampleLog::startReplay(uint32_t from, uint32_t to) {
+    if (partition == nullptr) {
+        return false;
+    }
+
+    // Runs on the web server task, the cursor belongs to the loop task
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    bool empty = !hasData && pageCount == 0;
+    if (!empty) {
+        replayFrom = from;
+        replayTo = to;
+    }
+    xSemaphoreGive(mutex);
+
+    if (empty) {
+        return false;
+    }
+    replayRequested = true;
+    return true;
+}
+
+bool SampleLog::peekReplay(LogRecord& record) {
+    if (replayRequested.exchange(false)) {
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        uint32_t from = replayFrom;
+        uint32_t to = replayTo;
+        xSemaphoreGive(mutex);
+        replayActive = beginQuery(from, to, replayCursor);
+    }
+    replayPeeked = false;
+    if (!replayActive) {
+        return false;
+    }
+    replayNext = replayCursor;
+    if (!next(replayNext, record)) {
+        replayActive = false;
+        return false;
+    }
+    replayPeeked = true;
+    return true;
+}
+
+void SampleLog::advanceReplay() {
+    if (replayPeeked) {
+        replayCursor = replayNext;
+        replayPeeked = false;
+    }
+}
@@ -0,0 +1,140 @@
+#ifndef SAMPLE_LOG_H
+#define SAMPLE_LOG_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <freertos/semphr.h>
+#include <atomic>
+#include "config.h"
+#include "sensor_reading.h"
+#include "sample_clock.h"
+
+// One sampling cycle, all channels. Timestamps are seconds on the log clock.
+struct LogRecord {
+    uint32_t timestamp;              // LOG_ERASED for an unwritten slot
+    uint16_t validMask;              // bit per channel
+    int16_t values[CHANNEL_COUNT];   // value * 100
+};
+
+constexpr uint32_t LOG_ERASED = 0xFFFFFFFF;
+constexpr uint32_t LOG_SEGMENT_SIZE = 4096; // one flash sector, erased as a unit
+constexpr uint32_t LOG_SEGMENT_MAGIC = 0x504C4732; // "PLG2", page-aligned layout
+// Every flash page starts with this many bytes, the segment header in the
+// first page and unused in the others, so records never straddle a page and
+// a full batch is exactly one page program.
+constexpr uint32_t LOG_HEADER_SIZE = 16;
+constexpr uint16_t LOG_BATCH_RECORDS = (LOG_PAGE_SIZE - LOG_HEADER_SIZE) / sizeof(LogRecord); // records per page
+constexpr uint16_t LOG_RECORDS_PER_SEGMENT = LOG_SEGMENT_SIZE / LOG_PAGE_SIZE * LOG_BATCH_RECORDS;
+
+static_assert(CHANNEL_COUNT <= 16, "validMask holds 16 channels");
+static_assert(LOG_SEGMENT_SIZE % LOG_PAGE_SIZE == 0, "LOG_PAGE_SIZE must divide the segment");
+static_assert(LOG_BATCH_RECORDS > 0, "LOG_PAGE_SIZE smaller than one record");
+
+// Read position for a time-range query
+struct LogCursor {
+    uint16_t segment;       // physical segment index
+    uint16_t slot;          // record slot in the segment
+    uint16_t segmentsLeft;  // segments not yet visited, including the current one
+    uint32_t from;          // first timestamp to return
+    uint32_t to;            // last timestamp to return
+};
+
+// Append-only ring of flash segments in the "samplelog" partition.
+// Records are batched in RAM and written one flash page at a time, a flush
+// of a partial batch writes within the page and the next write completes it;
+// at boot only the
+// segment headers and a binary search of the newest segment are read.
+class SampleLog {
+private:
+    struct SegmentHeader {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t firstTimestamp;
+        uint32_t reserved;
+    };
+
+    const esp_partition_t* partition;
+    SampleClock* clock;
+    SemaphoreHandle_t mutex;
+    uint16_t segmentCount;
+
+    // RAM index: first timestamp per segment (LOG_ERASED if empty)
+    uint32_t segmentFirst[LOG_MAX_SEGMENTS];
+    uint16_t headSegment;   // segment currently appended to
+    uint32_t headSequence;
+    uint16_t headSlots;     // records flushed to the head segment
+    bool hasData;
+
+    // Write batching
+    LogRecord page[LOG_BATCH_RECORDS];
+    uint16_t pageCount;
+    LogRecord pending;      // frame being assembled from one sampling cycle
+    uint32_t pendingMillis;
+    bool pendingActive;
+
+    uint32_t lastTimestamp;
+    uint32_t recordsWritten;
+
+    // Replay state for MQTT, owned by the loop task. Requests from other
+    // tasks set replayFrom/replayTo under the mutex, then replayRequested.
+    LogCursor replayCursor;
+    LogCursor replayNext;   // past the record peekReplay() returned
+    bool replayActive;
+    bool replayPeeked;
+    std::atomic<bool> replayRequested;
+    uint32_t replayFrom;
+    uint32_t replayTo;
+
+    uint32_t segmentOffset(uint16_t segment) const { return (uint32_t)segment * LOG_SEGMENT_SIZE; }
+    uint32_t slotOffset(uint16_t segment, uint16_t slot) const {
+        return segmentOffset(segment) + (uint32_t)(slot / LOG_BATCH_RECORDS) * LOG_PAGE_SIZE
+               + LOG_HEADER_SIZE + (uint32_t)(slot % LOG_BATCH_RECORDS) * sizeof(LogRecord);
+    }
+    uint32_t readTimestamp(uint16_t segment, uint16_t slot) const;
+    bool readRecord(uint16_t segment, uint16_t slot, LogRecord& record) const;
+    uint16_t oldestSegment() const;
+    uint16_t usedSegments() const;
+    void commitPending();
+    void flushPage();
+    void openSegment(uint32_t firstTimestamp);
+
+public:
+    SampleLog();
+
+    bool begin(SampleClock* clock);
+    bool isReady() const { return partition != nullptr; }
+
+    // Feed every reading, frames are cut when the sample timestamp changes
+    void append(const SensorReading& reading);
+    // Write buffered records now (e.g. before a restart)
+    void flush();
+    // Same, but the cycle still being sampled stays open so its later
+    // readings don't end up in a second record
+    void flushCompleted();
+    // Record of the cycle still being sampled, not yet readable with next().
+    // Its timestamp is final. False between cycles.
+    bool getPending(LogRecord& record, uint32_t& sampleMillis) const;
+
+    // Position cursor at the first record with timestamp >= from
+    bool beginQuery(uint32_t from, uint32_t to, LogCursor& cursor);
+    bool next(LogCursor& cursor, LogRecord& record);
+
+    // Replay a time range to MQTT, consumed by MQTTManager::loop(). Any task
+    // may request a replay, it starts on the next peekReplay() call. False if
+    // the log is empty.
+    bool startReplay(uint32_t from, uint32_t to);
+    // Next record of the replay, returned again until advanceReplay() is
+    // called once it was published. False when the replay is over.
+    bool peekReplay(LogRecord& record);
+    void advanceReplay();
+    bool isReplayActive() const { return replayActive || replayRequested; }
+
+    // Log clock in seconds: SNTP time once synced, else continues from the last boot
+    uint32_t now();
+
+    uint32_t getTimestamp() const { return lastTimestamp; }
+    uint32_t getRecordsWritten() const { return recordsWritten; }
+    uint32_t getCapacityRecords() const { return (uint32_t)segmentCount * LOG_RECORDS_PER_SEGMENT; }
+};
+
+#endif // SAMPLE_LOG_H
@@ -0,0 +1,59 @@
+#ifndef SENSOR_H
+#define SENSOR_H
+
+#include <stdint.h>
+
+enum DeadbandMode : uint8_t {
+    DEADBAND_ABSOLUTE = 0, // deadband in the field's unit
+    DEADBAND_PERCENT       // deadband in percent of the last published value
+};
+
+// Per-channel filter pipeline settings, stages run in this order
+struct FilterConfig {
+    float maxRate;     // rate-of-change limit in unit/s, 0 = off
+    uint8_t median;    // median-of-N window, 0 or 1 = off (max FILTER_MEDIAN_MAX)
+    float ewmaAlpha;   // EWMA weight of the new sample, 1 = off
+    float kalmanQ;     // 1-D Kalman process noise
+    float kalmanR;     // 1-D Kalman measurement noise, 0 = off
+};
+
+// A single timestamped sample of one channel
+struct SensorReading {
+    uint32_t timestamp; // millis() when the sample was taken
+    uint8_t channel;
+    bool valid;
+    float value;
+};
+
+// One measured quantity of a sensor
+struct SensorField {
+    const char* key;   // JSON key, e.g. "heatIndex"
+    const char* topic; // MQTT subtopic and channel name suffix, e.g. "heatindex"
+    const char* unit;  // e.g. "°C"
+    float deadband;    // report-by-exception threshold
+    DeadbandMode deadbandMode;
+    float deadbandMin; // percent mode: smallest band in the field's unit, for values near 0
+    FilterConfig filter;
+};
+
+// Sensor types are plain classes without virtual functions, registered in
+// SensorRegistry (sensors.h). Every type provides:
+//
+//   static const char* name();                 "dht22", MQTT topic and JSON key
+//   static const SensorField& field(uint8_t f);
+//   static constexpr uint8_t FIELDS;           values per instance
+//   static constexpr uint8_t MAX_INSTANCES;    1, or probes per bus
+//   static constexpr unsigned long SAMPLE_INTERVAL;
+//
+//   void begin();
+//   void startSample();                        start a measurement, must not block for long
+//   bool pollSample();                         true once, when new values are available
+//   bool isSamplePending() const;
+//   uint8_t getInstanceCount() const;
+//   const char* getInstanceId(uint8_t instance) const;
+//   float getValue(uint8_t instance, uint8_t field) const;
+//   bool isValid(uint8_t instance) const;
+//
+// Each instance/field pair is one channel, numbered consecutively per sensor.
+
+#endif // SENSOR_H
@@ -0,0 +1,39 @@
+#include "sensor_filters.h"
+
+SensorFilters::SensorFilters() {
+    char name[CHANNEL_NAME_MAX];
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        const SensorField* field = SensorSet::describeChannel(ch, name, sizeof(name));
+        if (field) {
+            configure(ch, field->filter);
+        }
+    }
+}
+
+void SensorFilters::configure(uint8_t channel, const FilterConfig& config) {
+    if (channel < CHANNEL_COUNT) {
+        channels[channel].configure(config);
+    }
+}
+
+bool SensorFilters::apply(SensorReading& reading) {
+    if (reading.channel >= CHANNEL_COUNT) {
+        return true;
+    }
+    return channels[reading.channel].apply(reading);
+}
+
+bool SensorFilters::getValue(uint8_t channel, float& value) const {
+    if (channel >= CHANNEL_COUNT) {
+        return false;
+    }
+    return channels[channel].getValue(value);
+}
+
+uint32_t SensorFilters::getRejectedTotal() const {
+    uint32_t total = 0;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        total += channels[ch].getRejectedCount();
+    }
+    return total;
+}
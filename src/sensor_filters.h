@@ -0,0 +1,31 @@
+#ifndef SENSOR_FILTERS_H
+#define SENSOR_FILTERS_H
+
+#include <stdint.h>
+#include "filter.h"
+#include "sensor_reading.h"
+
+// One ChannelFilter per registry channel, set up from each channel's
+// SensorField::filter. Readings are filtered once in loop(); history, log,
+// rollups, MQTT and the web server all see the same filtered values.
+class SensorFilters {
+private:
+    ChannelFilter channels[CHANNEL_COUNT];
+
+public:
+    SensorFilters();
+
+    // Reset a channel and replace its settings
+    void configure(uint8_t channel, const FilterConfig& config);
+
+    // Filters reading.value in place. Returns false if the reading was
+    // rejected as an outlier and should be dropped.
+    bool apply(SensorReading& reading);
+
+    // Latest filtered value, false if the channel has no valid output
+    bool getValue(uint8_t channel, float& value) const;
+    uint32_t getRejectedCount(uint8_t channel) const { return channels[channel].getRejectedCount(); }
+    uint32_t getRejectedTotal() const;
+};
+
+#endif // SENSOR_FILTERS_H
@@ -0,0 +1,25 @@
+#include "sensor_reading.h"
+#include <Arduino.h>
+
+void formatChannelName(uint8_t channel, char* buffer, size_t size) {
+    if (SensorSet::describeChannel(channel, buffer, size) == nullptr) {
+        snprintf(buffer, size, "unknown");
+    }
+}
+
+int parseChannelName(const char* name) {
+    char buffer[CHANNEL_NAME_MAX];
+    for (uint8_t channel = 0; channel < CHANNEL_COUNT; channel++) {
+        formatChannelName(channel, buffer, sizeof(buffer));
+        if (strcmp(buffer, name) == 0) {
+            return channel;
+        }
+    }
+    return -1;
+}
+
+const char* getChannelUnit(uint8_t channel) {
+    char buffer[CHANNEL_NAME_MAX];
+    const SensorField* field = SensorSet::describeChannel(channel, buffer, sizeof(buffer));
+    return field ? field->unit : "";
+}
@@ -0,0 +1,18 @@
+#ifndef SENSOR_READING_H
+#define SENSOR_READING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sensor.h"
+#include "sensors.h"
+
+// Channels are numbered by the sensor registry, one per sensor instance and field
+constexpr uint8_t CHANNEL_COUNT = SensorSet::CHANNELS;
+
+// Channel names used by the HTTP API ("dht22_temperature", "ds18b20_0", ...)
+constexpr size_t CHANNEL_NAME_MAX = 24;
+void formatChannelName(uint8_t channel, char* buffer, size_t size);
+int parseChannelName(const char* name); // -1 if unknown
+const char* getChannelUnit(uint8_t channel);
+
+#endif // SENSOR_READING_H
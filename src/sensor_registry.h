@@ -0,0 +1,97 @@
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+#include <Arduino.h>
+#include "sensor.h"
+
+// Compile-time list of sensor types (see sensor.h for the interface).
+// Sensors are stored by value and visited through templates, so there is no
+// virtual dispatch or heap use. Channel numbers are assigned in list order.
+template <typename... Sensors>
+class SensorRegistry;
+
+// Resolves SensorRegistry::find<S>(), matches the head sensor or recurses
+template <typename S, typename First>
+struct SensorRegistryFind {
+    template <typename Rest>
+    static S* get(First& sensor, Rest& rest) { return rest.template find<S>(); }
+};
+
+template <typename S>
+struct SensorRegistryFind<S, S> {
+    template <typename Rest>
+    static S* get(S& sensor, Rest& rest) { return &sensor; }
+};
+
+template <>
+class SensorRegistry<> {
+public:
+    static constexpr uint8_t CHANNELS = 0;
+    static constexpr uint8_t COUNT = 0;
+
+    template <typename S>
+    using With = SensorRegistry<S>;
+
+    void begin() {}
+
+    template <typename S>
+    S* find() { return nullptr; }
+
+    template <typename Visitor>
+    void forEach(Visitor& visitor, uint8_t firstChannel = 0, uint8_t index = 0) {}
+
+    static const SensorField* describeChannel(uint8_t channel, char* name, size_t size) { return nullptr; }
+};
+
+template <typename First, typename... Rest>
+class SensorRegistry<First, Rest...> {
+private:
+    First sensor;
+    SensorRegistry<Rest...> rest;
+
+public:
+    static constexpr uint8_t SENSOR_CHANNELS = First::FIELDS * First::MAX_INSTANCES;
+    static constexpr uint8_t CHANNELS = SENSOR_CHANNELS + SensorRegistry<Rest...>::CHANNELS;
+    static constexpr uint8_t COUNT = 1 + SensorRegistry<Rest...>::COUNT;
+
+    // Registry type with one more sensor appended
+    template <typename S>
+    using With = SensorRegistry<First, Rest..., S>;
+
+    void begin() {
+        sensor.begin();
+        rest.begin();
+    }
+
+    // Registered sensor of type S, nullptr if S is not in the list
+    template <typename S>
+    S* find() { return SensorRegistryFind<S, First>::get(sensor, rest); }
+
+    // Calls visitor(sensor, firstChannel, index) for every sensor in order
+    template <typename Visitor>
+    void forEach(Visitor& visitor, uint8_t firstChannel = 0, uint8_t index = 0) {
+        visitor(sensor, firstChannel, index);
+        rest.forEach(visitor, firstChannel + SENSOR_CHANNELS, index + 1);
+    }
+
+    // Writes the channel name ("dht22_humidity", "ds18b20_0") and returns its field,
+    // nullptr if the channel does not exist
+    static const SensorField* describeChannel(uint8_t channel, char* name, size_t size) {
+        if (channel >= SENSOR_CHANNELS) {
+            return SensorRegistry<Rest...>::describeChannel(channel - SENSOR_CHANNELS, name, size);
+        }
+
+        uint8_t instance = channel / First::FIELDS;
+        const SensorField& field = First::field(channel % First::FIELDS);
+        if (First::MAX_INSTANCES == 1) {
+            snprintf(name, size, "%s_%s", First::name(), field.topic);
+        } else if (First::FIELDS == 1) {
+            snprintf(name, size, "%s_%u", First::name(), instance);
+        } else {
+            snprintf(name, size, "%s_%u_%s", First::name(), instance, field.topic);
+        }
+        return &field;
+    }
+};
+
+#endif // SENSOR_REGISTRY_H
@@ -0,0 +1,84 @@
+#ifndef SENSOR_STATS_H
+#define SENSOR_STATS_H
+
+#include <stdint.h>
+#include "config.h"
+
+// Duration histogram with log2 buckets: bucket k counts [2^k, 2^(k+1)) us,
+// the last bucket also counts everything longer.
+struct DurationHistogram {
+    uint32_t buckets[SENSOR_STATS_BUCKETS];
+    uint32_t count;
+    uint64_t totalUs;
+    uint32_t maxUs;
+
+    void reset() {
+        for (uint8_t k = 0; k < SENSOR_STATS_BUCKETS; k++) {
+            buckets[k] = 0;
+        }
+        count = 0;
+        totalUs = 0;
+        maxUs = 0;
+    }
+
+    void record(uint32_t us) {
+        uint8_t k = 31 - __builtin_clz(us | 1);
+        buckets[k < SENSOR_STATS_BUCKETS ? k : SENSOR_STATS_BUCKETS - 1]++;
+        count++;
+        totalUs += us;
+        if (us > maxUs) {
+            maxUs = us;
+        }
+    }
+
+    // Lower bound of bucket k in us
+    static uint32_t bucketStart(uint8_t k) { return k ? 1u << k : 0; }
+};
+
+// Timing of one sensor's samples, written by the sampling task only
+struct SensorStats {
+    DurationHistogram start;  // blocking time of startSample()
+    DurationHistogram sample; // startSample() until the values were available
+    uint32_t timeouts;        // samples that took longer than SENSOR_SAMPLE_TIMEOUT
+
+    void reset() {
+        start.reset();
+        sample.reset();
+        timeouts = 0;
+    }
+};
+
+// Outcome counters of one sensor instance (probe)
+struct InstanceStats {
+    uint32_t success;
+    uint32_t failure;
+    uint16_t failStreak;    // consecutive failures, 0 after a good sample
+    uint16_t maxFailStreak;
+    uint32_t lastGood;      // millis() of the last good sample, 0 = never
+
+    void reset() {
+        success = 0;
+        failure = 0;
+        failStreak = 0;
+        maxFailStreak = 0;
+        lastGood = 0;
+    }
+
+    void record(bool valid, uint32_t now) {
+        if (valid) {
+            success++;
+            failStreak = 0;
+            lastGood = now;
+            return;
+        }
+        failure++;
+        if (failStreak < UINT16_MAX) {
+            failStreak++;
+        }
+        if (failStreak > maxFailStreak) {
+            maxFailStreak = failStreak;
+        }
+    }
+};
+
+#endif // SENSOR_STATS_H
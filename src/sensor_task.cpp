@@ -0,0 +1,216 @@
+#include "sensor_task.h"
+#include <esp_timer.h>
+#include <limits.h>
+
+// Starts every sensor whose interval has elapsed
+struct SensorTask::StartVisitor {
+    SensorTask* task;
+    unsigned long now;
+    uint32_t subMillisUs; // microseconds past 'now', millis() is derived from the same timer
+    unsigned long sleep;
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        if (sensor.isSamplePending()) {
+            return;
+        }
+
+        unsigned long& due = task->nextDue[index];
+        long untilDue = (long)(due - now);
+        if (untilDue > 0) {
+            if ((unsigned long)untilDue < sleep) {
+                sleep = untilDue;
+            }
+            return;
+        }
+
+        task->recordStartLateness((int64_t)(long)(now - due) * 1000 + subMillisUs);
+        task->sampleTime[index] = now;
+        due += S::SAMPLE_INTERVAL;
+        if ((long)(due - now) <= 0) {
+            due = now + S::SAMPLE_INTERVAL; // fell behind by a full interval, resync
+        }
+        if (S::SAMPLE_INTERVAL < sleep) {
+            sleep = S::SAMPLE_INTERVAL;
+        }
+
+        int64_t startUs = esp_timer_get_time();
+        sensor.startSample();
+        task->sampleStartUs[index] = startUs;
+        uint32_t startDurationUs = (uint32_t)(esp_timer_get_time() - startUs);
+        task->statsSeq++; // odd, being written
+        task->stats[index].start.record(startDurationUs);
+        task->statsSeq++;
+    }
+};
+
+// Collects finished samples and queues one reading per channel
+struct SensorTask::PollVisitor {
+    SensorTask* task;
+    bool pending;
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        if (!sensor.isSamplePending()) {
+            return;
+        }
+        if (!sensor.pollSample()) {
+            pending = true;
+            return;
+        }
+
+        uint32_t durationUs = (uint32_t)(esp_timer_get_time() - task->sampleStartUs[index]);
+        uint32_t timestamp = task->sampleTime[index];
+        task->statsSeq++; // odd, being written
+        task->stats[index].sample.record(durationUs);
+        if (durationUs > SENSOR_SAMPLE_TIMEOUT * 1000) {
+            task->stats[index].timeouts++;
+        }
+        for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+            task->instanceStats[firstChannel + i * S::FIELDS].record(sensor.isValid(i), timestamp);
+        }
+        task->statsSeq++;
+
+        for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+            bool valid = sensor.isValid(i);
+            for (uint8_t f = 0; f < S::FIELDS; f++) {
+                task->pushReading(timestamp, firstChannel + i * S::FIELDS + f, valid, sensor.getValue(i, f));
+            }
+        }
+    }
+};
+
+SensorTask::SensorTask(SensorSet* sensors) {
+    this->sensors = sensors;
+    taskHandle = nullptr;
+    for (uint8_t i = 0; i < SensorSet::COUNT; i++) {
+        nextDue[i] = 0;
+        sampleTime[i] = 0;
+        sampleStartUs[i] = 0;
+        stats[i].reset();
+    }
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        instanceStats[ch].reset();
+    }
+    statsSeq = 0;
+    jitterMaxUs = 0;
+    jitterAvgUs = 0;
+    cycleCount = 0;
+    droppedReadings = 0;
+    lastStatsPrint = 0;
+}
+
+void SensorTask::begin() {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < SensorSet::COUNT; i++) {
+        nextDue[i] = now;
+    }
+
+#if SENSOR_TASK_ENABLED
+    // WiFi and lwIP run on the other core, so network stalls can't delay a sample.
+    // Priority is above the Arduino loop task so it preempts loop() on this core.
+    xTaskCreatePinnedToCore(taskEntry, "sensors", SENSOR_TASK_STACK, this,
+                            SENSOR_TASK_PRIORITY, &taskHandle, SENSOR_TASK_CORE);
+
+    Serial.print("Sensor task started on core ");
+    Serial.println(SENSOR_TASK_CORE);
+#else
+    Serial.println("Sensor sampling runs inline in loop()");
+#endif
+}
+
+void SensorTask::taskEntry(void* param) {
+    SensorTask* self = static_cast<SensorTask*>(param);
+
+    // runOnce() works out the sleep before it reads the sensors that are
+    // done, so the wake-up is counted from the start of the cycle: the bus
+    // time of those reads must not push the next sample start back
+    TickType_t cycleStart = xTaskGetTickCount();
+    for (;;) {
+        unsigned long sleep = self->runOnce();
+        TickType_t ticks = pdMS_TO_TICKS(sleep > 0 ? sleep : 1);
+        if ((TickType_t)(xTaskGetTickCount() - cycleStart) >= ticks) {
+            // The reads took longer than the sleep and the next sample is
+            // due: yield for one tick instead of running on without a break
+            cycleStart = xTaskGetTickCount();
+            ticks = 1;
+        }
+        vTaskDelayUntil(&cycleStart, ticks);
+    }
+}
+
+unsigned long SensorTask::runOnce() {
+    StartVisitor start;
+    start.task = this;
+    start.now = millis();
+    start.subMillisUs = (uint32_t)(esp_timer_get_time() % 1000);
+    start.sleep = ULONG_MAX;
+    sensors->forEach(start);
+
+    PollVisitor poll;
+    poll.task = this;
+    poll.pending = false;
+    sensors->forEach(poll);
+
+    if (poll.pending && start.sleep > SENSOR_POLL_INTERVAL) {
+        return SENSOR_POLL_INTERVAL;
+    }
+    return start.sleep;
+}
+
+void SensorTask::loop() {
+#if !SENSOR_TASK_ENABLED
+    runOnce();
+#endif
+
+    // Print sample timing once a minute
+    if (millis() - lastStatsPrint >= 60000) {
+        lastStatsPrint = millis();
+        Serial.print("[SENSOR] samples=");
+        Serial.print(cycleCount);
+        Serial.print(" start lateness avg=");
+        Serial.print(jitterAvgUs);
+        Serial.print("us max=");
+        Serial.print(jitterMaxUs);
+        Serial.print("us dropped=");
+        Serial.println(droppedReadings);
+    }
+}
+
+void SensorTask::copyStats(SensorStats (&sensorStats)[SensorSet::COUNT],
+                           InstanceStats (&instances)[CHANNEL_COUNT]) const {
+    // An update takes a few microseconds once per sample, a retry is rare
+    for (;;) {
+        uint32_t seq = statsSeq;
+        if (seq & 1) {
+            continue;
+        }
+        memcpy(sensorStats, stats, sizeof(stats));
+        memcpy(instances, instanceStats, sizeof(instanceStats));
+        if (statsSeq == seq) {
+            return;
+        }
+    }
+}
+
+void SensorTask::pushReading(uint32_t timestamp, uint8_t channel, bool valid, float value) {
+    SensorReading reading;
+    reading.timestamp = timestamp;
+    reading.channel = channel;
+    reading.valid = valid;
+    reading.value = value;
+
+    if (!queue.push(reading)) {
+        droppedReadings++;
+    }
+}
+
+void SensorTask::recordStartLateness(int64_t lateUs) {
+    uint32_t jitter = lateUs > 0 ? (uint32_t)lateUs : 0;
+
+    if (jitter > jitterMaxUs) {
+        jitterMaxUs = jitter;
+    }
+    jitterAvgUs = (cycleCount == 0) ? jitter : jitterAvgUs + ((int32_t)(jitter - jitterAvgUs) >> 4);
+    cycleCount++;
+}
@@ -0,0 +1,70 @@
+#ifndef SENSOR_TASK_H
+#define SENSOR_TASK_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "sensors.h"
+#include "sensor_reading.h"
+#include "spsc_queue.h"
+#include "sensor_stats.h"
+
+// Runs sensor acquisition on its own FreeRTOS task and hands readings to
+// the loop task through a lock-free queue. Every registered sensor is
+// sampled at its own SAMPLE_INTERVAL.
+class SensorTask {
+private:
+    struct StartVisitor;
+    struct PollVisitor;
+
+    SensorSet* sensors;
+    TaskHandle_t taskHandle;
+    SpscQueue<SensorReading, SENSOR_QUEUE_DEPTH> queue;
+
+    // Per-sensor schedule
+    unsigned long nextDue[SensorSet::COUNT];
+    uint32_t sampleTime[SensorSet::COUNT];
+    int64_t sampleStartUs[SensorSet::COUNT];
+
+    // Read duration and outcome instrumentation, instance stats are indexed
+    // by the instance's first channel. statsSeq is odd while the sampling
+    // task updates them, copyStats() retries a copy that overlapped one.
+    SensorStats stats[SensorSet::COUNT];
+    InstanceStats instanceStats[CHANNEL_COUNT];
+    std::atomic<uint32_t> statsSeq;
+
+    // Sample timing statistics
+    uint32_t jitterMaxUs;
+    uint32_t jitterAvgUs; // EWMA, weight 1/16
+    uint32_t cycleCount;
+    uint32_t droppedReadings;
+    unsigned long lastStatsPrint;
+
+    static void taskEntry(void* param);
+    // Starts due sensors and collects finished ones, returns ms until the next call is needed
+    unsigned long runOnce();
+    void pushReading(uint32_t timestamp, uint8_t channel, bool valid, float value);
+    void recordStartLateness(int64_t lateUs);
+
+public:
+    SensorTask(SensorSet* sensors);
+
+    void begin();
+    // Drives sampling when running inline, prints timing stats, call from loop()
+    void loop();
+
+    // Consumer side, returns false when no reading is queued
+    bool popReading(SensorReading& reading) { return queue.pop(reading); }
+
+    // Lateness of sample starts against each sensor's schedule
+    uint32_t getJitterMaxUs() const { return jitterMaxUs; }
+    uint32_t getJitterAvgUs() const { return jitterAvgUs; }
+    uint32_t getCycleCount() const { return cycleCount; }
+    uint32_t getDroppedReadings() const { return droppedReadings; }
+
+    // Consistent copy of the per-sensor (registry index) and per-instance
+    // (first channel) instrumentation, safe from any task
+    void copyStats(SensorStats (&sensorStats)[SensorSet::COUNT], InstanceStats (&instances)[CHANNEL_COUNT]) const;
+};
+
+#endif // SENSOR_TASK_H
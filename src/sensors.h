@@ -0,0 +1,26 @@
+#ifndef SENSORS_H
+#define SENSORS_H
+
+#include "config.h"
+#include "sensor_registry.h"
+#include "temperature.h"
+
+// Sensor types built into the firmware, switched by SENSOR_*_ENABLED in config.h.
+// A disabled type is not compiled at all.
+typedef SensorRegistry<> SensorSetBase;
+
+#if SENSOR_DHT22_ENABLED
+typedef SensorSetBase::With<TemperatureSensor> SensorSetDHT22;
+#else
+typedef SensorSetBase SensorSetDHT22;
+#endif
+
+#if SENSOR_DS18B20_ENABLED
+typedef SensorSetDHT22::With<DS18B20Sensor> SensorSet;
+#else
+typedef SensorSetDHT22 SensorSet;
+#endif
+
+static_assert(SensorSet::COUNT > 0, "No sensor type enabled in config.h");
+
+#endif // SENSORS_H
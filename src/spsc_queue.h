@@ -0,0 +1,50 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Fixed-size lock-free queue for exactly one producer and one consumer task.
+// Capacity must be a power of two, storage is inline (no heap).
+template <typename T, uint16_t N>
+class SpscQueue {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+private:
+    T items[N];
+    std::atomic<uint16_t> head; // next slot to read, written by consumer only
+    std::atomic<uint16_t> tail; // next slot to write, written by producer only
+
+public:
+    SpscQueue() : head(0), tail(0) {}
+
+    // Producer side, returns false when the queue is full
+    bool push(const T& item) {
+        uint16_t t = tail.load(std::memory_order_relaxed);
+        if ((uint16_t)(t - head.load(std::memory_order_acquire)) == N) {
+            return false;
+        }
+        items[t & (N - 1)] = item;
+        tail.store((uint16_t)(t + 1), std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns false when the queue is empty
+    bool pop(T& item) {
+        uint16_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[h & (N - 1)];
+        head.store((uint16_t)(h + 1), std::memory_order_release);
+        return true;
+    }
+
+    uint16_t size() const {
+        return (uint16_t)(tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire));
+    }
+
+    static constexpr uint16_t capacity() { return N; }
+};
+
+#endif // SPSC_QUEUE_H
@@ -1,21 +1,37 @@
 #include "temperature.h"
 #include <Arduino.h>
+#include <Preferences.h>
 
-TemperatureSensor::TemperatureSensor(int pin) : pin(pin) {
-    dht = new DHT(pin, DHT22);
+#if SENSOR_DHT22_ENABLED
+static const SensorField dht22Fields[TemperatureSensor::FIELDS] = {
+    {"temperature", "temperature", "°C", DHT22_TEMPERATURE_DEADBAND, DEADBAND_ABSOLUTE, 0.0f, DHT22_TEMPERATURE_FILTER},
+    {"humidity", "humidity", "%", DHT22_HUMIDITY_DEADBAND, DEADBAND_ABSOLUTE, 0.0f, DHT22_HUMIDITY_FILTER},
+    {"heatIndex", "heatindex", "°C", DHT22_HEAT_INDEX_DEADBAND, DEADBAND_PERCENT, DHT22_HEAT_INDEX_DEADBAND_MIN, DHT22_HEAT_INDEX_FILTER},
+};
+
+const SensorField& TemperatureSensor::field(uint8_t f) {
+    return dht22Fields[f];
+}
+
+TemperatureSensor::TemperatureSensor(int pin) : dht(pin, DHT22), pin(pin) {
     sensorInitialized = false;
     lastTemperature = 0.0;
     lastHumidity = 0.0;
     lastHeatIndex = 0.0;
     lastReadingValid = false;
+    samplePending = false;
 }
 
-TemperatureSensor::~TemperatureSensor() {
-    delete dht;
+float TemperatureSensor::getValue(uint8_t instance, uint8_t field) const {
+    switch (field) {
+        case FIELD_TEMPERATURE: return lastTemperature;
+        case FIELD_HUMIDITY:    return lastHumidity;
+        default:                return lastHeatIndex;
+    }
 }
 
 void TemperatureSensor::begin() {
-    dht->begin();
+    dht.begin();
     sensorInitialized = true;
     Serial.println("DHT22 Temperature & Humidity Sensor Initialized");
     Serial.print("Sensor pin: GPIO ");
@@ -25,8 +41,8 @@ void TemperatureSensor::begin() {
 
 void TemperatureSensor::readTemperature() {
     // Read temperature and humidity
-    float humidity = dht->readHumidity();
-    float temperature = dht->readTemperature(); // Celsius by default
+    float humidity = dht.readHumidity();
+    float temperature = dht.readTemperature(); // Celsius by default
 
     // Check if readings are valid
     if (isnan(humidity) || isnan(temperature)) {
@@ -43,7 +59,7 @@ void TemperatureSensor::readTemperature() {
     }
 
     // Calculate heat index (feels like temperature)
-    float heatIndex = dht->computeHeatIndex(temperature, humidity, false); // false = Celsius
+    float heatIndex = dht.computeHeatIndex(temperature, humidity, false); // false = Celsius
 
     // Store values
     lastTemperature = temperature;
@@ -65,31 +81,88 @@ void TemperatureSensor::readTemperature() {
     Serial.println("====================");
 }
 
+#endif // SENSOR_DHT22_ENABLED
+
+#if SENSOR_DS18B20_ENABLED
 // DS18B20 Sensor Implementation
-DS18B20Sensor::DS18B20Sensor(int pin) : pin(pin) {
-    oneWire = new OneWire(pin);
-    sensors = new DallasTemperature(oneWire);
-    sensorInitialized = false;
-    lastTemperature = 0.0;
-    lastReadingValid = false;
-    deviceCount = 0;
+static const SensorField ds18b20Fields[DS18B20Sensor::FIELDS] = {
+    {"temperature", "temperature", "°C", DS18B20_TEMPERATURE_DEADBAND, DEADBAND_ABSOLUTE, 0.0f, DS18B20_TEMPERATURE_FILTER},
+};
+
+const SensorField& DS18B20Sensor::field(uint8_t f) {
+    return ds18b20Fields[f];
 }
 
-DS18B20Sensor::~DS18B20Sensor() {
-    delete sensors;
-    delete oneWire;
+DS18B20Sensor::DS18B20Sensor(int pin) : oneWire(pin), sensors(&oneWire), pin(pin) {
+    sensorInitialized = false;
+    deviceCount = 0;
+    for (int i = 0; i < DS18B20_MAX_PROBES; i++) {
+        memset(addresses[i], 0, sizeof(DeviceAddress));
+        addressStrings[i][0] = '\0';
+        lastTemperature[i] = 0.0;
+        lastReadingValid[i] = false;
+        resolution[i] = DS18B20_DEFAULT_RESOLUTION;
+        requestedResolution[i] = 0;
+    }
+    parasitePower = false;
+    conversionPending = false;
+    conversionStartTime = 0;
+    conversionTime = 0;
 }
 
 void DS18B20Sensor::begin() {
-    sensors->begin();
+    sensors.begin();
+    sensors.setWaitForConversion(false); // requestTemperatures() returns immediately
     sensorInitialized = true;
-    deviceCount = sensors->getDeviceCount();
+    parasitePower = sensors.isParasitePowerMode();
+
+    // Search the bus once and cache every ROM address, reads go by address after this
+    int found = sensors.getDeviceCount();
+    deviceCount = 0;
+    for (int i = 0; i < found && deviceCount < DS18B20_MAX_PROBES; i++) {
+        if (!sensors.getAddress(addresses[deviceCount], i)) {
+            continue;
+        }
+        for (int b = 0; b < 8; b++) {
+            sprintf(&addressStrings[deviceCount][b * 2], "%02X", addresses[deviceCount][b]);
+        }
+        deviceCount++;
+    }
+
+    // Apply each probe's stored resolution, the wait follows the slowest one
+    Preferences preferences;
+    bool stored = preferences.begin("ds18b20", true);
+    for (int i = 0; i < deviceCount; i++) {
+        char key[16];
+        resolutionKey(i, key);
+        uint8_t bits = stored ? preferences.getUChar(key, DS18B20_DEFAULT_RESOLUTION) : DS18B20_DEFAULT_RESOLUTION;
+        resolution[i] = (bits >= 9 && bits <= 12) ? bits : DS18B20_DEFAULT_RESOLUTION;
+        sensors.setResolution(addresses[i], resolution[i], true);
+    }
+    if (stored) {
+        preferences.end();
+    }
+    updateConversionTime();
 
     Serial.println("DS18B20 Temperature Sensor Initialized");
     Serial.print("Sensor pin: GPIO ");
     Serial.println(pin);
     Serial.print("Devices found: ");
-    Serial.println(deviceCount);
+    Serial.println(found);
+    for (int i = 0; i < deviceCount; i++) {
+        Serial.print("  Probe ");
+        Serial.print(i);
+        Serial.print(": ");
+        Serial.print(addressStrings[i]);
+        Serial.print(" (");
+        Serial.print(resolution[i]);
+        Serial.println(" bit)");
+    }
+    if (found > DS18B20_MAX_PROBES) {
+        Serial.print("Warning: only the first ");
+        Serial.print(DS18B20_MAX_PROBES);
+        Serial.println(" probes are read (DS18B20_MAX_PROBES)");
+    }
 
     if (deviceCount == 0) {
         Serial.println("Warning: No DS18B20 devices found!");
@@ -103,38 +176,127 @@ void DS18B20Sensor::begin() {
     }
 }
 
-void DS18B20Sensor::readTemperature() {
+void DS18B20Sensor::requestConversion() {
     if (deviceCount == 0) {
-        lastReadingValid = false;
         return;
     }
 
-    // Request temperature from all devices on the bus
-    sensors->requestTemperatures();
+    // Previous conversion still running, let update() collect it first
+    if (conversionPending) {
+        return;
+    }
 
-    // Read temperature from the first device (index 0)
-    float temperature = sensors->getTempCByIndex(0);
+    applyResolutionChanges();
 
-    // Check if reading is valid (DS18B20 returns -127 or 85 on error)
-    if (temperature == DEVICE_DISCONNECTED_C || temperature == 85.0) {
-        lastReadingValid = false;
-        Serial.println("Error: Failed to read from DS18B20 sensor!");
-        Serial.println("Possible issues:");
-        Serial.print("  - Sensor not connected to GPIO ");
-        Serial.println(pin);
-        Serial.println("  - Loose wiring or bad sensor");
-        Serial.println("  - Missing 4.7K pull-up resistor on DATA line");
-        return;
+    // Start conversion on all devices on the bus (does not wait)
+    sensors.requestTemperatures();
+    conversionStartTime = millis();
+    conversionPending = true;
+}
+
+bool DS18B20Sensor::update() {
+    if (!conversionPending) {
+        return false;
     }
 
-    // Store value
-    lastTemperature = temperature;
-    lastReadingValid = true;
+    // Externally powered devices report completion on the bus, parasite
+    // powered devices must not be polled and need the full conversion time
+    if (millis() - conversionStartTime < conversionTime) {
+        if (parasitePower || !sensors.isConversionComplete()) {
+            return false;
+        }
+    }
 
-    // Print readings
+    conversionPending = false;
+    collectReading();
+    return true;
+}
+
+void DS18B20Sensor::collectReading() {
     Serial.println("=== DS18B20 Readings ===");
-    Serial.print("Temperature: ");
-    Serial.print(temperature);
-    Serial.println(" °C");
+
+    // One scratchpad read per cached address, no bus search
+    for (int i = 0; i < deviceCount; i++) {
+        float temperature = sensors.getTempC(addresses[i]);
+
+        Serial.print("Probe ");
+        Serial.print(addressStrings[i]);
+        Serial.print(": ");
+
+        // Check if reading is valid (DS18B20 returns -127 or 85 on error)
+        if (temperature == DEVICE_DISCONNECTED_C || temperature == 85.0) {
+            lastReadingValid[i] = false;
+            Serial.println("read failed (check wiring and 4.7K pull-up on DATA line)");
+            continue;
+        }
+
+        // Store value
+        lastTemperature[i] = temperature;
+        lastReadingValid[i] = true;
+
+        Serial.print(temperature);
+        Serial.println(" °C");
+    }
+
     Serial.println("=======================");
 }
+
+bool DS18B20Sensor::setResolution(int index, uint8_t bits) {
+    if (index < 0 || index >= deviceCount || bits < 9 || bits > 12) {
+        return false;
+    }
+    requestedResolution[index] = bits;
+    return true;
+}
+
+void DS18B20Sensor::applyResolutionChanges() {
+    bool changed = false;
+
+    for (int i = 0; i < deviceCount; i++) {
+        uint8_t bits = requestedResolution[i].exchange(0);
+        if (bits == 0 || bits == resolution[i]) {
+            continue;
+        }
+
+        if (!sensors.setResolution(addresses[i], bits, true)) {
+            Serial.print("[DS18B20] Failed to set resolution on ");
+            Serial.println(addressStrings[i]);
+            continue;
+        }
+        resolution[i] = bits;
+        changed = true;
+
+        Preferences preferences;
+        char key[16];
+        resolutionKey(i, key);
+        preferences.begin("ds18b20", false);
+        preferences.putUChar(key, bits);
+        preferences.end();
+
+        Serial.print("[DS18B20] Probe ");
+        Serial.print(addressStrings[i]);
+        Serial.print(" resolution set to ");
+        Serial.print(bits);
+        Serial.println(" bit");
+    }
+
+    if (changed) {
+        updateConversionTime();
+    }
+}
+
+void DS18B20Sensor::updateConversionTime() {
+    uint8_t bits = 9;
+    for (int i = 0; i < deviceCount; i++) {
+        if (resolution[i] > bits) {
+            bits = resolution[i];
+        }
+    }
+    conversionTime = sensors.millisToWaitForConversion(bits);
+}
+
+void DS18B20Sensor::resolutionKey(int index, char* key) const {
+    // Serial number part of the ROM address, without family code and CRC
+    snprintf(key, 16, "r%.12s", &addressStrings[index][2]);
+}
+#endif // SENSOR_DS18B20_ENABLED
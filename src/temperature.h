@@ -1,55 +1,127 @@
 #ifndef TEMPERATURE_H
 #define TEMPERATURE_H
 
+#include "config.h"
+#include "sensor.h"
+
+#if SENSOR_DHT22_ENABLED
 #include <DHT.h>
-#include <OneWire.h>
-#include <DallasTemperature.h>
 
 class TemperatureSensor {
 private:
-    DHT* dht;
+    DHT dht;
     int pin;
     bool sensorInitialized;
     float lastTemperature;
     float lastHumidity;
     float lastHeatIndex;
     bool lastReadingValid;
+    bool samplePending;
 
 public:
-    TemperatureSensor(int pin);
-    ~TemperatureSensor();
+    enum Field : uint8_t { FIELD_TEMPERATURE = 0, FIELD_HUMIDITY, FIELD_HEAT_INDEX };
+
+    static constexpr uint8_t FIELDS = 3;
+    static constexpr uint8_t MAX_INSTANCES = 1;
+    static constexpr unsigned long SAMPLE_INTERVAL = DHT22_SAMPLE_INTERVAL;
+    static const char* name() { return "dht22"; }
+    static const SensorField& field(uint8_t f);
+
+    TemperatureSensor(int pin = TEMP_SENSOR_PIN);
 
     void begin();
     void readTemperature();
 
+    // Sensor interface (see sensor.h), the DHT22 read itself takes a few ms
+    void startSample() { readTemperature(); samplePending = true; }
+    bool pollSample() { bool ready = samplePending; samplePending = false; return ready; }
+    bool isSamplePending() const { return samplePending; }
+    uint8_t getInstanceCount() const { return 1; }
+    const char* getInstanceId(uint8_t instance) const { return ""; }
+    float getValue(uint8_t instance, uint8_t field) const;
+    bool isValid(uint8_t instance = 0) const { return lastReadingValid; }
+
     // Getter methods for current readings
     float getTemperature() const { return lastTemperature; }
     float getHumidity() const { return lastHumidity; }
     float getHeatIndex() const { return lastHeatIndex; }
-    bool isValid() const { return lastReadingValid; }
 };
+#endif // SENSOR_DHT22_ENABLED
+
+#if SENSOR_DS18B20_ENABLED
+#include <OneWire.h>
+#include <DallasTemperature.h>
+#include <atomic>
 
 class DS18B20Sensor {
 private:
-    OneWire* oneWire;
-    DallasTemperature* sensors;
+    OneWire oneWire;
+    DallasTemperature sensors;
     int pin;
     bool sensorInitialized;
-    float lastTemperature;
-    bool lastReadingValid;
     int deviceCount;
+    bool parasitePower;
+
+    // Per-probe state, ROM addresses are cached once in begin()
+    DeviceAddress addresses[DS18B20_MAX_PROBES];
+    char addressStrings[DS18B20_MAX_PROBES][17];
+    float lastTemperature[DS18B20_MAX_PROBES];
+    bool lastReadingValid[DS18B20_MAX_PROBES];
+
+    // Per-probe resolution in bits, changes requested from other tasks are
+    // applied by the sampling task between conversions (0 = none requested)
+    uint8_t resolution[DS18B20_MAX_PROBES];
+    std::atomic<uint8_t> requestedResolution[DS18B20_MAX_PROBES];
+
+    // Conversion state (non-blocking start/poll)
+    bool conversionPending;
+    unsigned long conversionStartTime;
+    unsigned long conversionTime;
+
+    void collectReading();
+    void applyResolutionChanges();
+    void updateConversionTime();
+    // NVS key for a probe's resolution, keys are limited to 15 characters
+    void resolutionKey(int index, char* key) const;
 
 public:
-    DS18B20Sensor(int pin);
-    ~DS18B20Sensor();
+    static constexpr uint8_t FIELDS = 1;
+    static constexpr uint8_t MAX_INSTANCES = DS18B20_MAX_PROBES;
+    static constexpr unsigned long SAMPLE_INTERVAL = DS18B20_SAMPLE_INTERVAL;
+    static const char* name() { return "ds18b20"; }
+    static const SensorField& field(uint8_t f);
+
+    DS18B20Sensor(int pin = DS18B20_PIN);
 
     void begin();
-    void readTemperature();
 
-    // Getter methods for current readings
-    float getTemperature() const { return lastTemperature; }
-    bool isValid() const { return lastReadingValid; }
+    // Start a conversion on all devices and return immediately
+    void requestConversion();
+    // Collect the result once the conversion is done, returns true on a new reading
+    bool update();
+
+    // Sensor interface (see sensor.h), one instance per probe
+    void startSample() { requestConversion(); }
+    bool pollSample() { return update(); }
+    bool isSamplePending() const { return conversionPending; }
+    uint8_t getInstanceCount() const { return deviceCount; }
+    const char* getInstanceId(uint8_t instance) const { return addressStrings[instance]; }
+    float getValue(uint8_t instance, uint8_t field) const { return lastTemperature[instance]; }
+
+    // Getter methods for current readings (no index = first probe)
+    float getTemperature(int index = 0) const { return lastTemperature[index]; }
+    bool isValid(int index = 0) const { return index < deviceCount && lastReadingValid[index]; }
+    const char* getAddressString(int index) const { return addressStrings[index]; }
+    bool isConversionPending() const { return conversionPending; }
     int getDeviceCount() const { return deviceCount; }
+
+    // Resolution (9-12 bits), stored in NVS per ROM address. Returns false
+    // for an unknown probe or resolution; takes effect on the next sample.
+    bool setResolution(int index, uint8_t bits);
+    uint8_t getResolution(int index) const { return resolution[index]; }
+    // Wait for the slowest probe, all probes convert at once
+    unsigned long getConversionTime() const { return conversionTime; }
 };
+#endif // SENSOR_DS18B20_ENABLED
 
 #endif // TEMPERATURE_H
@@ -0,0 +1,77 @@
+#include "text_buffer.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+TextBuffer::TextBuffer(char* buffer, size_t capacity) {
+    this->buffer = buffer;
+    this->capacity = capacity;
+    clear();
+}
+
+void TextBuffer::clear() {
+    length = 0;
+    overflow = false;
+    buffer[0] = '\0';
+}
+
+void TextBuffer::truncate(size_t length) {
+    if (length < this->length) {
+        this->length = length;
+        buffer[length] = '\0';
+    }
+    overflow = false;
+}
+
+void TextBuffer::append(const char* text) {
+    size_t size = strlen(text);
+    if (length + size >= capacity) {
+        overflow = true;
+        return;
+    }
+    memcpy(buffer + length, text, size + 1);
+    length += size;
+}
+
+void TextBuffer::append(char c) {
+    if (length + 1 >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    buffer[length] = '\0';
+}
+
+void TextBuffer::appendf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int size = vsnprintf(buffer + length, capacity - length, format, args);
+    va_end(args);
+
+    if (size < 0 || length + size >= capacity) {
+        overflow = true;
+        buffer[length] = '\0';
+        return;
+    }
+    length += size;
+}
+
+void TextBuffer::appendFloat(float value, uint8_t width) {
+    char digits[48];
+    if (!(fabsf(value) < 2e7f)) {
+        // nan, inf and values past the range of the scaled long
+        snprintf(digits, sizeof(digits), "%.2f", value);
+    } else {
+        // A float times 100 is exact in a double (24 + 7 bits), so nearbyint()
+        // rounds ties to even like printf does, e.g. 0.125 gives 0.12. The
+        // sign comes from the value, -0.004 gives -0.00 as with %.2f.
+        unsigned long magnitude = (unsigned long)nearbyint(fabs((double)value * 100));
+        snprintf(digits, sizeof(digits), "%s%lu.%02lu", signbit(value) ? "-" : "", magnitude / 100, magnitude % 100);
+    }
+
+    for (size_t pad = strlen(digits); pad < width; pad++) {
+        append(' ');
+    }
+    append(digits);
+}
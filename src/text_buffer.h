@@ -0,0 +1,36 @@
+#ifndef TEXT_BUFFER_H
+#define TEXT_BUFFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Builds text in a caller-owned buffer, no allocation. The contents stay
+// null-terminated; appends that do not fit set the overflow flag and are
+// dropped whole.
+class TextBuffer {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+
+public:
+    TextBuffer(char* buffer, size_t capacity);
+
+    void clear();
+    // Cut back to an earlier length, e.g. to a fixed prefix, and clear the overflow flag
+    void truncate(size_t length);
+
+    void append(const char* text);
+    void append(char c);
+    void appendf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    // Fixed two decimals, right-aligned to width like dtostrf(value, width, 2).
+    // Integer formatting only, printf's float path is slower and may allocate.
+    void appendFloat(float value, uint8_t width = 0);
+
+    const char* c_str() const { return buffer; }
+    size_t getLength() const { return length; }
+    bool hasOverflowed() const { return overflow; }
+};
+
+#endif // TEXT_BUFFER_H
@@ -0,0 +1,637 @@
+// Generated by tools/build_web_assets.py from the *_html.h pages, do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// A gzip-compressed page and its strong ETag
+struct WebAsset {
+    const uint8_t* data;
+    size_t length;
+    const char* etag;
+};
+
+// webserver_html.h: 25068 bytes, 4031 gzipped
+const uint8_t index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5b, 0xfd, 0x6e, 0xdc, 0xc6,
+    0x11, 0xff, 0x5f, 0x4f, 0xb1, 0x3e, 0xc3, 0xe1, 0x09, 0x16, 0xef, 0x43, 0xa7, 0x93, 0x64, 0x49,
+    0xa7, 0xd4, 0x91, 0xe5, 0x44, 0x85, 0x63, 0x1b, 0x96, 0x02, 0x37, 0x28, 0x82, 0x60, 0x8f, 0xdc,
+    0xbb, 0x63, 0xcd, 0x23, 0x59, 0x92, 0xa7, 0x93, 0x9c, 0xf8, 0x8f, 0x02, 0x2d, 0xd0, 0x16, 0x29,
+    0xda, 0x34, 0x45, 0x8b, 0x02, 0x2d, 0x82, 0xfe, 0xd1, 0x57, 0x28, 0xfa, 0x3c, 0x79, 0x81, 0xe6,
+    0x11, 0x3a, 0x33, 0xbb, 0x4b, 0x2e, 0x79, 0xe4, 0x9d, 0x24, 0xdb, 0x71, 0x20, 0x58, 0xe2, 0xed,
+    0xc7, 0xec, 0x7c, 0xfe, 0x66, 0x76, 0x78, 0x3e, 0xb8, 0xf5, 0xe0, 0xc9, 0xd1, 0xd9, 0xa7, 0x4f,
+    0x8f, 0xd9, 0x24, 0x9d, 0xfa, 0x87, 0x6b, 0x07, 0xfa, 0x8f, 0xe0, 0x2e, 0xfc, 0x99, 0x8a, 0x94,
+    0x33, 0x67, 0xc2, 0xe3, 0x44, 0xa4, 0x83, 0xc6, 0x27, 0x67, 0x0f, 0xed, 0xdd, 0x86, 0x1e, 0x0e,
+    0xf8, 0x54, 0x0c, 0x1a, 0xe7, 0x9e, 0x98, 0x47, 0x61, 0x9c, 0x36, 0x98, 0x13, 0x06, 0xa9, 0x08,
+    0x60, 0xd9, 0xdc, 0x73, 0xd3, 0xc9, 0xc0, 0x15, 0xe7, 0x9e, 0x23, 0x6c, 0xfa, 0xb0, 0xc1, 0xbc,
+    0xc0, 0x4b, 0x3d, 0xee, 0xdb, 0x89, 0xc3, 0x7d, 0x31, 0xe8, 0xb6, 0x3a, 0x48, 0x26, 0xf5, 0x52,
+    0x5f, 0x1c, 0x3e, 0x7d, 0x7a, 0xf2, 0xe4, 0x8c, 0x3d, 0xf7, 0x1e, 0x7a, 0xec, 0x54, 0xa4, 0xb3,
+    0xe8, 0xa0, 0x2d, 0xc7, 0xd7, 0x0e, 0x92, 0xf4, 0x12, 0xff, 0x0e, 0x43, 0xf7, 0x92, 0x7d, 0xb1,
+    0x36, 0x02, 0xfa, 0xf6, 0x88, 0x4f, 0x3d, 0xff, 0x72, 0x8f, 0xdd, 0x8f, 0x81, 0xda, 0x06, 0x4b,
+    0x78, 0x90, 0xd8, 0x89, 0x88, 0xbd, 0xd1, 0xfe, 0xda, 0x90, 0x3b, 0x2f, 0xc6, 0x71, 0x38, 0x0b,
+    0xdc, 0x3d, 0xe6, 0x7b, 0x81, 0xe0, 0xb1, 0x3d, 0x8e, 0xb9, 0xeb, 0x01, 0x4f, 0xcd, 0x6e, 0xaf,
+    0xef, 0x8a, 0xf1, 0x06, 0xbb, 0xbd, 0xbd, 0xbd, 0x23, 0x04, 0x67, 0x9d, 0x3b, 0xf0, 0xbc, 0xb3,
+    0xbd, 0x35, 0xe4, 0x9b, 0xac, 0xdb, 0xe9, 0xdc, 0x59, 0xdf, 0x5f, 0x73, 0xbd, 0x24, 0xf2, 0x39,
+    0x90, 0x1e, 0xf9, 0xe2, 0x62, 0x7f, 0xed, 0x17, 0xb3, 0x24, 0xf5, 0x46, 0x97, 0xb6, 0x92, 0x6a,
+    0x8f, 0x39, 0xf0, 0x5b, 0xc4, 0xfb, 0x6b, 0xdc, 0xf7, 0xc6, 0x81, 0xed, 0xa5, 0x62, 0x9a, 0xe4,
+    0x83, 0x53, 0x2f, 0xb0, 0x27, 0xc2, 0x1b, 0x4f, 0x60, 0x21, 0xd0, 0x3b, 0x9f, 0xc0, 0x10, 0x8f,
+    0xc7, 0x5e, 0xb0, 0xc7, 0x3a, 0xfb, 0x6b, 0x11, 0x77, 0x5d, 0x2f, 0x18, 0xc3, 0x54, 0x3f, 0x02,
+    0xd2, 0xaf, 0xd6, 0x5a, 0x48, 0x95, 0x03, 0x8f, 0x31, 0xc8, 0x65, 0xf2, 0x3d, 0x9f, 0x00, 0x61,
+    0x63, 0xc3, 0x26, 0x6d, 0x18, 0x86, 0xb1, 0x2b, 0x62, 0x1b, 0x85, 0x99, 0x25, 0x78, 0x80, 0x1c,
+    0xbc, 0xb0, 0x93, 0x09, 0x77, 0xc3, 0x39, 0x9c, 0x41, 0x63, 0xb4, 0x9a, 0xc5, 0xe3, 0x21, 0x6f,
+    0x76, 0x36, 0xe8, 0xa7, 0xb5, 0xb9, 0x8e, 0x8c, 0x5c, 0x48, 0x2b, 0xec, 0xb1, 0xad, 0x3e, 0x6d,
+    0x55, 0x9f, 0x50, 0x70, 0xe4, 0x66, 0xd2, 0x05, 0x2e, 0x9c, 0xd0, 0x0f, 0xe3, 0x3d, 0x76, 0xbb,
+    0xd7, 0xeb, 0xed, 0xaf, 0xa5, 0xe2, 0x22, 0xb5, 0x49, 0x50, 0x43, 0x44, 0x92, 0xc7, 0x1e, 0x86,
+    0x69, 0x1a, 0x4e, 0x35, 0x67, 0x64, 0x93, 0xc4, 0x7b, 0x29, 0x60, 0x9d, 0xcf, 0xa7, 0x51, 0xb3,
+    0xdb, 0xea, 0xc7, 0x62, 0xba, 0xc1, 0xfa, 0xe7, 0xf3, 0x0d, 0xb6, 0x09, 0x8f, 0xeb, 0x24, 0xef,
+    0x28, 0x8c, 0xa7, 0x36, 0x0a, 0x19, 0xc1, 0x51, 0x25, 0x4a, 0xdd, 0x5d, 0xa9, 0x14, 0x9f, 0x0f,
+    0x85, 0x0f, 0xd3, 0x99, 0x21, 0x86, 0x7e, 0xe8, 0xbc, 0x58, 0x38, 0x78, 0x1b, 0x57, 0x6b, 0x6e,
+    0xfb, 0xfd, 0xbe, 0x62, 0x62, 0xae, 0xb4, 0x3f, 0x0c, 0x7d, 0xb7, 0x82, 0xaf, 0x4e, 0xeb, 0x1e,
+    0xf1, 0xd5, 0x43, 0xbe, 0xba, 0x9a, 0x2f, 0x2f, 0x88, 0x66, 0xe9, 0xcf, 0xd3, 0xcb, 0x08, 0x1c,
+    0x19, 0x65, 0x6e, 0x7c, 0x86, 0x9e, 0x9a, 0x8f, 0x45, 0x3c, 0x49, 0xe6, 0xa0, 0xfc, 0xc6, 0x67,
+    0xc0, 0x57, 0x41, 0x6b, 0xb9, 0x49, 0x37, 0x91, 0x1f, 0xf5, 0xd1, 0x8e, 0x25, 0x13, 0x5b, 0x86,
+    0xd9, 0x40, 0x55, 0x60, 0x95, 0x24, 0xf4, 0x3d, 0x97, 0xdd, 0x76, 0x5d, 0x77, 0xc1, 0x9c, 0xfd,
+    0xcc, 0x9a, 0xde, 0x4b, 0x22, 0xa9, 0xe6, 0x61, 0xa8, 0x20, 0x48, 0x97, 0x24, 0x07, 0x41, 0x87,
+    0x2f, 0x3c, 0xb0, 0x4e, 0x14, 0x81, 0x87, 0xf3, 0xc0, 0x81, 0x99, 0x20, 0x0c, 0xc0, 0x69, 0x16,
+    0x47, 0xaa, 0x04, 0xdc, 0x1b, 0x85, 0xce, 0x2c, 0xa9, 0x13, 0x53, 0xce, 0x82, 0xb0, 0xe1, 0x2c,
+    0xc5, 0x18, 0xd2, 0x94, 0x14, 0x4b, 0x5a, 0xed, 0x32, 0x8a, 0xc8, 0xb2, 0x7a, 0xaf, 0x3d, 0x8f,
+    0x91, 0x01, 0x74, 0xe8, 0x28, 0x4c, 0x20, 0xd8, 0x43, 0xf0, 0x9d, 0x58, 0xf8, 0x3c, 0xf5, 0xce,
+    0x89, 0x95, 0x56, 0x1a, 0x8e, 0xc7, 0xbe, 0xb0, 0xf5, 0x86, 0xc2, 0x42, 0x3e, 0x04, 0x05, 0xcd,
+    0xd0, 0xf5, 0x63, 0x1d, 0x44, 0x28, 0x6c, 0x1a, 0x46, 0xa0, 0x1f, 0xd4, 0x77, 0x0a, 0x82, 0x25,
+    0xe8, 0x45, 0x7b, 0x8c, 0x1e, 0x81, 0xae, 0xf8, 0xb4, 0x69, 0xf7, 0x29, 0x74, 0xcd, 0x08, 0x32,
+    0xf9, 0xd5, 0x9f, 0x9c, 0x59, 0x9c, 0x20, 0xdf, 0x51, 0xe8, 0x49, 0x5f, 0x36, 0xb5, 0xba, 0x6b,
+    0xd8, 0x4f, 0x19, 0xa3, 0x2c, 0xa6, 0xb2, 0x3c, 0x9f, 0xa5, 0x61, 0x95, 0x24, 0x7b, 0x93, 0xf0,
+    0x9c, 0x04, 0x5f, 0xc2, 0x24, 0x23, 0xe0, 0x83, 0xf0, 0xe8, 0x92, 0xe3, 0x25, 0xc2, 0x17, 0x4e,
+    0xba, 0xc2, 0xa9, 0xde, 0x8a, 0xff, 0xe4, 0xba, 0xd2, 0xd6, 0x54, 0x98, 0xb3, 0xa0, 0xa4, 0xeb,
+    0x78, 0x9a, 0x41, 0xd5, 0x9b, 0xf2, 0x31, 0x8c, 0xcf, 0x62, 0xbf, 0xd9, 0x70, 0x79, 0xca, 0xf7,
+    0x68, 0xa0, 0x9d, 0x9c, 0x8f, 0xef, 0x5e, 0x4c, 0xfd, 0x8d, 0x3b, 0xbd, 0x23, 0x78, 0x64, 0xf0,
+    0x18, 0x24, 0x03, 0x6b, 0x92, 0xa6, 0xd1, 0x5e, 0xbb, 0x3d, 0x9f, 0xcf, 0x5b, 0xf3, 0x5e, 0x2b,
+    0x8c, 0xc7, 0xed, 0xcd, 0x4e, 0xa7, 0x83, 0x8b, 0x2d, 0x26, 0xd3, 0x88, 0xd5, 0xdd, 0xb4, 0x98,
+    0x84, 0x56, 0xf9, 0x8c, 0x09, 0xe7, 0x83, 0xf0, 0x62, 0x60, 0x75, 0x10, 0xf6, 0x00, 0xbe, 0x37,
+    0xad, 0x3b, 0xbd, 0x63, 0x20, 0x1b, 0xf1, 0x74, 0xc2, 0x46, 0x9e, 0xef, 0x0f, 0xac, 0x3b, 0x9b,
+    0x00, 0x63, 0x3d, 0x8b, 0xb9, 0x03, 0xeb, 0xe3, 0x6d, 0x76, 0xef, 0x51, 0x97, 0x6d, 0x4d, 0xba,
+    0x9d, 0x97, 0x56, 0x5b, 0xae, 0x44, 0xfa, 0xf0, 0xd4, 0x28, 0xb8, 0x8e, 0x1d, 0x0b, 0x90, 0x2a,
+    0x45, 0x89, 0xd4, 0x63, 0x61, 0xd6, 0x70, 0x6a, 0xe4, 0x85, 0x4c, 0x94, 0x61, 0x63, 0x29, 0xfc,
+    0x7b, 0x0a, 0xe6, 0xa5, 0x95, 0xaf, 0x1f, 0x53, 0xb1, 0x18, 0xc5, 0x22, 0x99, 0xd8, 0xc3, 0x34,
+    0xc8, 0xe1, 0x92, 0x62, 0xa1, 0xe8, 0xac, 0x04, 0xfa, 0xd2, 0x81, 0xcd, 0x10, 0xb8, 0x3d, 0xea,
+    0xe0, 0x4f, 0xee, 0x40, 0xdd, 0x2b, 0x38, 0xd0, 0xb2, 0x18, 0xd1, 0x10, 0xba, 0xdb, 0xcf, 0x31,
+    0x14, 0x00, 0xb5, 0x2f, 0x61, 0xb4, 0x80, 0xc5, 0x85, 0x50, 0x49, 0xc3, 0x99, 0x33, 0xb1, 0xb9,
+    0x23, 0xf5, 0x36, 0xe5, 0x81, 0x17, 0xcd, 0x10, 0x10, 0xc2, 0xa0, 0x2c, 0xa6, 0x0c, 0xa1, 0x0d,
+    0x56, 0x18, 0xc3, 0x8d, 0xe7, 0xa2, 0x94, 0x21, 0x6f, 0x8b, 0x0e, 0xfe, 0x14, 0x10, 0x41, 0xa3,
+    0x5d, 0xcb, 0x0f, 0x39, 0x6a, 0xc6, 0x48, 0x67, 0x5a, 0xab, 0x66, 0x1c, 0x6c, 0xa1, 0xbc, 0xa6,
+    0x56, 0x75, 0x56, 0x4e, 0xf8, 0xb9, 0x00, 0x07, 0x0e, 0x46, 0x61, 0xf9, 0xd0, 0xd1, 0x68, 0xd4,
+    0x73, 0xdc, 0x4a, 0x8d, 0x8e, 0x46, 0x4e, 0xb7, 0xb3, 0xb3, 0x90, 0xe4, 0xab, 0x74, 0x5c, 0x4e,
+    0xa1, 0x12, 0xe3, 0x2a, 0x72, 0x6d, 0x91, 0x97, 0x24, 0x8d, 0xc3, 0x82, 0x50, 0xbb, 0xfd, 0xed,
+    0xad, 0xce, 0xd6, 0xfe, 0xaa, 0x4c, 0x29, 0x31, 0x34, 0xa3, 0x95, 0x24, 0x9e, 0x5b, 0x41, 0x64,
+    0x79, 0xf6, 0x94, 0xa0, 0xa1, 0x6b, 0x19, 0x72, 0xb8, 0x8e, 0x32, 0x5e, 0x1a, 0x5f, 0x2a, 0x0f,
+    0x5d, 0x0a, 0x62, 0xa6, 0x1a, 0x37, 0x77, 0xf9, 0xce, 0x56, 0x3f, 0x73, 0x19, 0x85, 0x3c, 0x45,
+    0xb0, 0xae, 0x52, 0xdc, 0x02, 0x43, 0x15, 0x4c, 0x2f, 0x38, 0x70, 0xb5, 0xb6, 0xd1, 0x6b, 0x54,
+    0x20, 0x67, 0x1e, 0x04, 0xce, 0xbc, 0x99, 0x14, 0xa5, 0xca, 0x30, 0xbd, 0xc8, 0x7f, 0x77, 0x77,
+    0xb7, 0xb7, 0x5b, 0x9b, 0x8d, 0x40, 0xe0, 0xf5, 0x12, 0x19, 0x30, 0x11, 0x1f, 0xfa, 0xc2, 0x2d,
+    0x53, 0xda, 0x76, 0x76, 0xfa, 0x3b, 0x06, 0xd7, 0x41, 0x88, 0x4e, 0xe0, 0x87, 0x73, 0xe1, 0x56,
+    0xbb, 0xb6, 0x33, 0x11, 0xce, 0x8b, 0xeb, 0xea, 0xbb, 0xbb, 0xc3, 0x37, 0x87, 0xbb, 0xef, 0x46,
+    0xdf, 0xdd, 0xab, 0xe8, 0x3b, 0x93, 0xaa, 0x5a, 0xdf, 0xdd, 0xde, 0xee, 0xd6, 0xbd, 0xed, 0xd5,
+    0xfa, 0xce, 0xc9, 0xbc, 0x31, 0x7d, 0xbb, 0xde, 0xb9, 0xe7, 0xca, 0xac, 0x5e, 0x5b, 0x0c, 0x4b,
+    0xa7, 0xa2, 0x0a, 0xbf, 0xba, 0xe4, 0x51, 0x44, 0xf6, 0xf6, 0x86, 0x02, 0xc8, 0x0b, 0x8a, 0x3e,
+    0x75, 0x9d, 0xb0, 0xac, 0xfd, 0xca, 0xfa, 0x27, 0x2f, 0x79, 0x7c, 0x31, 0x4a, 0xe9, 0xfa, 0xa0,
+    0xb2, 0x0a, 0x3c, 0x65, 0x57, 0x8c, 0x05, 0x4b, 0x13, 0xae, 0x1b, 0x6c, 0x27, 0x11, 0x0f, 0x56,
+    0xdc, 0x2d, 0x3a, 0x0a, 0xa9, 0xaa, 0x78, 0xd7, 0x20, 0x71, 0xef, 0xde, 0xbd, 0x0a, 0xec, 0x7c,
+    0xb5, 0x36, 0x9c, 0x81, 0x91, 0x97, 0xb8, 0xe2, 0x56, 0x99, 0xc1, 0x1b, 0x5c, 0xc8, 0x5e, 0xc3,
+    0x69, 0xb3, 0x9a, 0xdf, 0x48, 0x58, 0x70, 0xe7, 0x54, 0x09, 0xeb, 0x2a, 0xce, 0xbc, 0xcc, 0x6f,
+    0x97, 0xa5, 0x35, 0x5d, 0x34, 0xa5, 0x3c, 0xb2, 0x27, 0x70, 0x82, 0x8f, 0xa7, 0xe8, 0x1c, 0x4f,
+    0x84, 0x22, 0x1e, 0x83, 0x02, 0x72, 0x25, 0xae, 0xaa, 0x1e, 0xb5, 0x93, 0xab, 0xd5, 0x59, 0x52,
+    0xac, 0x5e, 0xde, 0x91, 0x01, 0x51, 0x95, 0xc3, 0xc4, 0xce, 0xa8, 0x37, 0x1a, 0xd5, 0x54, 0x99,
+    0x37, 0x4c, 0x54, 0xda, 0x4f, 0x3a, 0x9d, 0xed, 0x6d, 0xc7, 0xb9, 0x46, 0xd1, 0x80, 0x59, 0x29,
+    0xe5, 0x29, 0xd5, 0x45, 0x4b, 0x6e, 0x9b, 0x14, 0x0d, 0xdd, 0x42, 0x51, 0xae, 0x73, 0x48, 0x85,
+    0x15, 0xb3, 0x7c, 0x28, 0x9d, 0xe4, 0x8a, 0x97, 0x40, 0xbc, 0x8c, 0x07, 0x50, 0xa7, 0xd5, 0xa4,
+    0x7e, 0x77, 0x4b, 0xb8, 0x2e, 0xaf, 0xac, 0xc6, 0x35, 0x2b, 0xf9, 0x75, 0xbd, 0x53, 0x7b, 0x5d,
+    0xaf, 0x54, 0x69, 0x89, 0xe1, 0x45, 0x5e, 0x26, 0x3d, 0x23, 0x63, 0x77, 0xfb, 0xfd, 0x9d, 0xcd,
+    0xad, 0x45, 0xa0, 0xad, 0xbb, 0x89, 0x77, 0x49, 0xd8, 0x2d, 0xe9, 0xfc, 0x3d, 0x29, 0x6e, 0x4d,
+    0xb5, 0x81, 0x87, 0xd9, 0x71, 0x38, 0x37, 0xaf, 0xdf, 0x35, 0x7d, 0x10, 0x70, 0x60, 0x47, 0xd8,
+    0x43, 0x91, 0xce, 0x85, 0x08, 0x6a, 0x50, 0x3f, 0x53, 0xc8, 0x42, 0x6d, 0x5a, 0x88, 0xe6, 0xa2,
+    0xd3, 0x69, 0x36, 0x74, 0x1f, 0xa0, 0x2a, 0x4c, 0x4b, 0x9a, 0xd0, 0x5b, 0xce, 0xb9, 0x3f, 0x13,
+    0xe5, 0x26, 0x46, 0xa1, 0x5f, 0x34, 0x0d, 0x83, 0x90, 0x38, 0xa7, 0x4d, 0x32, 0x76, 0x6d, 0x19,
+    0x52, 0x89, 0x29, 0xf4, 0x38, 0xf6, 0xe0, 0x1c, 0xfc, 0x6d, 0xa7, 0x62, 0x1a, 0x61, 0x50, 0x61,
+    0xf4, 0xce, 0xa6, 0x01, 0x5a, 0x72, 0x14, 0xe3, 0x3f, 0x98, 0xe7, 0x51, 0xc9, 0xae, 0x86, 0xa3,
+    0x12, 0x0a, 0x27, 0xca, 0x90, 0x2a, 0x63, 0x97, 0x8a, 0x49, 0x59, 0x31, 0xe6, 0xc1, 0xd3, 0xa9,
+    0xd8, 0x55, 0x9d, 0x11, 0x45, 0x87, 0xef, 0xaa, 0xe5, 0x8e, 0x8f, 0x88, 0x5a, 0x41, 0xdf, 0x75,
+    0x7a, 0xfd, 0xc5, 0x2a, 0xcb, 0xdc, 0x51, 0x4d, 0xdb, 0xd9, 0xdd, 0x24, 0xc5, 0xbd, 0x5a, 0xfb,
+    0xc9, 0x54, 0xb8, 0x1e, 0x67, 0x4d, 0xa3, 0x75, 0xb4, 0xdd, 0x01, 0x71, 0xd7, 0x71, 0x8b, 0xec,
+    0xc6, 0x15, 0x2e, 0x21, 0x0b, 0x3d, 0xad, 0x52, 0x44, 0xa8, 0x1e, 0x53, 0x65, 0x0c, 0xac, 0xea,
+    0x0e, 0x55, 0x16, 0xe7, 0x25, 0x0c, 0x2b, 0xe4, 0xeb, 0xac, 0x58, 0xed, 0xeb, 0x62, 0xb5, 0x52,
+    0xa0, 0x7b, 0x52, 0x20, 0x1e, 0xb8, 0xac, 0x19, 0xc6, 0x98, 0x94, 0xb8, 0x04, 0x74, 0x1f, 0x86,
+    0xe0, 0xb6, 0x1e, 0x89, 0x7a, 0x69, 0x0b, 0x3d, 0x40, 0x8c, 0x13, 0x1b, 0xc0, 0x2c, 0x4e, 0x17,
+    0xd4, 0xb0, 0x58, 0x37, 0x1b, 0xac, 0x80, 0x90, 0x8a, 0x95, 0x9d, 0xed, 0x5d, 0xa9, 0xdb, 0x6a,
+    0x1d, 0xf6, 0x94, 0x9e, 0x5e, 0xad, 0x1d, 0xb4, 0x55, 0x4b, 0xf4, 0xa0, 0xad, 0x1a, 0xb4, 0xc8,
+    0x1f, 0xfc, 0x01, 0xe9, 0x31, 0xec, 0x93, 0x64, 0xd0, 0xc8, 0x48, 0x60, 0x87, 0x75, 0xd2, 0x3d,
+    0xfc, 0xfe, 0xdb, 0xaf, 0xfe, 0xc4, 0x64, 0x8f, 0x55, 0xb5, 0x57, 0x61, 0xb0, 0xb0, 0x03, 0x75,
+    0x0a, 0x8b, 0x8f, 0x11, 0x0d, 0xd8, 0x65, 0x38, 0x8b, 0x65, 0x33, 0xd6, 0x89, 0x85, 0x0b, 0x5a,
+    0xf1, 0xb8, 0x9f, 0xb0, 0x34, 0x64, 0xca, 0x35, 0x59, 0x3a, 0xf1, 0x12, 0x26, 0x9b, 0xbb, 0x38,
+    0x4c, 0xeb, 0x03, 0x40, 0x83, 0x30, 0x7e, 0x01, 0x6c, 0x01, 0x59, 0x45, 0xdc, 0x73, 0x89, 0x17,
+    0x89, 0x66, 0x27, 0x78, 0x84, 0xc1, 0xa1, 0x81, 0x71, 0x0d, 0x46, 0x32, 0x0d, 0x1a, 0x3a, 0x06,
+    0x09, 0x0b, 0x89, 0xf9, 0xde, 0xe1, 0x77, 0xff, 0xf8, 0x8d, 0x64, 0xe6, 0x48, 0xef, 0x01, 0xf6,
+    0x7b, 0x8b, 0xec, 0x23, 0x76, 0xe1, 0x16, 0x2a, 0x7b, 0xcc, 0x71, 0x02, 0x93, 0xc6, 0xe1, 0x63,
+    0xc9, 0xe0, 0x1e, 0x28, 0x10, 0x56, 0x54, 0x2d, 0x24, 0x08, 0x69, 0x14, 0xb9, 0x3e, 0x3d, 0x3d,
+    0x79, 0xd0, 0x38, 0xcc, 0xf6, 0x18, 0xc2, 0x5d, 0xe3, 0xe8, 0x93, 0xa7, 0xec, 0xbe, 0xeb, 0xc2,
+    0xa5, 0x36, 0xb9, 0xda, 0xe9, 0x5e, 0xa4, 0x96, 0x2f, 0x3d, 0xb9, 0x88, 0x60, 0x78, 0xbe, 0x2a,
+    0xc9, 0x64, 0x47, 0x4f, 0x7e, 0xc8, 0x34, 0x5e, 0x44, 0x96, 0x06, 0x0b, 0x03, 0xc7, 0xf7, 0x9c,
+    0x17, 0xe6, 0x04, 0x6a, 0xb9, 0xb9, 0x0e, 0x84, 0xbe, 0xff, 0xf6, 0x2f, 0x5f, 0xb1, 0x07, 0xd9,
+    0x38, 0x1c, 0x2e, 0x89, 0xad, 0x38, 0x22, 0xc3, 0x16, 0x83, 0x3a, 0x8d, 0x1d, 0xe5, 0x6e, 0xa4,
+    0xe8, 0xff, 0xed, 0xeb, 0xff, 0xfd, 0xf7, 0x8f, 0xec, 0x08, 0x27, 0x99, 0x31, 0x6b, 0x9e, 0xa4,
+    0x04, 0x2e, 0xb9, 0x13, 0x41, 0x80, 0xb1, 0xa3, 0xde, 0x75, 0x0c, 0x4d, 0xe5, 0xb8, 0x41, 0x56,
+    0xa2, 0xbb, 0xf4, 0xe1, 0x29, 0x0e, 0x66, 0x9e, 0x35, 0xf2, 0xc6, 0xb3, 0x98, 0xa2, 0x1f, 0x03,
+    0x8c, 0x16, 0x54, 0x90, 0xc0, 0xfb, 0x73, 0x23, 0xe7, 0x43, 0x3b, 0x87, 0x64, 0x71, 0x99, 0x6a,
+    0xb2, 0xdb, 0xa0, 0xa1, 0x1a, 0x1a, 0x53, 0x4e, 0x0d, 0xe7, 0x82, 0x66, 0x88, 0x32, 0x0d, 0x7f,
+    0x00, 0x2b, 0xc9, 0x0e, 0xbf, 0x66, 0xcf, 0xf0, 0x33, 0xcb, 0xd7, 0x55, 0xe8, 0xc8, 0xe0, 0x53,
+    0x61, 0x20, 0x70, 0x45, 0x7e, 0xf3, 0xe4, 0x19, 0x3b, 0x7a, 0xf2, 0xf8, 0xe1, 0xc9, 0x87, 0x9f,
+    0x3c, 0x3b, 0x66, 0x8f, 0x8f, 0x9f, 0xb3, 0xe7, 0x27, 0x0f, 0x4f, 0x94, 0x4f, 0x95, 0x34, 0x4c,
+    0xd5, 0x2d, 0x32, 0x30, 0xf7, 0x46, 0xde, 0x43, 0xf8, 0x50, 0x52, 0x62, 0x8e, 0xd0, 0x38, 0x21,
+    0x33, 0x34, 0x8c, 0x81, 0x2a, 0x50, 0x29, 0x87, 0xa7, 0xb2, 0x9d, 0x49, 0xfa, 0xcc, 0x43, 0x8d,
+    0x96, 0xa1, 0xce, 0xe5, 0x2c, 0x69, 0x8e, 0x74, 0x28, 0xdf, 0x1c, 0xc9, 0xe7, 0x58, 0xfc, 0x72,
+    0xe6, 0x81, 0x49, 0x61, 0x5d, 0x18, 0xa1, 0x88, 0x8c, 0x62, 0x61, 0xd0, 0x68, 0x1c, 0x1e, 0xa1,
+    0xaa, 0x98, 0xea, 0x08, 0x21, 0xd6, 0x00, 0x2a, 0x07, 0x1a, 0x6b, 0x92, 0x83, 0xb6, 0x5c, 0x8f,
+    0x42, 0xc8, 0x13, 0x56, 0x9a, 0x21, 0x6b, 0x2d, 0x19, 0x86, 0x40, 0x9a, 0x8a, 0x65, 0xf2, 0x4f,
+    0x52, 0xfb, 0x29, 0x1e, 0xf4, 0x38, 0x3b, 0x28, 0x53, 0xb9, 0xa1, 0x11, 0xd5, 0x6a, 0x92, 0x66,
+    0xcb, 0x3e, 0x54, 0xfb, 0x23, 0x92, 0x0b, 0x60, 0xbe, 0xd5, 0x6a, 0x55, 0x78, 0xf6, 0x2a, 0x15,
+    0x67, 0xdd, 0xf9, 0x43, 0xd2, 0xef, 0x53, 0xdd, 0x75, 0xce, 0x15, 0x6c, 0x50, 0x29, 0xb7, 0xe3,
+    0x91, 0x16, 0xb5, 0xfa, 0x59, 0xa9, 0xd5, 0x4f, 0x7c, 0xe7, 0x9f, 0xa4, 0x49, 0xf2, 0xcf, 0xda,
+    0x2c, 0x0c, 0xe4, 0x70, 0xc4, 0x04, 0xaa, 0x2f, 0x01, 0xac, 0xc8, 0x14, 0x41, 0x6c, 0xe4, 0x5c,
+    0x2d, 0xd7, 0x7a, 0xa9, 0x57, 0x6e, 0x68, 0x5e, 0xce, 0x68, 0x71, 0xa4, 0xee, 0xbf, 0xfe, 0x15,
+    0x40, 0x43, 0x2d, 0x0e, 0x2c, 0xc5, 0x1f, 0xdd, 0x02, 0x30, 0xf1, 0x07, 0xc7, 0x16, 0x83, 0x8c,
+    0x86, 0x29, 0xc8, 0xc0, 0xd8, 0x7f, 0x60, 0x47, 0xf8, 0xd1, 0x88, 0xb1, 0x3a, 0xc0, 0x4b, 0x66,
+    0xc3, 0xa9, 0x97, 0x36, 0x08, 0x3b, 0xd8, 0x7b, 0x7a, 0x83, 0xc9, 0x2c, 0x9a, 0xb0, 0x84, 0x1c,
+    0x74, 0xc7, 0x51, 0xa8, 0x21, 0x9f, 0x0f, 0x4d, 0xdb, 0x97, 0xfc, 0x45, 0x96, 0x9f, 0xac, 0xa6,
+    0xfc, 0x94, 0x5d, 0xe9, 0x26, 0xf6, 0x56, 0xed, 0x91, 0x97, 0x6e, 0x30, 0x28, 0x21, 0xa0, 0xa0,
+    0x69, 0x76, 0xb7, 0xa0, 0x40, 0xd8, 0xc0, 0xca, 0x74, 0x7d, 0x1d, 0x36, 0x67, 0xb5, 0x29, 0x33,
+    0x6b, 0x53, 0x2a, 0xb6, 0xd0, 0x58, 0x9c, 0x4d, 0x20, 0x12, 0x06, 0x8d, 0xb6, 0xcb, 0x93, 0xc9,
+    0x30, 0xe4, 0x68, 0x93, 0x32, 0x1b, 0xb2, 0x9f, 0xc8, 0x8a, 0x55, 0x0f, 0xab, 0xea, 0x31, 0xb3,
+    0x8a, 0x4a, 0x9e, 0xd1, 0x25, 0xc3, 0x15, 0x4e, 0x18, 0xab, 0x92, 0x8a, 0xe2, 0x80, 0x95, 0x7a,
+    0xb2, 0x6c, 0xb1, 0xc0, 0x67, 0x15, 0xd7, 0x13, 0xb4, 0xd2, 0x37, 0xbf, 0x67, 0x0f, 0x34, 0xb7,
+    0x07, 0x6d, 0x5e, 0x90, 0x82, 0x2a, 0x91, 0x1f, 0xbf, 0x08, 0x7f, 0xfd, 0x37, 0x26, 0xbd, 0x07,
+    0xb2, 0x6e, 0xc2, 0x72, 0x48, 0xca, 0x51, 0x74, 0xf0, 0xc4, 0x89, 0xbd, 0x08, 0x70, 0x6c, 0x34,
+    0x0b, 0xc8, 0x15, 0x19, 0x02, 0x0b, 0xe5, 0x2a, 0xdc, 0xd1, 0xc4, 0x12, 0xf1, 0x1c, 0x92, 0xe6,
+    0xc5, 0x24, 0x66, 0x03, 0x00, 0xc2, 0x39, 0xfb, 0xd9, 0xc7, 0x8f, 0x3e, 0x4a, 0xd3, 0xe8, 0x19,
+    0x44, 0xab, 0x48, 0xd2, 0x26, 0x5c, 0xf0, 0x60, 0xae, 0x15, 0x46, 0x22, 0x68, 0x5a, 0x1f, 0x1e,
+    0x9f, 0x59, 0x1b, 0xcc, 0x6a, 0x63, 0xea, 0x83, 0x87, 0x34, 0x9e, 0x09, 0x3d, 0x1f, 0x20, 0x5d,
+    0x20, 0xa1, 0xcf, 0x21, 0xca, 0xde, 0x88, 0x35, 0x71, 0x56, 0xdd, 0xcb, 0x07, 0x83, 0x01, 0x38,
+    0x4d, 0x47, 0x9f, 0x49, 0x85, 0xf7, 0x80, 0xfd, 0xf4, 0xf4, 0xc9, 0xe3, 0x56, 0x84, 0xdf, 0x07,
+    0xa0, 0xb5, 0x00, 0xa8, 0x11, 0xd4, 0x1f, 0xe2, 0x0c, 0x84, 0x06, 0xe2, 0x48, 0x02, 0x17, 0xe6,
+    0xd7, 0x58, 0xdc, 0xee, 0x86, 0xce, 0x6c, 0x0a, 0x9a, 0x68, 0x8d, 0x45, 0x7a, 0xec, 0x0b, 0x7c,
+    0xfc, 0xe0, 0xf2, 0xc4, 0x6d, 0x5a, 0x85, 0xf2, 0xd0, 0x5a, 0x6f, 0x91, 0x0d, 0x5b, 0xca, 0x84,
+    0x70, 0x98, 0x45, 0x46, 0xb4, 0xf6, 0xaf, 0x40, 0x01, 0xb3, 0x31, 0x50, 0x40, 0xe5, 0x1f, 0xc9,
+    0x9b, 0x2a, 0xec, 0x97, 0xac, 0xcc, 0x62, 0x6c, 0xb8, 0x7c, 0x8e, 0xe9, 0x66, 0x09, 0xa5, 0xac,
+    0xec, 0xaa, 0xa6, 0xe2, 0x45, 0x9f, 0x73, 0x39, 0xbf, 0x84, 0x46, 0xb9, 0x3e, 0xa9, 0x12, 0x09,
+    0xfd, 0x08, 0x24, 0x7a, 0xc5, 0x84, 0x9f, 0x08, 0x96, 0x29, 0x6c, 0xc2, 0x93, 0xcf, 0x69, 0xfb,
+    0x52, 0x85, 0x5d, 0xe5, 0x80, 0x95, 0x3a, 0xcb, 0xaa, 0x97, 0x6a, 0x49, 0x69, 0x7a, 0x95, 0xb6,
+    0x56, 0x5a, 0xae, 0x28, 0xe6, 0x17, 0xaf, 0x4f, 0xe9, 0x8d, 0x28, 0x1d, 0x7f, 0x64, 0x08, 0x24,
+    0x22, 0x70, 0x9b, 0xd4, 0xfe, 0xc9, 0x62, 0xad, 0x5c, 0x0b, 0xab, 0x90, 0xb8, 0xe5, 0x60, 0x81,
+    0x18, 0x4f, 0x9b, 0xd6, 0xfd, 0x58, 0xe0, 0x75, 0x87, 0x25, 0x33, 0xf5, 0x30, 0xe7, 0xa0, 0x36,
+    0xa8, 0x4b, 0xf2, 0x9d, 0x6c, 0x14, 0x87, 0x53, 0x4a, 0x90, 0xef, 0x5b, 0xeb, 0x48, 0x01, 0x0a,
+    0xba, 0x59, 0x4c, 0xaf, 0xbb, 0xae, 0x1f, 0xb8, 0x39, 0xd9, 0xd7, 0x0b, 0x5f, 0xee, 0x8b, 0x38,
+    0x6d, 0x5a, 0x79, 0x4d, 0x0f, 0x69, 0x3d, 0xe3, 0xd3, 0x02, 0xa2, 0xe0, 0x31, 0x84, 0x72, 0x10,
+    0xce, 0x48, 0x99, 0xf4, 0xa2, 0x0d, 0xa7, 0x36, 0x3f, 0xe4, 0x1e, 0x76, 0xd5, 0x0b, 0xc2, 0x5a,
+    0xa4, 0xbf, 0x7a, 0x85, 0x2e, 0x96, 0xff, 0x57, 0x57, 0x29, 0xed, 0x65, 0x49, 0x5e, 0xa6, 0x1b,
+    0xb7, 0xd1, 0xf7, 0xd9, 0x19, 0xde, 0x41, 0xe7, 0x9e, 0xef, 0x9b, 0xaa, 0x4f, 0x27, 0x42, 0xdd,
+    0x4b, 0x5b, 0xaf, 0xaf, 0x7b, 0x3a, 0xff, 0x8d, 0xa8, 0xdd, 0x50, 0x80, 0x94, 0x0a, 0x24, 0x4a,
+    0x66, 0x8e, 0x03, 0x50, 0x32, 0x9a, 0xf9, 0xfe, 0xe5, 0xb5, 0x0d, 0x20, 0x55, 0xe3, 0x98, 0x1e,
+    0xbf, 0xc2, 0x0e, 0xe5, 0x32, 0x48, 0x41, 0x3a, 0xbd, 0x10, 0x1c, 0xb0, 0xfa, 0xc8, 0x82, 0x79,
+    0x88, 0x26, 0xaa, 0xc7, 0xf7, 0x69, 0x47, 0xf6, 0xdd, 0x8d, 0x25, 0xbb, 0xf4, 0x9a, 0xe2, 0x4e,
+    0x5d, 0x73, 0x2d, 0xdb, 0xa9, 0xd7, 0xa0, 0x3c, 0xc4, 0x9f, 0x52, 0xe9, 0x12, 0x0e, 0x69, 0x85,
+    0xa5, 0x32, 0xcf, 0x2d, 0x12, 0xe8, 0xcb, 0x2f, 0xd9, 0x2d, 0xcd, 0x03, 0x4a, 0x2a, 0xd7, 0xd4,
+    0xe3, 0x64, 0x61, 0x9e, 0xf2, 0x3b, 0xce, 0xaa, 0x26, 0x5a, 0x3e, 0x5f, 0x44, 0x4a, 0xeb, 0x29,
+    0x18, 0x01, 0xcc, 0xa3, 0xae, 0x36, 0x5c, 0xdf, 0x4a, 0xa8, 0x9d, 0x44, 0x49, 0x3f, 0xd3, 0x15,
+    0x90, 0xc8, 0x1d, 0x51, 0x8b, 0xd8, 0xca, 0xde, 0x53, 0x0d, 0xc8, 0xc5, 0xf6, 0xf3, 0x99, 0xd2,
+    0x41, 0x67, 0xe0, 0xa2, 0xf2, 0xea, 0x50, 0xe6, 0xf5, 0xea, 0xb2, 0xc8, 0xd7, 0x80, 0xb5, 0xb2,
+    0xa8, 0x23, 0x74, 0x87, 0x07, 0xfd, 0xb0, 0xd5, 0x62, 0x4a, 0xc2, 0x39, 0xf7, 0x52, 0x3c, 0xfa,
+    0xea, 0x21, 0xf4, 0xf4, 0xc9, 0xa9, 0x8a, 0x21, 0x14, 0xa9, 0x18, 0x43, 0x89, 0x48, 0xd5, 0x9e,
+    0x8f, 0x04, 0x87, 0xa2, 0x0b, 0xc2, 0x43, 0xf2, 0x61, 0x9f, 0x41, 0x8d, 0x8d, 0xbb, 0xe0, 0xd6,
+    0x02, 0xc5, 0x3b, 0x45, 0x43, 0xfb, 0xc2, 0x9e, 0xcf, 0xe7, 0x36, 0x5d, 0x8c, 0x66, 0xb1, 0x2f,
+    0x02, 0x27, 0x74, 0x85, 0x6b, 0x2d, 0x0d, 0xc7, 0x2a, 0x05, 0x8f, 0x20, 0x46, 0x96, 0x68, 0xb8,
+    0xf2, 0x12, 0x70, 0x05, 0x65, 0xd7, 0x47, 0x7e, 0x8d, 0x19, 0xe4, 0xeb, 0x82, 0x5a, 0x33, 0x60,
+    0xaf, 0xcb, 0x62, 0x77, 0x59, 0xb9, 0xae, 0x32, 0xb0, 0xe0, 0x66, 0xbe, 0xfa, 0xdd, 0x3f, 0xbf,
+    0xaa, 0x23, 0xac, 0x51, 0x03, 0xf2, 0x63, 0x1c, 0x13, 0xb5, 0x77, 0xa5, 0xcd, 0x9b, 0x89, 0x96,
+    0x1f, 0xc1, 0xa4, 0x00, 0xb6, 0xf6, 0x5b, 0xec, 0x9b, 0xf0, 0x31, 0xf7, 0xf0, 0x6c, 0x13, 0x1a,
+    0x09, 0xd5, 0x06, 0xa8, 0x0e, 0xe9, 0x4f, 0x9f, 0x3c, 0x3b, 0x39, 0x0a, 0xa7, 0xa0, 0x13, 0x7c,
+    0x2b, 0x89, 0x73, 0xeb, 0x30, 0x65, 0xbd, 0xa7, 0xa3, 0xb7, 0x6e, 0x65, 0x86, 0x30, 0x45, 0xa8,
+    0x5d, 0x68, 0xeb, 0x28, 0xa8, 0xd5, 0x7d, 0x9d, 0x65, 0x60, 0xa6, 0xd7, 0xdc, 0x04, 0xfe, 0xf4,
+    0xde, 0x45, 0x5c, 0xc9, 0x66, 0x6a, 0x34, 0xb7, 0x0a, 0x5a, 0x54, 0xe9, 0x74, 0xfd, 0x0c, 0x4a,
+    0x07, 0xbf, 0x5e, 0x06, 0xbd, 0xa1, 0xcf, 0x2c, 0x8f, 0xb3, 0x25, 0xe1, 0x55, 0xa5, 0x45, 0xe5,
+    0xee, 0x75, 0x6a, 0xac, 0xec, 0xd2, 0xbd, 0x2d, 0x77, 0xbf, 0x7e, 0x00, 0xff, 0xd8, 0x25, 0xba,
+    0x41, 0x00, 0x17, 0x03, 0x0e, 0x42, 0xe2, 0x14, 0xae, 0xda, 0xdc, 0x3f, 0x81, 0xec, 0xd5, 0x8c,
+    0x21, 0x80, 0xb5, 0x4b, 0xe1, 0x33, 0x3b, 0x64, 0x76, 0x1f, 0x5c, 0x49, 0x26, 0x60, 0x94, 0xed,
+    0x9b, 0xff, 0x28, 0xe4, 0xd6, 0xd3, 0xdb, 0xcb, 0xa7, 0x77, 0x8a, 0xd3, 0xff, 0xca, 0xb2, 0x39,
+    0x7d, 0xfc, 0x9d, 0x55, 0x60, 0xa6, 0xd8, 0x4b, 0x54, 0xa1, 0xaf, 0xbf, 0x93, 0xb6, 0x24, 0x8e,
+    0xd5, 0x92, 0x2c, 0xf0, 0x65, 0x51, 0xb1, 0xb2, 0x32, 0xdb, 0x57, 0xd0, 0x42, 0x6d, 0xcd, 0x12,
+    0xb8, 0x40, 0x60, 0xc6, 0x97, 0xb2, 0x2d, 0x1b, 0x42, 0x96, 0x35, 0xbf, 0x57, 0x27, 0x0b, 0x4e,
+    0x3a, 0xb1, 0xde, 0x9a, 0x39, 0xd5, 0x45, 0x48, 0x91, 0xfc, 0xd5, 0x8e, 0x7b, 0x60, 0xd1, 0xf8,
+    0xa3, 0xb3, 0x8f, 0x1f, 0x21, 0xbd, 0x85, 0xa6, 0x6e, 0xa1, 0x17, 0xaa, 0x3a, 0xb8, 0x0a, 0x5f,
+    0x50, 0x7d, 0xa7, 0xf8, 0x1e, 0xad, 0x16, 0x65, 0xb2, 0x15, 0x25, 0xac, 0xc1, 0xf1, 0x1c, 0x6a,
+    0xf2, 0x55, 0xda, 0x61, 0xa8, 0x76, 0x0d, 0x7d, 0xff, 0x7e, 0x8a, 0x5d, 0xb5, 0x14, 0x41, 0xb5,
+    0x23, 0x47, 0xa7, 0xfc, 0xe2, 0x29, 0x4c, 0xe0, 0x48, 0x17, 0x86, 0x32, 0x53, 0xe2, 0xea, 0x87,
+    0x61, 0xfc, 0x4c, 0x24, 0x33, 0x3f, 0x95, 0xc6, 0x34, 0x09, 0xdc, 0xbd, 0x7b, 0x13, 0x48, 0x2c,
+    0xb2, 0x79, 0xd3, 0x4e, 0x8c, 0x6e, 0x80, 0x5f, 0xa9, 0x1b, 0xa3, 0x17, 0xb7, 0xa0, 0x7c, 0x1a,
+    0xa7, 0x13, 0xa2, 0xd5, 0x61, 0xef, 0xbd, 0x57, 0x54, 0xc7, 0x41, 0xa6, 0x07, 0x82, 0x5d, 0x91,
+    0x9e, 0x79, 0x53, 0x11, 0xce, 0x20, 0xcd, 0x15, 0xd4, 0xb0, 0x81, 0x5f, 0xcd, 0xe9, 0xac, 0x9b,
+    0x05, 0x6d, 0xad, 0x23, 0xa9, 0xbc, 0x51, 0xed, 0x47, 0x0a, 0x82, 0x16, 0x1d, 0xa9, 0x38, 0xb1,
+    0xdc, 0x93, 0x6c, 0x9b, 0xa9, 0xf7, 0x0e, 0x2a, 0xe6, 0x98, 0x6d, 0x9b, 0x2e, 0x55, 0x2b, 0xbe,
+    0x94, 0xf1, 0x0a, 0x27, 0x3c, 0x0e, 0x73, 0x65, 0x8f, 0xb0, 0x69, 0x08, 0xe8, 0x74, 0x06, 0xb0,
+    0xf4, 0x4c, 0x0a, 0x65, 0x1e, 0x96, 0xe5, 0x90, 0xec, 0x44, 0x28, 0x5b, 0x8f, 0xb9, 0x33, 0x69,
+    0x66, 0x96, 0x55, 0x33, 0xda, 0xc0, 0xea, 0x63, 0x8b, 0x2e, 0x2d, 0x60, 0x10, 0xf3, 0x73, 0x2b,
+    0x8d, 0xbd, 0x29, 0xb8, 0xc2, 0x2d, 0x60, 0xd7, 0xb2, 0xb4, 0xe1, 0x15, 0x7b, 0x46, 0x94, 0xc3,
+    0x25, 0x90, 0xa7, 0x42, 0x41, 0x43, 0xd3, 0x92, 0x0b, 0x30, 0xbe, 0xe5, 0x93, 0xbc, 0x80, 0x91,
+    0x83, 0xe6, 0xb4, 0xa5, 0xe3, 0x7a, 0x0e, 0x51, 0x2a, 0xc2, 0xa7, 0x5e, 0x46, 0x30, 0xba, 0xaf,
+    0xd0, 0x0b, 0x0a, 0x39, 0x83, 0x80, 0x70, 0xf0, 0xa6, 0x7e, 0x8b, 0xbc, 0xe8, 0x7d, 0x4a, 0x16,
+    0x7f, 0xb6, 0xd8, 0x1e, 0x3d, 0x7c, 0x63, 0x65, 0xe7, 0x96, 0xda, 0x4a, 0x78, 0x16, 0x14, 0x55,
+    0x54, 0x84, 0x16, 0xc4, 0xd6, 0x83, 0xf2, 0xeb, 0xab, 0xca, 0x26, 0xf8, 0xde, 0x22, 0x70, 0x8f,
+    0x26, 0x9e, 0xef, 0x36, 0x25, 0x3d, 0x79, 0xbf, 0x95, 0xbf, 0xb5, 0x9e, 0xdf, 0xa1, 0xe3, 0x1d,
+    0x53, 0xa2, 0x4a, 0x14, 0x90, 0x2d, 0xf1, 0x89, 0x15, 0xc9, 0xf9, 0x1d, 0x8a, 0x50, 0x91, 0x76,
+    0xeb, 0x84, 0x28, 0xa7, 0xde, 0x25, 0xe8, 0xb0, 0x29, 0xd1, 0xc1, 0xc8, 0x88, 0xe5, 0x77, 0x3c,
+    0xca, 0x93, 0x75, 0xf5, 0x7c, 0x42, 0x6f, 0xa6, 0xae, 0xd4, 0x4c, 0x90, 0xee, 0x28, 0xe9, 0xad,
+    0xc8, 0x75, 0xa5, 0x57, 0x4e, 0xba, 0x3d, 0x50, 0x38, 0xb4, 0x85, 0xef, 0x74, 0x08, 0x0e, 0x8c,
+    0x33, 0xe8, 0x4b, 0x17, 0x8b, 0x8b, 0x98, 0x85, 0xfe, 0x6c, 0xe1, 0x17, 0xff, 0xd4, 0xe9, 0x8b,
+    0x35, 0xd3, 0xdf, 0x7f, 0x6b, 0x82, 0x40, 0x35, 0x15, 0xa3, 0x23, 0xb0, 0x84, 0x12, 0xbd, 0x02,
+    0x53, 0xcd, 0xca, 0xb9, 0x17, 0xb8, 0xe1, 0xbc, 0xc5, 0x5d, 0xf7, 0xf8, 0x1c, 0x16, 0x3c, 0xf2,
+    0x12, 0x58, 0x87, 0xb7, 0x66, 0x74, 0x1d, 0xc8, 0x24, 0x0b, 0xee, 0x64, 0xbc, 0x2b, 0xd8, 0xa7,
+    0x88, 0xa9, 0xd5, 0xac, 0x7e, 0xd1, 0x6b, 0xad, 0x57, 0x90, 0x97, 0xaf, 0xba, 0xcc, 0x03, 0xe8,
+    0xcb, 0x30, 0xa2, 0x15, 0xc5, 0x02, 0x57, 0x3e, 0x10, 0x23, 0x0e, 0x26, 0xd7, 0xa9, 0xf5, 0x87,
+    0x6c, 0x24, 0x5d, 0xe7, 0x56, 0xf4, 0x86, 0xda, 0x25, 0x72, 0x1e, 0x5f, 0xf5, 0x9c, 0x7a, 0x2f,
+    0xc9, 0x92, 0xf8, 0xa5, 0xe8, 0xaa, 0xf9, 0xe7, 0xf4, 0x26, 0x88, 0x8e, 0x08, 0x7d, 0x77, 0x65,
+    0xd1, 0x0b, 0xe0, 0x91, 0x86, 0xd4, 0xde, 0x7c, 0x33, 0x0d, 0x17, 0x6c, 0x97, 0x16, 0xeb, 0x8b,
+    0x54, 0x46, 0x2a, 0x56, 0x37, 0x7d, 0xfc, 0x9a, 0x19, 0x6b, 0xb7, 0xe1, 0x09, 0x2a, 0x4c, 0x80,
+    0x64, 0x97, 0xa9, 0xd9, 0x1f, 0xa6, 0x33, 0xf3, 0xd6, 0xaf, 0x79, 0x6f, 0xdc, 0x4c, 0xd7, 0x6d,
+    0xc8, 0xdc, 0xfc, 0x52, 0x54, 0xcb, 0x7a, 0x85, 0xd2, 0xb6, 0x0a, 0x4a, 0xbb, 0x7a, 0xab, 0xa7,
+    0xc4, 0x72, 0xc5, 0x46, 0xca, 0x6b, 0x7b, 0x70, 0xeb, 0x9b, 0xf9, 0x2e, 0x7e, 0x41, 0x9e, 0xda,
+    0xef, 0xcc, 0x31, 0xbf, 0x1f, 0x73, 0xab, 0xf8, 0x16, 0xa5, 0x26, 0xb1, 0xbd, 0x6d, 0xad, 0xd4,
+    0x8b, 0x70, 0xad, 0xeb, 0x24, 0x6c, 0xcd, 0xc2, 0xe3, 0x47, 0xc2, 0xbf, 0x0a, 0x41, 0x8a, 0x4c,
+    0x97, 0x21, 0x6b, 0xef, 0xa4, 0xa1, 0x05, 0xff, 0x0e, 0xda, 0xfa, 0x65, 0xf4, 0x41, 0x5b, 0x7d,
+    0xc9, 0xb0, 0x4d, 0xff, 0x37, 0xfc, 0xff, 0x02, 0x28, 0x3c, 0x48, 0x32, 0x3e, 0x00, 0x00,
+};
+const WebAsset index_html_asset = { index_html_gz, sizeof(index_html_gz), "\"1e7d8b4a5f968903\"" };
+
+// dashboard_html.h: 14315 bytes, 2810 gzipped
+const uint8_t dashboard_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0x5b, 0x6f, 0xdb, 0xc8,
+    0x15, 0x7e, 0xd7, 0xaf, 0x98, 0x55, 0x90, 0x88, 0x6a, 0x45, 0x8a, 0x92, 0x2c, 0xf9, 0x22, 0x5b,
+    0x6d, 0x13, 0x27, 0x5d, 0x17, 0x69, 0x62, 0xac, 0x9d, 0x2d, 0xb6, 0x45, 0x1f, 0x46, 0xe4, 0x50,
+    0x9a, 0x98, 0x22, 0x59, 0x72, 0x28, 0xc7, 0x0d, 0xfc, 0xd6, 0xc7, 0x05, 0x0a, 0xb4, 0x45, 0x81,
+    0x2e, 0x50, 0xa4, 0xfb, 0xb0, 0xe8, 0x6b, 0x1f, 0xfb, 0xdc, 0x9f, 0xb2, 0x7f, 0xa0, 0xf9, 0x09,
+    0x3d, 0x67, 0x86, 0x97, 0x21, 0x45, 0xc9, 0xce, 0x26, 0x28, 0x0c, 0x48, 0xe4, 0xf0, 0x9c, 0x33,
+    0xe7, 0xf2, 0x9d, 0xcb, 0x50, 0x3e, 0xfe, 0xec, 0xf4, 0xe5, 0x93, 0xcb, 0xaf, 0xce, 0x9f, 0x92,
+    0xa5, 0x58, 0xf9, 0xb3, 0xd6, 0x71, 0xfe, 0xc5, 0xa8, 0x0b, 0x5f, 0x2b, 0x26, 0x28, 0x71, 0x96,
+    0x34, 0x4e, 0x98, 0x38, 0x69, 0xbf, 0xba, 0x7c, 0x66, 0x1e, 0xb4, 0xf3, 0xe5, 0x80, 0xae, 0xd8,
+    0x49, 0x7b, 0xcd, 0xd9, 0x75, 0x14, 0xc6, 0xa2, 0x4d, 0x9c, 0x30, 0x10, 0x2c, 0x00, 0xb2, 0x6b,
+    0xee, 0x8a, 0xe5, 0x89, 0xcb, 0xd6, 0xdc, 0x61, 0xa6, 0xbc, 0xe9, 0x11, 0x1e, 0x70, 0xc1, 0xa9,
+    0x6f, 0x26, 0x0e, 0xf5, 0xd9, 0xc9, 0xc0, 0xb2, 0x51, 0x8c, 0xe0, 0xc2, 0x67, 0xb3, 0xf3, 0xf3,
+    0xb3, 0x97, 0x97, 0xe4, 0x94, 0x26, 0xcb, 0x79, 0x48, 0x63, 0xf7, 0xb8, 0xaf, 0x96, 0x5b, 0xc7,
+    0x89, 0xb8, 0xc1, 0xef, 0x1f, 0x91, 0xb7, 0xad, 0x15, 0x8d, 0x17, 0x3c, 0x38, 0x22, 0xf6, 0xb4,
+    0x15, 0x51, 0xd7, 0xe5, 0xc1, 0x42, 0x5e, 0xcf, 0xc3, 0x37, 0x66, 0xc2, 0x7f, 0x2f, 0x6f, 0xe7,
+    0x61, 0xec, 0xb2, 0xd8, 0x84, 0xa5, 0x69, 0xeb, 0x16, 0x9e, 0xb8, 0x37, 0xc0, 0xe7, 0x81, 0x4e,
+    0xa6, 0x47, 0x57, 0xdc, 0xbf, 0x39, 0x22, 0x9d, 0x0b, 0xb6, 0x08, 0x19, 0x79, 0x75, 0xd6, 0xe9,
+    0x91, 0x4b, 0xba, 0x0c, 0x57, 0xb4, 0x47, 0x7e, 0xce, 0x02, 0xb6, 0x86, 0xef, 0x2f, 0x59, 0xec,
+    0xd2, 0x00, 0x2e, 0x12, 0x1a, 0x24, 0x66, 0xc2, 0x62, 0xee, 0x81, 0x78, 0xea, 0x5c, 0x2d, 0xe2,
+    0x30, 0x0d, 0xdc, 0x23, 0xe2, 0xf3, 0x80, 0xd1, 0xd8, 0x5c, 0xc4, 0xd4, 0xe5, 0x60, 0xa5, 0x31,
+    0x18, 0x8d, 0x5d, 0xb6, 0xe8, 0x91, 0x07, 0x93, 0xc9, 0x3e, 0x63, 0x94, 0xd8, 0x0f, 0xe1, 0x7a,
+    0x7f, 0xb2, 0x37, 0xa7, 0x43, 0x32, 0xb0, 0xed, 0x87, 0xdd, 0x69, 0x6b, 0xc5, 0x03, 0x73, 0xc9,
+    0xf8, 0x62, 0x29, 0x8e, 0x70, 0x69, 0xbd, 0x9c, 0xb6, 0x5c, 0x9e, 0x44, 0x3e, 0x05, 0x5d, 0x3c,
+    0x9f, 0x81, 0x9e, 0xaf, 0xd3, 0x44, 0x70, 0xef, 0xc6, 0xcc, 0x5c, 0x77, 0x44, 0x1c, 0xf8, 0x64,
+    0xf1, 0xb4, 0x45, 0x7d, 0xbe, 0x08, 0x4c, 0x2e, 0xd8, 0x2a, 0x29, 0x17, 0x0b, 0xcb, 0x07, 0x76,
+    0x24, 0x8d, 0xb4, 0x90, 0x8f, 0x82, 0x62, 0x31, 0x98, 0xaa, 0x2b, 0x7b, 0xbd, 0x04, 0x56, 0x74,
+    0x8f, 0x74, 0x09, 0xaa, 0x9c, 0x82, 0x9c, 0xa1, 0x64, 0x93, 0x3e, 0x5b, 0x52, 0x37, 0xbc, 0x06,
+    0x17, 0xca, 0x35, 0x32, 0xc1, 0x8f, 0x78, 0x31, 0xa7, 0x86, 0xdd, 0x93, 0x7f, 0xd6, 0x08, 0xd5,
+    0xa7, 0x6f, 0x54, 0xf4, 0x8e, 0xc8, 0x81, 0x2d, 0x59, 0xb3, 0x3b, 0x34, 0x4f, 0xd3, 0x66, 0x98,
+    0x69, 0xb3, 0x1c, 0x80, 0x16, 0x4e, 0xe8, 0x87, 0xf1, 0x11, 0x79, 0x30, 0x1a, 0x8d, 0xa6, 0x2d,
+    0xc1, 0xde, 0x08, 0x53, 0x9a, 0x52, 0x1a, 0xa1, 0x22, 0x09, 0x61, 0x12, 0x22, 0x5c, 0xe5, 0xa6,
+    0xc8, 0x30, 0x41, 0x20, 0x19, 0xd0, 0xf9, 0x74, 0x15, 0x19, 0x03, 0x6b, 0x1c, 0xb3, 0x55, 0x8f,
+    0x8c, 0xd7, 0xd7, 0x3d, 0x32, 0x94, 0x37, 0x5d, 0x69, 0x71, 0x92, 0xce, 0x25, 0x3c, 0x60, 0xab,
+    0x26, 0xe9, 0xf9, 0xf6, 0x93, 0xc9, 0x64, 0x63, 0xab, 0x51, 0xf3, 0x56, 0xb6, 0x75, 0x28, 0xb7,
+    0x1a, 0xe1, 0x56, 0x03, 0x6b, 0x50, 0x6c, 0xe5, 0x00, 0x18, 0x13, 0xd8, 0xa7, 0x88, 0xd9, 0x22,
+    0xe6, 0xee, 0xb4, 0x85, 0x9f, 0x26, 0x04, 0x06, 0xd6, 0x04, 0x83, 0xc8, 0xf9, 0xe9, 0x2a, 0x00,
+    0xe7, 0xc6, 0x2c, 0x62, 0x54, 0x18, 0x34, 0x15, 0xa1, 0xe9, 0x71, 0xd1, 0x23, 0x10, 0x7d, 0xf0,
+    0xa0, 0x31, 0x18, 0xc3, 0xb6, 0x20, 0xd8, 0x8b, 0xbb, 0x20, 0x76, 0x41, 0x23, 0xb0, 0x79, 0x8c,
+    0x8a, 0xd4, 0xb4, 0x1b, 0x16, 0x31, 0x85, 0x6d, 0x6b, 0xe1, 0xfc, 0x01, 0xd8, 0xab, 0x85, 0x5e,
+    0x6d, 0x59, 0x09, 0x59, 0xb6, 0xb6, 0xc3, 0x8b, 0x05, 0x8a, 0x74, 0xc0, 0x60, 0xc0, 0xc8, 0x70,
+    0x9c, 0x03, 0x66, 0x60, 0x0f, 0xc1, 0xb8, 0xe1, 0x04, 0xa2, 0x34, 0xda, 0xeb, 0x11, 0x85, 0x1c,
+    0x11, 0x43, 0x12, 0x41, 0xbe, 0x87, 0x20, 0x53, 0x5e, 0x7b, 0x61, 0xbc, 0xc2, 0x67, 0x09, 0x61,
+    0x34, 0x61, 0xb5, 0xcc, 0x18, 0x4b, 0xcb, 0x6b, 0x99, 0x81, 0x9f, 0xa6, 0xcb, 0x63, 0xe6, 0x28,
+    0x31, 0xca, 0xcf, 0x3b, 0x32, 0x26, 0xf3, 0xdc, 0xd1, 0x32, 0x5c, 0xcb, 0x74, 0x28, 0xf6, 0xcd,
+    0x54, 0xc0, 0x68, 0x7d, 0x65, 0x98, 0xa0, 0x78, 0x19, 0xdd, 0x23, 0x0a, 0xd2, 0xd7, 0x6c, 0x3b,
+    0xf5, 0x50, 0xa7, 0x36, 0x39, 0x6c, 0x9a, 0xd7, 0x14, 0x1d, 0x41, 0x43, 0x84, 0xcf, 0x01, 0xc2,
+    0x67, 0x24, 0xb1, 0x53, 0x8b, 0xec, 0x81, 0x16, 0x58, 0xd3, 0xa7, 0x73, 0xe6, 0x37, 0x09, 0xb1,
+    0xad, 0x7d, 0x05, 0x79, 0x40, 0x3b, 0x8a, 0x52, 0xb0, 0x04, 0x69, 0x61, 0x44, 0x1d, 0x2e, 0xc0,
+    0x31, 0xb0, 0xd2, 0x2c, 0x5b, 0x86, 0x50, 0xb3, 0x20, 0x8d, 0x22, 0x16, 0x3b, 0xd2, 0xd1, 0x3e,
+    0x13, 0xe0, 0x1d, 0x33, 0x41, 0x19, 0xb2, 0x72, 0xe8, 0xba, 0xac, 0xa9, 0x9f, 0xb2, 0x26, 0x5d,
+    0x06, 0xd6, 0x81, 0x54, 0x65, 0x52, 0xc9, 0x3e, 0x49, 0x76, 0x9d, 0x45, 0x6d, 0x1e, 0xfa, 0xee,
+    0x86, 0x36, 0x63, 0x5d, 0x7a, 0x0a, 0x15, 0xbf, 0x51, 0xb8, 0x9e, 0x6d, 0xc3, 0x0d, 0x1b, 0x0f,
+    0xa4, 0x84, 0x65, 0xba, 0xe2, 0x2e, 0xac, 0x98, 0x1f, 0x92, 0x0d, 0x7b, 0x1e, 0x75, 0x3c, 0xa6,
+    0xb2, 0xc1, 0xb6, 0xbd, 0x21, 0x5c, 0x67, 0xd9, 0x80, 0x12, 0x21, 0x3b, 0x4d, 0x1e, 0xb8, 0x00,
+    0xab, 0x0f, 0x91, 0xe9, 0xd1, 0x7d, 0xfb, 0x30, 0xcb, 0x30, 0x8f, 0xb1, 0xc1, 0x9e, 0xad, 0xc9,
+    0x4c, 0x04, 0x15, 0x69, 0xb2, 0xa5, 0x14, 0x95, 0xd5, 0x7a, 0xa8, 0xca, 0x6e, 0x35, 0x21, 0xed,
+    0xad, 0x35, 0xa0, 0xc1, 0xcf, 0x0d, 0x68, 0x39, 0x18, 0x6b, 0x7e, 0x2c, 0xcb, 0xa3, 0xd4, 0xc8,
+    0x0a, 0x03, 0x34, 0xa8, 0x66, 0xe3, 0x03, 0x77, 0x8f, 0xb9, 0x2e, 0x2d, 0x8b, 0xe4, 0x60, 0x3c,
+    0xde, 0x1f, 0xee, 0xe5, 0xaa, 0x49, 0x70, 0x90, 0x24, 0xf4, 0xb9, 0x4b, 0x1e, 0x38, 0x23, 0x36,
+    0x71, 0xe6, 0x15, 0x91, 0x9e, 0xd7, 0x24, 0xd3, 0x3b, 0x70, 0xf7, 0x75, 0x99, 0xfb, 0xc3, 0x81,
+    0xb3, 0x45, 0xa6, 0x37, 0x76, 0x72, 0x99, 0x3e, 0x4d, 0x84, 0x99, 0x46, 0x2e, 0x64, 0xd9, 0x7d,
+    0x0a, 0xb9, 0x66, 0x3e, 0x24, 0x01, 0x5b, 0x15, 0x8e, 0x13, 0x61, 0xa4, 0x55, 0xce, 0x98, 0x79,
+    0x31, 0x4b, 0x96, 0xe6, 0x5c, 0x04, 0x7a, 0xd9, 0x56, 0x05, 0xa5, 0xb1, 0xa3, 0x6e, 0xad, 0x26,
+    0xf9, 0xbc, 0x21, 0x0b, 0x25, 0xd6, 0xf4, 0xca, 0xe4, 0x81, 0x11, 0xcd, 0xda, 0xc9, 0x47, 0x96,
+    0xe9, 0x7a, 0xa5, 0x55, 0x4e, 0x0b, 0xc2, 0xa0, 0xa1, 0x7b, 0x8f, 0xef, 0xd1, 0xbe, 0xb6, 0x66,
+    0xaa, 0x93, 0xc6, 0x09, 0xee, 0x14, 0x85, 0x5c, 0x59, 0xb8, 0xad, 0x46, 0x0f, 0x93, 0x5a, 0x9f,
+    0xd7, 0xc6, 0x80, 0x91, 0x1a, 0x03, 0x44, 0x98, 0x3a, 0x4b, 0x93, 0x66, 0x95, 0x79, 0x45, 0x03,
+    0x1e, 0xa5, 0x50, 0x30, 0xe1, 0xae, 0x1e, 0x86, 0xa6, 0x6a, 0x2c, 0x27, 0x40, 0x28, 0x31, 0xf6,
+    0xb8, 0xbb, 0x41, 0xde, 0x54, 0x8f, 0x15, 0x3d, 0x98, 0x99, 0xd1, 0xfb, 0x21, 0xc5, 0x28, 0xe4,
+    0xd5, 0xb8, 0x08, 0xb3, 0x72, 0x5a, 0x06, 0x0c, 0x9f, 0x79, 0x22, 0x4f, 0xb2, 0xdc, 0x1a, 0xc4,
+    0x4d, 0xd1, 0x74, 0xf0, 0x26, 0x77, 0xf7, 0xb0, 0xc0, 0xa8, 0x6c, 0x69, 0xc3, 0xf1, 0x18, 0xaa,
+    0x5e, 0xf1, 0x61, 0x5b, 0xe3, 0xb2, 0x9f, 0x2a, 0xc0, 0x15, 0xf4, 0xcd, 0x73, 0xd6, 0x18, 0xdd,
+    0x06, 0x5e, 0x59, 0x51, 0xe5, 0xa1, 0x24, 0xe2, 0x01, 0x19, 0x24, 0x19, 0x3e, 0x60, 0x14, 0xf6,
+    0x70, 0x1a, 0x66, 0x68, 0xcd, 0x4f, 0xaf, 0xd8, 0x8d, 0x17, 0xc3, 0x20, 0x9d, 0x28, 0xaa, 0xb7,
+    0x2d, 0xfb, 0x21, 0x79, 0x4b, 0x34, 0xf3, 0xe3, 0x10, 0xf2, 0x0f, 0xec, 0x07, 0x24, 0x75, 0xa7,
+    0xe4, 0xb6, 0x85, 0x41, 0x69, 0xa4, 0x18, 0x4d, 0x0a, 0x1a, 0xf0, 0x52, 0x40, 0xd7, 0x26, 0xec,
+    0x77, 0xa5, 0x7b, 0x68, 0xee, 0x87, 0xce, 0xd5, 0xce, 0xa9, 0x4c, 0xcb, 0xa7, 0x7a, 0xf9, 0xaa,
+    0x26, 0xbd, 0x77, 0xe8, 0xd1, 0x2d, 0x35, 0x4d, 0x8a, 0x77, 0x99, 0x13, 0xc6, 0x99, 0xf9, 0x2a,
+    0x30, 0x65, 0x42, 0x63, 0x2e, 0xdc, 0xb7, 0xca, 0x6d, 0x62, 0x5b, 0xc7, 0x6d, 0xa9, 0x94, 0x1c,
+    0x2e, 0xee, 0x44, 0x66, 0xee, 0x14, 0x05, 0xcb, 0x1e, 0x29, 0x17, 0x0a, 0xe0, 0x55, 0xec, 0x64,
+    0x87, 0xcc, 0x61, 0x9e, 0x8c, 0xd3, 0x8a, 0xb9, 0x9c, 0x12, 0x43, 0x4b, 0x86, 0x09, 0x26, 0x43,
+    0x17, 0x58, 0x2a, 0x53, 0x78, 0xe9, 0xb6, 0x71, 0x53, 0xd5, 0xd7, 0x3b, 0x24, 0x36, 0x0e, 0x35,
+    0x0f, 0xd6, 0x46, 0xbf, 0x8a, 0x8c, 0xbc, 0x53, 0xe8, 0x13, 0xd3, 0x48, 0x9f, 0xb8, 0xb7, 0xf4,
+    0x60, 0x6d, 0x50, 0xde, 0x32, 0x69, 0x36, 0x5a, 0x75, 0xa8, 0xac, 0xa2, 0xe0, 0x52, 0x23, 0x8c,
+    0xb1, 0x8c, 0x65, 0x51, 0xf4, 0x61, 0x09, 0x52, 0x31, 0x62, 0x68, 0x72, 0x76, 0xba, 0xda, 0x7d,
+    0x20, 0xa9, 0xb9, 0x42, 0xb7, 0x7a, 0xe7, 0x08, 0x3d, 0x52, 0xd3, 0xb2, 0x52, 0xf1, 0xb8, 0x9f,
+    0x9d, 0x02, 0x8f, 0xfb, 0xd9, 0x91, 0x14, 0xf7, 0x86, 0x2f, 0x97, 0xaf, 0x11, 0x25, 0x49, 0x72,
+    0xd2, 0x2e, 0x36, 0xc5, 0x33, 0xe5, 0x72, 0x30, 0x7b, 0xff, 0xee, 0xeb, 0x6f, 0xff, 0xfb, 0xef,
+    0x3f, 0x92, 0x8d, 0x83, 0x25, 0x3c, 0x6b, 0x1d, 0x47, 0x39, 0x5b, 0xee, 0xa1, 0xf6, 0xec, 0x0b,
+    0x06, 0x27, 0x53, 0xc1, 0x57, 0x8c, 0x5c, 0x82, 0x52, 0x0c, 0x80, 0x9b, 0xc6, 0x8c, 0x3c, 0x22,
+    0x9f, 0x67, 0x53, 0x08, 0xf9, 0x65, 0x08, 0x09, 0x1b, 0xc6, 0xc7, 0xfd, 0x28, 0xdb, 0x99, 0xbb,
+    0xc0, 0x2f, 0x1b, 0xe3, 0xe9, 0xe7, 0x97, 0xc3, 0x61, 0xbb, 0x90, 0xa9, 0x26, 0x02, 0xd5, 0x7f,
+    0x41, 0x9d, 0xf7, 0xef, 0xfe, 0xfc, 0x2d, 0x91, 0x24, 0xe4, 0x82, 0x05, 0x50, 0x81, 0xc9, 0x4b,
+    0xf9, 0x08, 0xcc, 0x01, 0x31, 0x35, 0x33, 0xd0, 0x3b, 0xed, 0xcd, 0xb5, 0x86, 0x25, 0x59, 0xfc,
+    0xda, 0xb9, 0xa1, 0x5b, 0x64, 0xa9, 0x59, 0xb3, 0x3d, 0xd3, 0x6d, 0x32, 0xa4, 0x2e, 0xdd, 0x6d,
+    0x1c, 0x72, 0x22, 0x6c, 0x4b, 0xeb, 0x44, 0xc9, 0xd5, 0x9e, 0x99, 0xe6, 0x36, 0x0e, 0x9c, 0xf2,
+    0xda, 0xb3, 0xff, 0xfc, 0xeb, 0x49, 0x4e, 0xd0, 0x4c, 0x47, 0x2a, 0x03, 0xdd, 0x2e, 0x8b, 0xfe,
+    0xf4, 0xcf, 0x3b, 0xcc, 0xc9, 0x83, 0x72, 0x0f, 0x1b, 0xf2, 0x4d, 0xef, 0x36, 0xe0, 0xe1, 0x5d,
+    0xea, 0x57, 0xa7, 0xc7, 0x5d, 0x06, 0xfc, 0xe5, 0xbb, 0xbb, 0x0c, 0x00, 0x59, 0xe4, 0x0c, 0x65,
+    0xdd, 0xc7, 0x04, 0x20, 0x96, 0xb4, 0x3f, 0x24, 0x08, 0x1a, 0xb9, 0x06, 0xd8, 0x8b, 0xc1, 0xc1,
+    0xe3, 0xa1, 0xbd, 0x05, 0xb2, 0x44, 0xa6, 0xdb, 0x49, 0x7b, 0xa3, 0x21, 0x14, 0x60, 0x56, 0xec,
+    0x1f, 0x01, 0xe7, 0x7c, 0x8b, 0xfb, 0xcd, 0xdf, 0xf6, 0xe1, 0xc8, 0x9b, 0x67, 0xf3, 0x37, 0xcc,
+    0xab, 0x13, 0x27, 0x1b, 0x9d, 0x3e, 0x6d, 0x56, 0x28, 0xa3, 0x3e, 0x30, 0x2f, 0x72, 0x4f, 0x7e,
+    0x5c, 0x64, 0x32, 0x72, 0x6d, 0x24, 0x56, 0x1b, 0xe1, 0xc2, 0x2b, 0x75, 0x3f, 0x6b, 0x3d, 0x87,
+    0x1b, 0xa2, 0x9e, 0x82, 0xb7, 0x5e, 0x30, 0x68, 0x5f, 0x85, 0x90, 0x79, 0x0a, 0x75, 0x3d, 0xc8,
+    0xe5, 0x68, 0xe3, 0x54, 0x1b, 0x82, 0xea, 0xf8, 0xdc, 0xb9, 0x2a, 0x56, 0x4f, 0xa9, 0xa0, 0x46,
+    0x17, 0x5d, 0x07, 0x27, 0xc2, 0x40, 0x6e, 0x93, 0x3d, 0xb9, 0x84, 0xae, 0x2d, 0xd1, 0xfb, 0x07,
+    0xf2, 0x85, 0x5a, 0x21, 0x48, 0x0c, 0xe5, 0x17, 0x08, 0x35, 0x0c, 0x65, 0xd3, 0xd7, 0x19, 0x7a,
+    0xba, 0x50, 0x5d, 0x9b, 0xc8, 0xda, 0xb3, 0xc2, 0x44, 0xa5, 0x57, 0xd5, 0xca, 0xbc, 0xe1, 0x26,
+    0x05, 0x0a, 0xaa, 0x6f, 0x57, 0xc8, 0x87, 0xbe, 0x5d, 0xd9, 0xd3, 0xde, 0xae, 0x90, 0xb2, 0x9b,
+    0x92, 0x26, 0xfc, 0x1e, 0x53, 0xb2, 0x04, 0x73, 0x4f, 0xda, 0xfd, 0x76, 0x5d, 0x9f, 0xf6, 0xec,
+    0xfb, 0x6f, 0xfe, 0x86, 0x3d, 0xe3, 0x57, 0xfc, 0x19, 0x27, 0x4f, 0x42, 0x18, 0xd1, 0x16, 0xc7,
+    0x7d, 0xaa, 0xf3, 0xa8, 0xf7, 0x99, 0x0d, 0x9c, 0xef, 0xdf, 0xfd, 0xf5, 0x3b, 0x64, 0x3d, 0x95,
+    0x04, 0x90, 0xd9, 0x5e, 0xa8, 0x58, 0xab, 0xb1, 0x4e, 0x9c, 0x98, 0x47, 0x62, 0x86, 0x47, 0x72,
+    0x79, 0xa2, 0xc8, 0xdc, 0x7c, 0x86, 0x03, 0x18, 0xe0, 0x4b, 0x9e, 0xd5, 0x09, 0x04, 0x36, 0x10,
+    0x17, 0x61, 0x1a, 0x3b, 0xea, 0xf0, 0x4e, 0xd0, 0x0d, 0x89, 0xc0, 0x50, 0x90, 0x13, 0xf2, 0xf6,
+    0x16, 0x86, 0xa4, 0x34, 0x90, 0xe3, 0x0d, 0xc1, 0xe1, 0x8f, 0x8a, 0x2f, 0x11, 0x99, 0x86, 0xc4,
+    0x27, 0x36, 0xe6, 0x98, 0x01, 0x30, 0x03, 0x22, 0x6e, 0x22, 0x16, 0x7a, 0x44, 0x1d, 0xf0, 0x4f,
+    0x4e, 0x4e, 0x48, 0x27, 0x48, 0x57, 0x73, 0x16, 0x77, 0xc8, 0x4f, 0xd4, 0xa2, 0x25, 0xc2, 0x67,
+    0xfc, 0x0d, 0x73, 0x8d, 0x41, 0x97, 0x1c, 0x91, 0x8e, 0x69, 0x76, 0xb0, 0xdd, 0x16, 0xb2, 0x15,
+    0xd2, 0x24, 0x5a, 0xe0, 0x82, 0x76, 0xe5, 0x8b, 0xbd, 0x00, 0x20, 0xa8, 0xf5, 0x3c, 0xd0, 0xc7,
+    0x0d, 0x9d, 0x74, 0x05, 0x0a, 0x5b, 0x0b, 0x26, 0x9e, 0xfa, 0x0c, 0x2f, 0x1f, 0xdf, 0x9c, 0xb9,
+    0x46, 0x47, 0x23, 0xeb, 0xc8, 0x53, 0x8e, 0xc6, 0x9b, 0xd5, 0x8f, 0xbb, 0xb9, 0x15, 0x61, 0xc9,
+    0x8f, 0xa8, 0xc8, 0xe8, 0x76, 0x71, 0x6b, 0x09, 0x5a, 0xf2, 0xe6, 0x9d, 0xe0, 0x1e, 0xfc, 0x39,
+    0xa9, 0xc6, 0x9c, 0xd7, 0xe0, 0xfb, 0x70, 0xe7, 0xb4, 0x55, 0xbd, 0x33, 0x63, 0x3e, 0x4c, 0xfd,
+    0x0d, 0x0f, 0x94, 0x25, 0x61, 0x97, 0x84, 0x92, 0x0a, 0x39, 0xb9, 0x47, 0x64, 0x0c, 0x2d, 0x77,
+    0x29, 0x20, 0x68, 0x8f, 0x1e, 0x91, 0xf2, 0xce, 0x02, 0x2c, 0x70, 0xb7, 0x2b, 0x8f, 0xe0, 0x85,
+    0x6f, 0x2d, 0x1c, 0xe0, 0x9f, 0xa8, 0x03, 0x31, 0x6c, 0xa3, 0xc3, 0x4c, 0xe3, 0xd4, 0xd4, 0x84,
+    0x4d, 0x6a, 0xee, 0xbd, 0x9f, 0x88, 0x9c, 0x09, 0xf9, 0x6b, 0x1e, 0xbe, 0xa7, 0x80, 0x9c, 0x0b,
+    0x24, 0x68, 0x88, 0xb3, 0x64, 0x86, 0xbe, 0x80, 0x43, 0x15, 0xb0, 0x76, 0x2a, 0xed, 0xad, 0x53,
+    0x25, 0xac, 0xee, 0xd2, 0xd9, 0x36, 0xac, 0x61, 0x6e, 0x10, 0xe6, 0x27, 0x6c, 0xa7, 0xa3, 0x54,
+    0x12, 0xed, 0xf6, 0x44, 0x46, 0xb3, 0xdb, 0x5a, 0x45, 0x74, 0xa7, 0x41, 0xea, 0x7d, 0xcc, 0x6e,
+    0x8b, 0xbe, 0xff, 0xe6, 0x1f, 0xb2, 0x32, 0x55, 0x6c, 0x2a, 0x18, 0x6f, 0x35, 0x70, 0x24, 0x83,
+    0x83, 0x39, 0x64, 0x65, 0x01, 0x0f, 0x75, 0x5f, 0x05, 0x48, 0x15, 0xc4, 0x77, 0xc6, 0x28, 0x13,
+    0x51, 0x45, 0x4a, 0x25, 0xb7, 0xef, 0x15, 0xa9, 0x8c, 0xb4, 0x31, 0x56, 0x4d, 0xb3, 0x48, 0x3d,
+    0x5a, 0x3b, 0xb5, 0xae, 0xf8, 0x7a, 0x97, 0x52, 0x75, 0x6f, 0x37, 0x6b, 0x95, 0xfb, 0xbb, 0xa6,
+    0x97, 0xe6, 0x71, 0x95, 0xc8, 0x41, 0x78, 0x0d, 0xe4, 0x01, 0xbb, 0xc6, 0x26, 0xcb, 0x0c, 0xf0,
+    0x4b, 0x99, 0xb4, 0x75, 0x99, 0xd5, 0xd6, 0xdf, 0x21, 0x3f, 0x46, 0x6e, 0xa8, 0xdf, 0xcf, 0x43,
+    0x7c, 0x31, 0x72, 0x09, 0xa7, 0x96, 0x0b, 0x11, 0x43, 0xfb, 0x35, 0x3a, 0x2c, 0x30, 0x5f, 0x5d,
+    0x74, 0x7a, 0xf8, 0x76, 0x00, 0x56, 0x7f, 0x0d, 0xc7, 0x6e, 0xa0, 0xff, 0x59, 0xc2, 0x69, 0xff,
+    0x74, 0x49, 0xaf, 0x68, 0x87, 0xdc, 0x76, 0x2b, 0x55, 0xbe, 0x32, 0x14, 0x14, 0x25, 0x3e, 0x5b,
+    0x7d, 0xac, 0xa6, 0x0a, 0xad, 0xce, 0xfc, 0x2e, 0x65, 0xf1, 0xcd, 0x05, 0xf3, 0x99, 0x03, 0x47,
+    0x21, 0xa3, 0xa3, 0xbf, 0xb8, 0x29, 0x4b, 0x94, 0x36, 0x4e, 0xec, 0xaa, 0x51, 0x1a, 0x99, 0x56,
+    0xde, 0xca, 0xd9, 0x62, 0x67, 0x7d, 0x2b, 0xc9, 0x90, 0xb7, 0xa2, 0xaf, 0x05, 0xe3, 0x04, 0x9d,
+    0xfb, 0xcc, 0x05, 0x01, 0x22, 0x4e, 0xd9, 0x94, 0xf4, 0xfb, 0xe4, 0x3c, 0x96, 0x6d, 0x95, 0xac,
+    0x52, 0x5f, 0xf0, 0x08, 0x8e, 0xc4, 0x72, 0x28, 0x4a, 0x5a, 0x9a, 0x20, 0x4b, 0x4e, 0x23, 0x56,
+    0x36, 0x8c, 0xa0, 0xdb, 0xe5, 0xcb, 0x12, 0x08, 0x99, 0xc7, 0x84, 0xb3, 0x34, 0x3a, 0x7d, 0x1a,
+    0xf1, 0x7e, 0x22, 0xe3, 0xd9, 0xe9, 0xb6, 0x2c, 0xb1, 0x64, 0x81, 0x01, 0xdb, 0x46, 0xa0, 0x38,
+    0xe0, 0x64, 0x46, 0xf2, 0x6b, 0xeb, 0x75, 0x12, 0x06, 0x46, 0x37, 0x27, 0x71, 0x65, 0xe3, 0x9e,
+    0x81, 0x73, 0x2b, 0x8d, 0x1c, 0x97, 0xa7, 0xad, 0x7a, 0x97, 0x85, 0xe0, 0x74, 0xf1, 0x90, 0x8c,
+    0x1b, 0xb2, 0x38, 0x06, 0xe4, 0x48, 0x4e, 0x74, 0x4e, 0x08, 0xca, 0xc9, 0x25, 0xa3, 0xf3, 0x54,
+    0x3e, 0x91, 0x6a, 0x81, 0xf2, 0x52, 0xd4, 0x11, 0x04, 0x5d, 0x3e, 0xad, 0xf7, 0xda, 0xff, 0x73,
+    0x9f, 0xfe, 0x34, 0x35, 0xeb, 0xef, 0x5f, 0xe3, 0x00, 0x16, 0xa8, 0x5f, 0x7e, 0x88, 0x34, 0xf7,
+    0x93, 0xe6, 0x68, 0xb3, 0x7c, 0x74, 0xbd, 0xc7, 0x03, 0xea, 0xfb, 0x37, 0x06, 0x64, 0x83, 0xf4,
+    0xfc, 0x56, 0x68, 0x79, 0xd4, 0x97, 0xbf, 0xae, 0xec, 0x02, 0x10, 0xbe, 0xf6, 0xea, 0x14, 0xf0,
+    0x44, 0xa4, 0x6f, 0xd6, 0xb0, 0xda, 0xb4, 0x2d, 0xd5, 0xa8, 0xa4, 0x28, 0x58, 0x12, 0x8b, 0xf3,
+    0xd0, 0xf7, 0x31, 0xc1, 0x31, 0x47, 0xb1, 0x62, 0x7f, 0xd6, 0x30, 0x3e, 0xe2, 0xb3, 0x86, 0x65,
+    0xd8, 0x26, 0x61, 0x22, 0xbf, 0x33, 0xb4, 0x8c, 0xef, 0x91, 0xb1, 0x6d, 0xdb, 0xd9, 0x5b, 0x16,
+    0x6d, 0xbf, 0x30, 0xd2, 0xb7, 0x73, 0x7c, 0x38, 0x96, 0x15, 0xec, 0x4d, 0xfb, 0x4e, 0xb7, 0x6c,
+    0x1b, 0xa4, 0xbe, 0xbf, 0x69, 0xca, 0x73, 0xbe, 0x66, 0xaa, 0xcc, 0x25, 0x46, 0xb7, 0xf4, 0xb0,
+    0x2a, 0x41, 0x32, 0x59, 0xcf, 0xd4, 0x3f, 0x0a, 0xc8, 0x62, 0xa0, 0xac, 0xbd, 0x86, 0x73, 0x37,
+    0x54, 0xbc, 0xa7, 0xe5, 0x68, 0x8c, 0x9c, 0x55, 0xcf, 0x4c, 0xb3, 0xc9, 0x17, 0x77, 0xd4, 0x66,
+    0xe8, 0xac, 0xc8, 0x6a, 0xac, 0x90, 0xc9, 0xf2, 0x79, 0x82, 0x78, 0xd5, 0x28, 0x2d, 0xea, 0xba,
+    0x92, 0xec, 0x39, 0x4f, 0x20, 0x3e, 0x2c, 0xc6, 0x1a, 0x25, 0xa3, 0x0b, 0xb9, 0x95, 0xdb, 0x60,
+    0x48, 0x06, 0xb5, 0xbb, 0xe6, 0xa7, 0x3c, 0x71, 0xd2, 0x7c, 0x34, 0xfb, 0xc5, 0xc5, 0xcb, 0x17,
+    0x56, 0x84, 0xff, 0x34, 0xa1, 0x38, 0xac, 0x2c, 0xbd, 0xa1, 0x47, 0x12, 0x23, 0xeb, 0x00, 0x88,
+    0x5d, 0x9e, 0x4f, 0xda, 0xdd, 0x4a, 0x81, 0xf8, 0x0d, 0x3e, 0xfc, 0x2d, 0xc8, 0x79, 0x39, 0x7f,
+    0x0d, 0x28, 0xb5, 0x00, 0xea, 0x7c, 0x11, 0x18, 0x6f, 0x6f, 0x7b, 0xa4, 0x4e, 0xd4, 0xcb, 0x04,
+    0xa8, 0x3b, 0x19, 0x4d, 0xad, 0xaa, 0x94, 0xd4, 0x5d, 0x85, 0x2c, 0xdd, 0x60, 0x80, 0xa7, 0xaa,
+    0x31, 0x15, 0x90, 0x4d, 0xeb, 0x68, 0xa8, 0x47, 0xac, 0x66, 0x39, 0x46, 0x88, 0x55, 0x23, 0xa3,
+    0x6f, 0xe2, 0xf8, 0x61, 0x22, 0xfb, 0x5b, 0x2d, 0x28, 0x19, 0x38, 0x6e, 0x5b, 0x45, 0x71, 0xd9,
+    0xf4, 0xff, 0x9a, 0x27, 0x7c, 0xce, 0x7d, 0x18, 0xa6, 0x9c, 0x25, 0x0d, 0x16, 0x4c, 0x0f, 0x44,
+    0x9e, 0x0a, 0x05, 0xfb, 0x92, 0xbb, 0x2e, 0x0b, 0x72, 0x05, 0x2b, 0x4a, 0x6b, 0xf3, 0xc0, 0x26,
+    0x06, 0xa5, 0x16, 0x5d, 0xfc, 0x91, 0x40, 0x82, 0x6c, 0x53, 0x0b, 0xc4, 0x21, 0xec, 0x5c, 0xe7,
+    0x04, 0x16, 0x38, 0x1b, 0x67, 0x47, 0x3a, 0x38, 0xeb, 0xaa, 0x97, 0x92, 0x7d, 0xf9, 0xdf, 0x33,
+    0xff, 0x03, 0x97, 0x9f, 0xe2, 0x49, 0x54, 0x23, 0x00, 0x00,
+};
+const WebAsset dashboard_html_asset = { dashboard_html_gz, sizeof(dashboard_html_gz), "\"78c264476d0a24c3\"" };
+
+// deviceinfo_html.h: 16627 bytes, 2880 gzipped
+const uint8_t deviceinfo_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x1a, 0xdb, 0x6e, 0xdb, 0xc8,
+    0xf5, 0x5d, 0x5f, 0x31, 0x55, 0xe0, 0x4a, 0xda, 0xb5, 0xee, 0x96, 0x9d, 0x58, 0xb2, 0x76, 0x13,
+    0x27, 0xd9, 0x0d, 0x36, 0xde, 0x04, 0xb1, 0xd3, 0xa2, 0x4f, 0xc6, 0x88, 0x1c, 0x4a, 0xb3, 0x26,
+    0x39, 0xdc, 0x21, 0x29, 0xc7, 0xc9, 0xe6, 0xad, 0x7d, 0x29, 0x0a, 0x2c, 0xd0, 0x16, 0x05, 0x5a,
+    0xb4, 0x28, 0xfa, 0xd0, 0x0f, 0xe8, 0x5b, 0x81, 0x02, 0xed, 0xbf, 0xec, 0x0f, 0xb4, 0x9f, 0xd0,
+    0x73, 0x66, 0x86, 0x17, 0x51, 0x94, 0xc4, 0xc4, 0x5e, 0x04, 0xb0, 0xc8, 0x99, 0x73, 0xbf, 0xcd,
+    0x39, 0xc3, 0x4c, 0x7e, 0xf2, 0xf8, 0xc5, 0xe9, 0xc5, 0x2f, 0x5e, 0x3e, 0x21, 0x8b, 0xc8, 0x73,
+    0xa7, 0xb5, 0x49, 0xf2, 0xc3, 0xa8, 0x0d, 0x3f, 0x1e, 0x8b, 0x28, 0xb1, 0x16, 0x54, 0x86, 0x2c,
+    0x3a, 0xa9, 0xbf, 0xbe, 0x78, 0xda, 0xbe, 0x5f, 0x4f, 0x96, 0x7d, 0xea, 0xb1, 0x93, 0xfa, 0x92,
+    0xb3, 0xeb, 0x40, 0xc8, 0xa8, 0x4e, 0x2c, 0xe1, 0x47, 0xcc, 0x07, 0xb0, 0x6b, 0x6e, 0x47, 0x8b,
+    0x13, 0x9b, 0x2d, 0xb9, 0xc5, 0xda, 0xea, 0x65, 0x9f, 0x70, 0x9f, 0x47, 0x9c, 0xba, 0xed, 0xd0,
+    0xa2, 0x2e, 0x3b, 0xe9, 0x77, 0x7a, 0x48, 0x26, 0xe2, 0x91, 0xcb, 0xa6, 0x2f, 0x5f, 0x3e, 0x7b,
+    0x71, 0x41, 0x1e, 0x2b, 0x70, 0xf2, 0xcc, 0x77, 0xc4, 0xa4, 0xab, 0x37, 0x6a, 0x93, 0x30, 0xba,
+    0xc1, 0xdf, 0x4f, 0xc8, 0xbb, 0x9a, 0x47, 0xe5, 0x9c, 0xfb, 0xc7, 0xa4, 0x37, 0xae, 0x05, 0xd4,
+    0xb6, 0xb9, 0x3f, 0x57, 0xcf, 0x33, 0xf1, 0xa6, 0x1d, 0xf2, 0xb7, 0xea, 0x75, 0x26, 0xa4, 0xcd,
+    0x64, 0x1b, 0x96, 0xc6, 0xb5, 0xf7, 0xb0, 0x63, 0xdf, 0x00, 0x9e, 0x03, 0x52, 0xb5, 0x1d, 0xea,
+    0x71, 0xf7, 0xe6, 0x98, 0x34, 0xce, 0xd9, 0x5c, 0x30, 0xf2, 0xfa, 0x59, 0x63, 0x9f, 0x5c, 0xd0,
+    0x85, 0xf0, 0xe8, 0x3e, 0xf9, 0x82, 0xf9, 0x6c, 0x09, 0xbf, 0x3f, 0x63, 0xd2, 0xa6, 0x3e, 0x3c,
+    0x84, 0xd4, 0x0f, 0xdb, 0x21, 0x93, 0xdc, 0x01, 0xf2, 0xd4, 0xba, 0x9a, 0x4b, 0x11, 0xfb, 0xf6,
+    0x31, 0x71, 0xb9, 0xcf, 0xa8, 0x6c, 0xcf, 0x25, 0xb5, 0x39, 0xe8, 0xd9, 0xec, 0x0f, 0x47, 0x36,
+    0x9b, 0xef, 0x93, 0x7b, 0x87, 0x87, 0x47, 0x8c, 0x51, 0xd2, 0xdb, 0x83, 0xe7, 0xa3, 0xc3, 0x83,
+    0x19, 0x1d, 0x90, 0x7e, 0xaf, 0xb7, 0xd7, 0x1a, 0xd7, 0x3c, 0xee, 0xb7, 0x17, 0x8c, 0xcf, 0x17,
+    0xd1, 0x31, 0x2e, 0x2d, 0x17, 0x39, 0xe1, 0xfb, 0xa3, 0x40, 0xc9, 0xd9, 0x41, 0xbb, 0x51, 0xa0,
+    0x2d, 0x41, 0xda, 0x3c, 0xbf, 0xeb, 0x05, 0x8f, 0x18, 0x6a, 0xa8, 0xb4, 0x42, 0xae, 0x71, 0x98,
+    0xa0, 0x29, 0xb5, 0x17, 0xd4, 0x16, 0xd7, 0x60, 0x05, 0x32, 0xe8, 0x05, 0x6f, 0xc8, 0x21, 0xfe,
+    0x91, 0xf3, 0x19, 0x6d, 0xf6, 0xf6, 0xd5, 0xbf, 0xce, 0x10, 0x25, 0xa0, 0x6f, 0xb4, 0x0b, 0x8e,
+    0xc9, 0x83, 0x5e, 0x0f, 0x51, 0x53, 0x43, 0x12, 0x1a, 0x47, 0x22, 0x27, 0xd0, 0xa0, 0xa7, 0x05,
+    0x5a, 0xf4, 0x41, 0x10, 0x4b, 0xb8, 0x42, 0x1e, 0x93, 0x7b, 0xc3, 0xe1, 0x70, 0x5c, 0x8b, 0xd8,
+    0x9b, 0xa8, 0x4d, 0x5d, 0x3e, 0x07, 0x34, 0x0b, 0x54, 0x67, 0x32, 0x21, 0x03, 0xc6, 0x8e, 0x22,
+    0xe1, 0xa1, 0x76, 0x88, 0xac, 0x8c, 0x0d, 0xee, 0x60, 0x00, 0xe7, 0x52, 0x2f, 0x68, 0xf6, 0x3b,
+    0x23, 0xc9, 0xbc, 0x7d, 0x32, 0x5a, 0x5e, 0xef, 0x93, 0x01, 0x3c, 0xb6, 0x94, 0xca, 0x61, 0x3c,
+    0x53, 0x2e, 0x06, 0x46, 0x65, 0xb4, 0x13, 0xe6, 0x87, 0x87, 0x87, 0x6b, 0x8c, 0x06, 0xa3, 0x52,
+    0x46, 0xbd, 0xce, 0x7d, 0xcd, 0x69, 0x88, 0x9c, 0xfa, 0x19, 0x27, 0x66, 0x45, 0x5c, 0xf8, 0x05,
+    0xd3, 0xde, 0x73, 0xee, 0x3b, 0x0f, 0x1c, 0xba, 0x6e, 0x5c, 0xa5, 0x45, 0xc1, 0x22, 0x45, 0x01,
+    0x8c, 0x99, 0x52, 0xd2, 0x8b, 0x41, 0xce, 0x5e, 0x3a, 0x16, 0xd6, 0xcd, 0x33, 0xda, 0x60, 0x9e,
+    0xbe, 0x12, 0xfa, 0x40, 0x09, 0xdd, 0x39, 0xd0, 0x62, 0xdb, 0x3c, 0x0c, 0x5c, 0x0a, 0xe1, 0xea,
+    0xb8, 0x0c, 0xb0, 0x94, 0x71, 0xda, 0x10, 0x0b, 0x5e, 0x98, 0x99, 0x68, 0x4e, 0x83, 0x44, 0x5c,
+    0x10, 0x85, 0x43, 0xd6, 0x40, 0x60, 0x72, 0x1b, 0x24, 0x49, 0xb1, 0xf1, 0x1d, 0x00, 0xe1, 0x6f,
+    0x1b, 0x70, 0x61, 0x2d, 0x62, 0x6d, 0x10, 0x33, 0xf6, 0x7c, 0xa0, 0x23, 0x59, 0xc0, 0x68, 0xd4,
+    0xc4, 0x10, 0x68, 0x3b, 0x3c, 0xda, 0x27, 0x10, 0xaa, 0x10, 0x2b, 0xcd, 0xc1, 0x08, 0x68, 0x82,
+    0x2c, 0x8e, 0x6c, 0xb5, 0x12, 0x2e, 0x83, 0x3c, 0x17, 0x94, 0xa3, 0x3c, 0x50, 0xb3, 0xc8, 0x06,
+    0x84, 0x34, 0x4e, 0x57, 0xec, 0x7b, 0x3f, 0xb7, 0xe6, 0x32, 0x07, 0xb2, 0xe2, 0x00, 0x40, 0x43,
+    0xe1, 0x82, 0xe4, 0xa9, 0xe9, 0x0a, 0xea, 0xe3, 0xdf, 0xb6, 0xcd, 0xa5, 0xb6, 0x36, 0x58, 0x40,
+    0xa9, 0x60, 0x64, 0x1b, 0xe5, 0x45, 0x73, 0xe9, 0x8c, 0xb9, 0x49, 0xca, 0xaf, 0x06, 0xc7, 0x91,
+    0x0e, 0x8e, 0x41, 0x47, 0x05, 0xa2, 0x09, 0x96, 0x56, 0x21, 0xd2, 0x54, 0x28, 0x46, 0x12, 0xd2,
+    0xdf, 0x11, 0x12, 0x9c, 0x16, 0x07, 0x01, 0x93, 0x16, 0x0d, 0x41, 0x37, 0x97, 0x45, 0x60, 0xf6,
+    0x76, 0x18, 0x50, 0x4b, 0x57, 0x9e, 0x4e, 0xe6, 0xd0, 0x6b, 0x93, 0xe0, 0x87, 0xbd, 0x5e, 0x26,
+    0xcb, 0x92, 0xba, 0x31, 0x2b, 0x93, 0x45, 0x3b, 0x7c, 0xa8, 0x05, 0xe9, 0x77, 0x06, 0xab, 0x72,
+    0xa8, 0x74, 0x5b, 0xa1, 0x3a, 0x13, 0xae, 0x3d, 0x2e, 0x54, 0xb1, 0x53, 0x11, 0x4b, 0x0e, 0xf5,
+    0xe2, 0x6b, 0x76, 0x0d, 0x85, 0xcc, 0x13, 0xbe, 0x40, 0xc1, 0x40, 0xcc, 0x6b, 0x30, 0x6d, 0x7b,
+    0x26, 0x19, 0xbd, 0x02, 0x44, 0xfc, 0x81, 0xcc, 0x72, 0x95, 0x50, 0x81, 0x14, 0x73, 0xc9, 0xc2,
+    0xb0, 0x3d, 0xa3, 0xc5, 0x3a, 0x73, 0x8f, 0x3d, 0x60, 0x16, 0x73, 0x36, 0x24, 0x43, 0x52, 0xbe,
+    0x74, 0xde, 0x89, 0x25, 0x93, 0x8e, 0x8b, 0x55, 0x67, 0xc1, 0x6d, 0x9b, 0xf9, 0x69, 0xa0, 0x47,
+    0x22, 0x30, 0xee, 0x0d, 0x44, 0xc8, 0xb5, 0xa7, 0x24, 0x83, 0x98, 0xe3, 0x4b, 0xb6, 0x2a, 0x80,
+    0xc3, 0x5d, 0x74, 0x52, 0xae, 0x2c, 0xee, 0x6d, 0xaf, 0xb3, 0x0f, 0x7a, 0xbb, 0xca, 0xac, 0xf2,
+    0x99, 0x61, 0xaa, 0x8a, 0x1d, 0xfa, 0x27, 0x24, 0x4c, 0xb9, 0xae, 0x4a, 0x36, 0x7d, 0x13, 0x87,
+    0x11, 0x77, 0x6e, 0xda, 0xe6, 0x08, 0x5b, 0xab, 0x44, 0x26, 0xc2, 0x73, 0xce, 0x84, 0x10, 0x02,
+    0xcf, 0x95, 0xfa, 0x2a, 0xaf, 0x2c, 0x86, 0x14, 0x28, 0x9b, 0xd9, 0x84, 0xce, 0x20, 0xda, 0x63,
+    0x24, 0x66, 0xaa, 0xb2, 0xd6, 0xbf, 0xac, 0x0a, 0xa2, 0x1d, 0xda, 0xab, 0xe6, 0xaf, 0x26, 0xc0,
+    0x4a, 0x30, 0xbd, 0x6d, 0x73, 0xdf, 0x66, 0x6f, 0x80, 0x91, 0x2e, 0x5a, 0x11, 0x8d, 0x62, 0x8c,
+    0x02, 0x7b, 0xce, 0xf2, 0xc5, 0x82, 0xfb, 0x8a, 0xdd, 0xcc, 0x15, 0xd6, 0x55, 0x2e, 0x95, 0x47,
+    0x98, 0xc9, 0x83, 0x92, 0x4c, 0xee, 0x97, 0xc8, 0x33, 0xda, 0x62, 0x11, 0xc3, 0x57, 0x28, 0x36,
+    0xc5, 0x00, 0xb4, 0x0f, 0x98, 0x6d, 0xd3, 0x4c, 0xf0, 0xfe, 0x68, 0x74, 0x34, 0x38, 0x58, 0xc1,
+    0x73, 0x9c, 0x32, 0x44, 0xe7, 0xbe, 0x7d, 0x94, 0x47, 0x3c, 0x1a, 0xf4, 0x2d, 0x83, 0x28, 0x99,
+    0x03, 0x1e, 0x58, 0xb4, 0x67, 0x91, 0x9f, 0xd7, 0xd3, 0x28, 0x98, 0x1c, 0x82, 0xea, 0xe4, 0x2c,
+    0x9c, 0x83, 0xaa, 0x7c, 0x0d, 0x55, 0xf0, 0xdf, 0xf2, 0xf8, 0x5f, 0x8d, 0x1e, 0x6d, 0xc1, 0x63,
+    0xe2, 0x0b, 0x7f, 0xfd, 0x58, 0xdf, 0x78, 0xac, 0x3d, 0x58, 0x3b, 0xd5, 0xca, 0x3c, 0x1e, 0xcb,
+    0x10, 0x39, 0x05, 0x82, 0xeb, 0xd8, 0xc9, 0x67, 0x44, 0x5a, 0xd1, 0xc0, 0x47, 0x83, 0xb0, 0x10,
+    0x78, 0xb9, 0xfe, 0x60, 0xa8, 0xfb, 0x83, 0x48, 0xc4, 0xd6, 0xa2, 0x4d, 0x4d, 0xb5, 0xf5, 0xa8,
+    0xcf, 0x83, 0x18, 0xf3, 0x58, 0xf8, 0x45, 0xbb, 0x1e, 0x2f, 0xb0, 0x1c, 0xe0, 0x19, 0x9e, 0xd5,
+    0x4c, 0xd5, 0xdf, 0xc1, 0xb9, 0xd6, 0x1b, 0xb5, 0xd6, 0xc0, 0x91, 0xe6, 0x92, 0x95, 0xc1, 0x83,
+    0x9a, 0x06, 0xde, 0xa7, 0xcb, 0x36, 0x58, 0xfa, 0x2a, 0xbc, 0xf5, 0x49, 0xd6, 0x2f, 0x39, 0xc9,
+    0xf2, 0xe7, 0xb9, 0xaa, 0x58, 0xe9, 0x61, 0x9e, 0xf0, 0x2d, 0x89, 0x95, 0xb2, 0xdc, 0x5c, 0x09,
+    0x96, 0xf1, 0x07, 0xf4, 0x16, 0x8a, 0x98, 0xcd, 0x2c, 0x21, 0xa9, 0x36, 0xb0, 0x8e, 0x86, 0x62,
+    0xfb, 0xb0, 0xe9, 0x08, 0xd8, 0xdc, 0xf2, 0xa0, 0x09, 0x75, 0x7c, 0xe4, 0x7d, 0x9f, 0x09, 0x06,
+    0x00, 0xc3, 0x70, 0xa7, 0x77, 0x13, 0x33, 0x68, 0xd7, 0xee, 0x93, 0x6c, 0x21, 0x75, 0x5e, 0xe9,
+    0xd1, 0x01, 0xa8, 0xae, 0xa0, 0x68, 0x92, 0x0d, 0x2d, 0x5d, 0xa1, 0xa7, 0x2a, 0xea, 0x8b, 0x99,
+    0x1e, 0x70, 0xdf, 0x34, 0xc1, 0x26, 0x51, 0x86, 0x59, 0x6f, 0xe0, 0x0c, 0xf1, 0x5f, 0x6a, 0x53,
+    0xe5, 0xbb, 0xe1, 0x7a, 0xeb, 0x50, 0x30, 0xf9, 0x08, 0x23, 0xdc, 0x44, 0xf7, 0xc1, 0xca, 0x69,
+    0xa6, 0xdf, 0x40, 0x7b, 0xcf, 0xb8, 0x01, 0xb9, 0x93, 0x7e, 0x68, 0xb2, 0x1c, 0xca, 0xa1, 0x83,
+    0x13, 0x0b, 0x2b, 0xb6, 0xcb, 0x69, 0xcb, 0xf5, 0xf9, 0x15, 0xbb, 0x71, 0x24, 0x4c, 0x40, 0xa1,
+    0x46, 0x7d, 0x57, 0xeb, 0xed, 0x91, 0x77, 0x24, 0x17, 0xd9, 0x52, 0x40, 0xe9, 0x82, 0xd0, 0x86,
+    0x22, 0xd1, 0x1a, 0x93, 0xf7, 0x35, 0xcc, 0xb7, 0x52, 0x88, 0xe1, 0x61, 0x0a, 0x03, 0x74, 0x3d,
+    0x66, 0x73, 0x4a, 0x9a, 0xb9, 0xbc, 0x3c, 0xc4, 0xbc, 0x6c, 0x01, 0x87, 0x95, 0x49, 0x61, 0x7d,
+    0x8e, 0xc8, 0x5a, 0xdd, 0xf5, 0xbd, 0x7c, 0x83, 0xb8, 0x21, 0x8f, 0x20, 0x51, 0x10, 0xf4, 0x7d,
+    0x6d, 0xd2, 0x35, 0x63, 0xd7, 0xa4, 0x6b, 0xa6, 0x40, 0x1c, 0xa5, 0xe0, 0xc7, 0xe6, 0x4b, 0x0c,
+    0xbd, 0x30, 0x3c, 0xa9, 0xa7, 0x92, 0xe0, 0x18, 0xb7, 0xe8, 0x4f, 0xff, 0xf7, 0xd7, 0x3f, 0xfc,
+    0xfd, 0xbf, 0xff, 0xfc, 0x9e, 0x94, 0xcc, 0x72, 0xb0, 0x5b, 0x9b, 0x04, 0x09, 0x62, 0xd2, 0xf9,
+    0xd7, 0xa7, 0xe7, 0x37, 0x21, 0xb6, 0x92, 0x08, 0x24, 0xb5, 0x17, 0xc8, 0x4f, 0xc9, 0x39, 0x58,
+    0x84, 0xc3, 0x59, 0x6c, 0x85, 0x93, 0x6e, 0x60, 0x58, 0x72, 0xfb, 0xa4, 0x6e, 0x82, 0xab, 0x9e,
+    0x90, 0x49, 0xde, 0x57, 0xa5, 0x32, 0x21, 0x54, 0x9f, 0x4e, 0xba, 0xb0, 0x8a, 0x6c, 0xa7, 0xcf,
+    0x4d, 0x54, 0xea, 0x69, 0x14, 0xfd, 0x9a, 0x70, 0xeb, 0x74, 0x3a, 0x9a, 0x87, 0x81, 0x4d, 0x58,
+    0x99, 0x1e, 0xa0, 0x4e, 0x94, 0x15, 0x4e, 0xea, 0x49, 0x39, 0x50, 0x89, 0x5a, 0x64, 0xa8, 0x4d,
+    0xae, 0x8c, 0x30, 0x00, 0x23, 0xfc, 0xf6, 0x5f, 0x64, 0x5d, 0x2d, 0x30, 0xc1, 0x60, 0x15, 0x2d,
+    0xf5, 0x46, 0xbd, 0x64, 0x1d, 0x5b, 0x93, 0xb2, 0x75, 0xd5, 0xdd, 0xd6, 0xa7, 0xa7, 0x0b, 0x1e,
+    0x90, 0x33, 0x61, 0x33, 0x37, 0x2f, 0x78, 0x1e, 0x50, 0xb5, 0x9e, 0x75, 0xad, 0x0b, 0x00, 0x2b,
+    0xd8, 0xfa, 0xb4, 0x9d, 0x80, 0x6f, 0xc0, 0xda, 0xc5, 0xf6, 0xe5, 0x6b, 0x72, 0x2a, 0xa0, 0x94,
+    0x57, 0xe1, 0x1a, 0xc4, 0x0a, 0xf4, 0x4e, 0x98, 0x3e, 0x95, 0xec, 0xdb, 0x98, 0xf9, 0xd6, 0x4d,
+    0x35, 0xc6, 0x08, 0x7e, 0x6b, 0xbe, 0xe7, 0x8f, 0xbf, 0xc2, 0xeb, 0x80, 0x50, 0x39, 0x6f, 0x27,
+    0xd7, 0xd0, 0xbe, 0x32, 0xc0, 0xeb, 0x8c, 0x37, 0x8a, 0xb1, 0x16, 0x39, 0xff, 0x26, 0x67, 0xcc,
+    0x13, 0xf2, 0x86, 0x34, 0x5f, 0x3d, 0x3c, 0x6b, 0xdd, 0x6d, 0xcc, 0x5c, 0x40, 0xa1, 0x71, 0x09,
+    0xd0, 0xad, 0xa0, 0x4d, 0x84, 0xb0, 0xaf, 0xa8, 0x77, 0x6b, 0x23, 0x82, 0x27, 0x58, 0x45, 0x9e,
+    0xd0, 0x22, 0xb0, 0xbb, 0x60, 0xf9, 0x3a, 0x64, 0x76, 0x45, 0x96, 0x31, 0x80, 0xde, 0x05, 0xcb,
+    0xe7, 0x70, 0x3c, 0xb0, 0x30, 0x22, 0x4a, 0xdb, 0x47, 0xd8, 0x30, 0x54, 0x60, 0xee, 0x6a, 0x24,
+    0x05, 0xbe, 0x31, 0x66, 0x72, 0xf8, 0xf9, 0xe1, 0xad, 0xbe, 0x61, 0x0b, 0x0f, 0x5d, 0x4d, 0x1d,
+    0x4e, 0xa5, 0x97, 0x30, 0xb7, 0x42, 0x0d, 0xbb, 0xc0, 0xb5, 0x69, 0x6f, 0x6f, 0x1b, 0x49, 0x1c,
+    0xc7, 0x32, 0x3c, 0xb3, 0x9a, 0x16, 0x3f, 0x73, 0x04, 0xf5, 0xf6, 0xb2, 0x9a, 0x5a, 0x3d, 0xa4,
+    0xff, 0x43, 0x9e, 0xc2, 0xce, 0x22, 0x0b, 0xec, 0x17, 0x77, 0x1d, 0xd8, 0x9a, 0xfe, 0x39, 0x34,
+    0x45, 0x55, 0xa2, 0x0c, 0x81, 0x11, 0xf6, 0xf6, 0xa1, 0xad, 0xd9, 0x06, 0x8c, 0xd9, 0x95, 0xf9,
+    0x22, 0xf0, 0x1d, 0x31, 0xc6, 0x8a, 0x5e, 0x95, 0x2f, 0xc2, 0xde, 0xbe, 0x1e, 0x5e, 0xb1, 0xc8,
+    0xaa, 0x6c, 0xe7, 0x50, 0x41, 0x97, 0x1b, 0xfa, 0xb6, 0xb1, 0xad, 0x74, 0xfa, 0xa8, 0xe8, 0xd6,
+    0x98, 0x77, 0x19, 0xdf, 0xbf, 0xfb, 0x1b, 0xf9, 0x39, 0x7f, 0xca, 0x7f, 0xbc, 0xa3, 0xfe, 0x5c,
+    0xcd, 0xbe, 0x15, 0x2c, 0x7e, 0xcd, 0x1d, 0xae, 0x81, 0x6f, 0xef, 0xea, 0xf3, 0x67, 0x8f, 0xab,
+    0x72, 0x04, 0xd0, 0x5b, 0xf3, 0x7b, 0xf6, 0x92, 0x3c, 0xb4, 0x6d, 0xf4, 0x49, 0x05, 0xae, 0x3c,
+    0x30, 0xb0, 0xb7, 0x66, 0x7b, 0xf6, 0xf0, 0xf4, 0x03, 0xf8, 0x7a, 0xd4, 0xba, 0x2b, 0xc6, 0xe7,
+    0x30, 0x15, 0xc1, 0x59, 0x7c, 0x1e, 0x49, 0xe6, 0xcf, 0xa3, 0x45, 0x05, 0xe6, 0x32, 0x0c, 0xf9,
+    0xad, 0xd9, 0x7e, 0x01, 0xad, 0xfe, 0x35, 0xad, 0xd2, 0x43, 0xcd, 0x35, 0xe4, 0x47, 0xb7, 0x32,
+    0x3f, 0x7c, 0xff, 0x0f, 0x1c, 0x04, 0x5e, 0xc5, 0x7e, 0xc4, 0x3d, 0xf6, 0xe3, 0x25, 0xc7, 0xeb,
+    0x00, 0xe9, 0x57, 0x39, 0xe9, 0x15, 0xe0, 0xad, 0x2d, 0xf8, 0x8a, 0x85, 0x2c, 0x22, 0xaf, 0x18,
+    0x0d, 0x2b, 0x35, 0x85, 0x12, 0xc1, 0x35, 0xf4, 0x2e, 0x53, 0xce, 0xe2, 0x28, 0x82, 0xe1, 0xc7,
+    0x10, 0xca, 0x5d, 0x98, 0xd4, 0x89, 0xf0, 0x2d, 0x97, 0x5b, 0x57, 0x7a, 0xde, 0xd1, 0x53, 0x15,
+    0x1a, 0xb4, 0xd9, 0xaa, 0x43, 0xfd, 0xf9, 0xfd, 0x2f, 0x41, 0x1c, 0x05, 0x4c, 0x1e, 0xd3, 0x88,
+    0x4e, 0xba, 0x9a, 0xd0, 0xaa, 0x5c, 0xe9, 0x7d, 0x0a, 0xaa, 0x46, 0xc9, 0x02, 0xc8, 0x9f, 0xd4,
+    0xbb, 0xf5, 0xe2, 0x76, 0x7d, 0xfa, 0xc3, 0x9f, 0xfe, 0x88, 0x7e, 0x53, 0x15, 0xed, 0x54, 0xc0,
+    0xf8, 0x3b, 0x9f, 0x74, 0x69, 0x1e, 0xc7, 0x86, 0xfa, 0x39, 0x13, 0x54, 0xda, 0x25, 0xc8, 0x50,
+    0x0c, 0x7f, 0x0d, 0x42, 0x18, 0x00, 0x8d, 0x58, 0xaa, 0x6b, 0x68, 0x49, 0x1e, 0x44, 0xd3, 0x9a,
+    0x13, 0xfb, 0x7a, 0x58, 0xd5, 0xd1, 0xf1, 0xe8, 0x26, 0x62, 0x61, 0x73, 0x86, 0x7f, 0x71, 0xd0,
+    0xe5, 0x0e, 0xd1, 0x2f, 0x64, 0x02, 0x03, 0xf7, 0xe0, 0xa0, 0x45, 0x24, 0x8b, 0x62, 0xe9, 0x13,
+    0xbd, 0xf8, 0x29, 0x69, 0x90, 0x47, 0x8d, 0x71, 0x01, 0xec, 0xe0, 0xfe, 0xe8, 0xe8, 0x30, 0x85,
+    0x34, 0x1b, 0x5d, 0x8d, 0xdf, 0x89, 0xc4, 0x53, 0xfe, 0x86, 0xd9, 0xcd, 0x41, 0x4b, 0x61, 0x7f,
+    0x85, 0xe8, 0xeb, 0x90, 0x9a, 0x44, 0x11, 0xf8, 0x0c, 0x81, 0xdf, 0x17, 0x45, 0xd6, 0xf1, 0xd7,
+    0xf4, 0x94, 0xc0, 0x4b, 0x2a, 0x09, 0xa4, 0x81, 0xf0, 0xed, 0x90, 0x9c, 0x90, 0x33, 0x1a, 0x2d,
+    0x3a, 0x8e, 0x2b, 0x84, 0x84, 0x6d, 0x45, 0xb8, 0xd7, 0x6b, 0x8d, 0x15, 0x90, 0xc7, 0xfd, 0x18,
+    0xb9, 0xad, 0x00, 0x25, 0x98, 0x5d, 0x18, 0xf5, 0x0d, 0xdc, 0x42, 0xc4, 0xb2, 0x48, 0xca, 0xa0,
+    0xe6, 0xa0, 0x6c, 0x7a, 0x53, 0x00, 0xd2, 0x78, 0x5d, 0x02, 0x3a, 0x8f, 0x6b, 0x09, 0x11, 0xfd,
+    0xbb, 0x47, 0xf0, 0x66, 0x34, 0x13, 0x20, 0x79, 0xda, 0x03, 0x7a, 0xe3, 0x5a, 0x26, 0x7d, 0xf2,
+    0xa4, 0xd7, 0xd1, 0xc6, 0x8a, 0xcd, 0x94, 0xf4, 0x52, 0xe3, 0xaa, 0x05, 0x30, 0x8d, 0x0d, 0xd6,
+    0xf9, 0xd4, 0x90, 0x87, 0xd7, 0x85, 0x7a, 0x4d, 0xe8, 0xc2, 0x82, 0x67, 0x9c, 0xa4, 0x21, 0xf2,
+    0x14, 0xb6, 0xe0, 0xa8, 0x85, 0x44, 0x08, 0x58, 0x08, 0x0d, 0x91, 0x04, 0x26, 0x4f, 0x66, 0x17,
+    0x9e, 0x01, 0x2b, 0xac, 0xe6, 0x7c, 0x59, 0xcc, 0x2b, 0xbc, 0xfe, 0x13, 0x56, 0xec, 0x41, 0x7b,
+    0xd1, 0x99, 0xb3, 0xe8, 0x89, 0xcb, 0xf0, 0xf1, 0xd1, 0xcd, 0x33, 0xbb, 0xd9, 0x30, 0x77, 0x0e,
+    0x8d, 0x56, 0x47, 0x35, 0x0f, 0x1d, 0x73, 0x31, 0x00, 0x26, 0x6b, 0xa8, 0x9b, 0x42, 0xa0, 0xbc,
+    0x11, 0xd7, 0x5c, 0x2a, 0x94, 0xe1, 0xe2, 0xbd, 0x02, 0xa0, 0x3a, 0xd8, 0x34, 0x35, 0x1b, 0x5d,
+    0x1a, 0xf0, 0xae, 0xbe, 0xac, 0x68, 0xb4, 0x6a, 0x9d, 0x68, 0xc1, 0xfc, 0x26, 0xa4, 0x78, 0x20,
+    0xfc, 0x90, 0x91, 0x93, 0x29, 0x49, 0x9e, 0x3b, 0xdf, 0x40, 0x65, 0x69, 0xb6, 0x12, 0x10, 0x1b,
+    0x0a, 0x00, 0x6e, 0x6f, 0x11, 0x3f, 0xbd, 0x0b, 0x00, 0x21, 0xb0, 0xa1, 0x3a, 0xd5, 0x22, 0x81,
+    0x08, 0x88, 0xdc, 0xc1, 0xed, 0x4b, 0x0f, 0xf7, 0xb7, 0xa9, 0x61, 0x26, 0xfb, 0x0d, 0x24, 0x82,
+    0xf8, 0xd2, 0xc2, 0xed, 0xed, 0x14, 0x70, 0x44, 0xdf, 0x4c, 0x00, 0x0a, 0xda, 0xb7, 0x3a, 0xed,
+    0xbe, 0x7c, 0xbb, 0xcd, 0xa2, 0xd9, 0xd4, 0x5d, 0x4e, 0x0b, 0xf6, 0x2f, 0x97, 0x1a, 0x60, 0x0b,
+    0x95, 0x64, 0xda, 0x5d, 0xa3, 0x91, 0xaf, 0x4b, 0x8a, 0x9e, 0x82, 0xbc, 0x84, 0x19, 0xa9, 0xb5,
+    0x85, 0x9c, 0x19, 0x64, 0x77, 0x53, 0x43, 0xc0, 0x5d, 0xc4, 0xcc, 0x88, 0xba, 0x9b, 0x18, 0x02,
+    0xee, 0x22, 0x96, 0x1f, 0x39, 0x77, 0x53, 0x34, 0xd0, 0x97, 0x2a, 0xae, 0x4d, 0xb1, 0xc9, 0xc6,
+    0x4a, 0xc0, 0x68, 0xae, 0x72, 0x86, 0x8a, 0x53, 0x30, 0x12, 0xf9, 0x04, 0xcb, 0x5e, 0x56, 0x4b,
+    0xfb, 0xdb, 0x84, 0xcb, 0x4d, 0x9e, 0x69, 0x86, 0xe8, 0xef, 0x78, 0x27, 0x79, 0xb6, 0x10, 0x15,
+    0x7b, 0x8d, 0x1d, 0x64, 0xb2, 0xd1, 0x60, 0x4d, 0xcb, 0x02, 0x25, 0x82, 0xb7, 0x05, 0xdb, 0xc8,
+    0xa5, 0xf3, 0x62, 0x05, 0x77, 0x22, 0xe8, 0x25, 0x5e, 0xce, 0xb7, 0x76, 0x12, 0xc4, 0x41, 0x70,
+    0x8d, 0xe2, 0x0a, 0x19, 0x84, 0x30, 0xc7, 0x06, 0x9e, 0x1c, 0x55, 0xb2, 0x21, 0x9d, 0xf5, 0xca,
+    0x93, 0x41, 0x13, 0xc6, 0xec, 0xde, 0x96, 0x51, 0xe9, 0xdc, 0xb6, 0x5b, 0x61, 0x0d, 0x9b, 0x68,
+    0x8c, 0xe1, 0x91, 0x9f, 0xcc, 0xb2, 0x00, 0xc9, 0xc1, 0x25, 0x31, 0x92, 0xb3, 0xd5, 0x07, 0x05,
+    0xc9, 0xca, 0x00, 0xb7, 0x16, 0x26, 0x2b, 0xec, 0x77, 0x05, 0x4a, 0x71, 0x8a, 0x5c, 0xd7, 0xb7,
+    0x48, 0x2d, 0x09, 0x16, 0x75, 0xd0, 0xab, 0x49, 0xeb, 0x91, 0xfa, 0x82, 0x6a, 0xec, 0x8b, 0xe3,
+    0x10, 0x94, 0x3e, 0xdf, 0x87, 0x56, 0x98, 0xd9, 0xb5, 0xcf, 0x48, 0x63, 0x12, 0x06, 0x34, 0xed,
+    0xe9, 0x56, 0x3e, 0xba, 0xae, 0x7c, 0x09, 0x85, 0xbe, 0xeb, 0xcf, 0xbf, 0xc2, 0x7e, 0x4b, 0x63,
+    0x4e, 0xba, 0x88, 0x36, 0x6d, 0xd4, 0x8e, 0xab, 0x50, 0xd0, 0xdf, 0x44, 0x81, 0xc4, 0x5f, 0x7e,
+    0x43, 0x1e, 0xf3, 0xd0, 0x2a, 0x52, 0xd9, 0x62, 0x81, 0x6c, 0x62, 0x04, 0xdd, 0xd5, 0xa5, 0xf9,
+    0x97, 0x17, 0x67, 0xcf, 0xf1, 0xf4, 0xcf, 0x94, 0xdb, 0x85, 0x0e, 0xe3, 0x5f, 0x79, 0xb4, 0x29,
+    0x6b, 0xc0, 0xd4, 0x62, 0x93, 0xef, 0xbe, 0x23, 0x8d, 0xaf, 0x45, 0x44, 0x52, 0xd1, 0xb6, 0xc9,
+    0x94, 0x4e, 0x77, 0xe5, 0x54, 0xe1, 0x78, 0xa2, 0x7a, 0x5f, 0x93, 0xed, 0x3e, 0xdc, 0x46, 0x2c,
+    0x1b, 0xd9, 0xca, 0xa9, 0xc1, 0x7e, 0x42, 0x6e, 0x5b, 0x45, 0x01, 0x2d, 0xb6, 0xe8, 0x98, 0xaa,
+    0x45, 0x3e, 0xd3, 0xab, 0x08, 0xaf, 0xd2, 0xd5, 0x7e, 0xe4, 0x35, 0xc8, 0xf1, 0x4e, 0x29, 0xcd,
+    0xb0, 0x55, 0xce, 0xc2, 0x6c, 0x56, 0xd1, 0x56, 0xcf, 0x38, 0x1b, 0xd2, 0xd6, 0x74, 0xaa, 0xba,
+    0x60, 0xab, 0xe7, 0xad, 0xb5, 0x38, 0x1b, 0x5c, 0xca, 0xc5, 0x52, 0x00, 0x97, 0x52, 0x41, 0x8c,
+    0x3f, 0xaa, 0x5b, 0x32, 0x1d, 0xcf, 0xc7, 0x34, 0x4b, 0x49, 0xa3, 0xf5, 0x1e, 0x1a, 0x1f, 0x8b,
+    0x62, 0xc7, 0xc4, 0xa4, 0x14, 0x52, 0xb7, 0x3e, 0x80, 0x17, 0x0a, 0x80, 0x57, 0x4b, 0xcd, 0xc6,
+    0x13, 0xb5, 0xe3, 0xae, 0x7f, 0x00, 0x3a, 0x6e, 0xec, 0x13, 0x05, 0xd3, 0xaa, 0x24, 0x7f, 0x3e,
+    0x3d, 0x1a, 0x93, 0x20, 0xb9, 0x3a, 0x32, 0x9f, 0x30, 0x25, 0xb3, 0xc7, 0xf5, 0xe9, 0x53, 0xca,
+    0x5d, 0x08, 0x83, 0x48, 0x28, 0x7e, 0x25, 0x5f, 0x9b, 0xf0, 0x53, 0x93, 0x92, 0x1b, 0xdb, 0xcf,
+    0x6b, 0xee, 0xdb, 0xe2, 0xba, 0x03, 0xf1, 0xf7, 0x64, 0x09, 0x0c, 0x9f, 0xf3, 0x10, 0xf4, 0x65,
+    0x52, 0x33, 0x05, 0xe1, 0x56, 0xbb, 0x52, 0x40, 0x81, 0x8c, 0x36, 0x83, 0x13, 0x4c, 0x79, 0xfa,
+    0x63, 0x5c, 0x57, 0xfd, 0x47, 0xcd, 0xff, 0x03, 0x5b, 0x04, 0x85, 0x4e, 0xbf, 0x29, 0x00, 0x00,
+};
+const WebAsset deviceinfo_html_asset = { deviceinfo_html_gz, sizeof(deviceinfo_html_gz), "\"881215698d556a2d\"" };
+
+#endif // WEB_ASSETS_H
@@ -2,19 +2,324 @@
 #include <WiFi.h>
 #include <esp_chip_info.h>
 #include <esp_system.h>
+#include <esp_timer.h>
 #include "webserver.h"
-#include "webserver_html.h"
-#include "dashboard_html.h"
-#include "deviceinfo_html.h"
+#include "web_assets.h"
+#include "json_writer.h"
+#include "metrics.h"
 #include "config.h"
+#include <functional>
+#include <memory>
+
+// Writes "<name>":{<fields of first instance>,"valid":..,"probes":[..]} for each sensor.
+// Values are the filtered ones per channel, the last good value stays with
+// "valid":false after a failed read, null before the first one.
+struct SensorJsonVisitor {
+    JsonWriter& json;
+    const float* values;
+    const bool* valid;
+
+    SensorJsonVisitor(JsonWriter& out, const float* v, const bool* ok) : json(out), values(v), valid(ok) {}
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        json.key(S::name());
+        json.beginObject();
+        for (uint8_t f = 0; f < S::FIELDS; f++) {
+            json.field(S::field(f).key, values[firstChannel + f]);
+        }
+        json.field("valid", valid[firstChannel]);
+
+        // Multi-instance sensors also list every instance
+        if (S::MAX_INSTANCES > 1) {
+            json.key("probes");
+            json.beginArray();
+            for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+                json.beginObject();
+                json.field("address", sensor.getInstanceId(i));
+                uint8_t channel = firstChannel + i * S::FIELDS;
+                for (uint8_t f = 0; f < S::FIELDS; f++) {
+                    json.field(S::field(f).key, values[channel + f]);
+                }
+                json.field("valid", valid[channel]);
+                json.endObject();
+            }
+            json.endArray();
+        }
+        json.endObject();
+    }
+};
+
+// Copy of the sampling task's statistics. Replayed responses render from
+// one copy, a live read would show newer samples in later chunks, and the
+// 64-bit totals could be read half-updated from the other core.
+struct SensorStatsSnapshot {
+    SensorStats stats[SensorSet::COUNT];
+    InstanceStats instances[CHANNEL_COUNT];
+
+    void capture(const SensorTask* task) { task->copyStats(stats, instances); }
+};
+
+// Writes "<name>":{<sample timing>,"instances":[<outcome counters>]} for each sensor,
+// optionally with the raw duration histograms
+struct SensorStatsJsonVisitor {
+    JsonWriter& json;
+    const SensorStatsSnapshot& snapshot;
+    bool histograms;
+
+    SensorStatsJsonVisitor(JsonWriter& out, const SensorStatsSnapshot& stats, bool withHistograms)
+        : json(out), snapshot(stats), histograms(withHistograms) {}
+
+    static void writeHistogram(JsonWriter& json, const DurationHistogram& hist) {
+        json.beginArray();
+        for (uint8_t k = 0; k < SENSOR_STATS_BUCKETS; k++) {
+            json.value(hist.buckets[k]);
+        }
+        json.endArray();
+    }
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        const SensorStats& stats = snapshot.stats[index];
+        uint32_t avgUs = stats.sample.count ? (uint32_t)(stats.sample.totalUs / stats.sample.count) : 0;
+        uint32_t startAvgUs = stats.start.count ? (uint32_t)(stats.start.totalUs / stats.start.count) : 0;
+
+        json.key(S::name());
+        json.beginObject();
+        json.field("samples", stats.sample.count);
+        json.field("sample_avg_us", avgUs);
+        json.field("sample_max_us", stats.sample.maxUs);
+        json.field("start_avg_us", startAvgUs);
+        json.field("start_max_us", stats.start.maxUs);
+        json.field("timeouts", stats.timeouts);
+        if (histograms) {
+            json.key("sample_hist");
+            writeHistogram(json, stats.sample);
+            json.key("start_hist");
+            writeHistogram(json, stats.start);
+        }
+
+        json.key("instances");
+        json.beginArray();
+        for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+            const InstanceStats& instance = snapshot.instances[firstChannel + i * S::FIELDS];
+            json.beginObject();
+            json.field("id", sensor.getInstanceId(i));
+            json.field("success", instance.success);
+            json.field("failure", instance.failure);
+            json.field("fail_streak", instance.failStreak);
+            json.field("max_fail_streak", instance.maxFailStreak);
+            json.field("last_good", instance.lastGood);
+            json.endObject();
+        }
+        json.endArray();
+        json.endObject();
+    }
+};
+
+// /events frame: {"<sensor>":{<fields of first instance>,"valid":..},...} for the
+// sensors read since the last frame, the same shape as /api/sensor. Every
+// field is sent, null until it has a value, and "valid" only once all have one.
+struct WebServer::EventVisitor {
+    JsonWriter& json;
+    const float* values;
+    const bool* valid;
+    uint16_t mask;
+    bool empty;
+
+    EventVisitor(JsonWriter& out, const float* v, const bool* ok, uint16_t m)
+        : json(out), values(v), valid(ok), mask(m), empty(true) {}
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        if (!(mask & (((1u << S::FIELDS) - 1) << firstChannel))) {
+            return;
+        }
+        empty = false;
+        json.key(S::name());
+        json.beginObject();
+        bool complete = valid[firstChannel];
+        for (uint8_t f = 0; f < S::FIELDS; f++) {
+            json.field(S::field(f).key, values[firstChannel + f]);
+            complete = complete && !isnan(values[firstChannel + f]);
+        }
+        json.field("valid", complete);
+        json.endObject();
+    }
+};
+
+// Writes one metric family for every sensor or sensor instance, Prometheus
+// wants all series of a family next to each other
+struct PrometheusSensorVisitor {
+    enum Part : uint8_t { SAMPLE_TIME, START_TIME, TIMEOUTS, READS, READ_ERRORS };
+
+    PrometheusWriter& out;
+    const SensorStatsSnapshot& snapshot;
+    Part part;
+    const char* name;
+
+    PrometheusSensorVisitor(PrometheusWriter& writer, const SensorStatsSnapshot& stats, Part metric, const char* metricName)
+        : out(writer), snapshot(stats), part(metric), name(metricName) {}
+
+    template <typename S>
+    void operator()(S& sensor, uint8_t firstChannel, uint8_t index) {
+        const SensorStats& stats = snapshot.stats[index];
+        char labels[64];
+        TextBuffer text(labels, sizeof(labels));
+        PrometheusWriter::appendLabel(text, "sensor", S::name());
+        switch (part) {
+            case SAMPLE_TIME:
+                out.histogram(name, labels, stats.sample);
+                return;
+            case START_TIME:
+                out.histogram(name, labels, stats.start);
+                return;
+            case TIMEOUTS:
+                out.sample(name, labels, stats.timeouts);
+                return;
+            default:
+                break;
+        }
+
+        for (uint8_t i = 0; i < sensor.getInstanceCount(); i++) {
+            const InstanceStats& instance = snapshot.instances[firstChannel + i * S::FIELDS];
+            TextBuffer instanceLabels(labels, sizeof(labels));
+            PrometheusWriter::appendLabel(instanceLabels, "sensor", S::name());
+            PrometheusWriter::appendLabel(instanceLabels, "instance", sensor.getInstanceId(i));
+            out.sample(name, labels, part == READS ? (int64_t)instance.success + instance.failure : instance.failure);
+        }
+    }
+};
+
+// Streams a response with constant memory. Each fill callback replays
+// render() into the buffer AsyncTCP has room for, skipping the tokens already
+// sent, so render() must produce the same sequence of tokens every time: the
+// routes copy what they show when the request comes in and render only from
+// that copy. A response of n buffers costs n passes over it, skipped tokens
+// are counted but not formatted, which is cheap for the few kB of device
+// info, metrics and scan results. Responses that grow with stored data
+// (/api/history, /api/log, /api/rollup) resume from a saved position
+// instead. Writer is JsonWriter or PrometheusWriter.
+template <typename Writer>
+static void sendReplayed(AsyncWebServerRequest* request, const char* contentType,
+                         std::function<void(Writer&)> render) {
+    struct Stream {
+        std::function<void(Writer&)> render;
+        uint32_t sent;      // tokens
+        bool done;
+    };
+    std::shared_ptr<Stream> stream(new Stream());
+    stream->render = render;
+    stream->sent = 0;
+    stream->done = false;
+
+    AsyncWebServerResponse* response = request->beginChunkedResponse(contentType,
+        [stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            if (stream->done) {
+                return 0;
+            }
+            Writer writer((char*)buffer, maxLen, stream->sent);
+            stream->render(writer);
+            if (writer.getLength() == 0 && writer.isFull()) {
+                if (maxLen < WEB_CHUNK_MIN) {
+                    return RESPONSE_TRY_AGAIN; // not even the next token fits, wait for room
+                }
+                // More room would not help, end the body rather than spin
+                Serial.println("[WEB] Response token larger than WEB_CHUNK_MIN, response cut short");
+                stream->done = true;
+                return 0;
+            }
+            stream->sent = writer.getTokens();
+            stream->done = !writer.isFull();
+            return writer.getLength();
+        });
+    request->send(response);
+}
+
+typedef std::function<void(JsonWriter&)> JsonRenderer;
+
+static void sendJson(AsyncWebServerRequest* request, JsonRenderer render) {
+    sendReplayed<JsonWriter>(request, "application/json", render);
+}
+
+static const char* flashModeName(FlashMode_t mode) {
+    switch (mode) {
+        case FM_QIO:  return "QIO";
+        case FM_QOUT: return "QOUT";
+        case FM_DIO:  return "DIO";
+        case FM_DOUT: return "DOUT";
+        default:      return "UNKNOWN";
+    }
+}
 
-WebServer::WebServer(WiFiManager* wifiMgr, TemperatureSensor* tempSens, DS18B20Sensor* ds18b20Sens, bool* apMode) {
+static const char* resetReasonName(esp_reset_reason_t reason) {
+    switch (reason) {
+        case ESP_RST_POWERON:   return "Power On";
+        case ESP_RST_SW:        return "Software Reset";
+        case ESP_RST_PANIC:     return "Panic/Exception";
+        case ESP_RST_INT_WDT:   return "Interrupt Watchdog";
+        case ESP_RST_TASK_WDT:  return "Task Watchdog";
+        case ESP_RST_WDT:       return "Watchdog";
+        case ESP_RST_DEEPSLEEP: return "Deep Sleep";
+        case ESP_RST_BROWNOUT:  return "Brownout";
+        default:                return "Unknown";
+    }
+}
+
+// Dotted quad into a buffer of at least 16 bytes, without a String
+static void formatIp(char* out, size_t size, IPAddress ip) {
+    snprintf(out, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
+// Gzipped page with a strong ETag, or 304 if the browser already has it
+static void sendAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+    static const String cacheControl = "public, max-age=" + String(WEB_PAGE_MAX_AGE);
+    AsyncWebServerResponse* response;
+
+    AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    // May list several tags
+    if (ifNoneMatch && ifNoneMatch->value().indexOf(asset.etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, "text/html", asset.data, asset.length);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
+
+WebServer::WebServer(WiFiManager* wifiMgr, SensorSet* sensorSet, SensorTask* task, MQTTManager* mqttMgr, SensorHistory* hist, SampleLog* log, RollupStore* rollups, bool* apMode) {
     server = new AsyncWebServer(80);
     wifiManager = wifiMgr;
-    tempSensor = tempSens;
-    ds18b20Sensor = ds18b20Sens;
+    sensors = sensorSet;
+    sensorTask = task;
+    mqttManager = mqttMgr;
+    history = hist;
+    sampleLog = log;
+    rollupStore = rollups;
     isAPMode = apMode;
 
+    events = new AsyncEventSource("/events");
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        latestValues[ch] = NAN;
+        latestValid[ch] = false;
+    }
+    eventMask = 0;
+    eventId = 0;
+
+    for (uint8_t i = 0; i < 2; i++) {
+        snapshots[i].length = 0;
+        snapshots[i].etag[0] = '\0';
+        snapshots[i].seq = 0;
+    }
+    snapshotCurrent = 0;
+    snapshotBoot = esp_random();
+    snapshotVersion = 0;
+    snapshotDirty = true;
+    snapshotServed = 0;
+    snapshotNotModified = 0;
+
     scanInProgress = false;
     retryInProgress = false;
     retryStartTime = 0;
@@ -37,131 +342,854 @@ WebServer::~WebServer() {
     delete server;
 }
 
+void WebServer::on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction handler) {
+    int8_t route = Metrics::addRoute(uri, method == HTTP_POST ? "POST" : "GET");
+    server->on(uri, method, [route, handler](AsyncWebServerRequest* request) {
+        Metrics::countRequest(route);
+        handler(request);
+    });
+}
+
 void WebServer::begin() {
+    updateSnapshot();
     setupRoutes();
     server->begin();
     Serial.println("Web server started");
 }
 
 void WebServer::setupRoutes() {
+    // Live readings for the dashboard, replaces polling /api/sensor
+    server->addHandler(events);
+
     // Root route - serve WiFi configuration page
-    server->on("/", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send(200, "text/html", index_html);
+    on("/", HTTP_GET, [](AsyncWebServerRequest *request){
+        sendAsset(request, index_html_asset);
     });
 
     // Dashboard route - serve temperature/humidity page
-    server->on("/dashboard", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send(200, "text/html", dashboard_html);
+    on("/dashboard", HTTP_GET, [](AsyncWebServerRequest *request){
+        sendAsset(request, dashboard_html_asset);
     });
 
     // Device info route - serve device information page
-    server->on("/device", HTTP_GET, [](AsyncWebServerRequest *request){
-        request->send(200, "text/html", deviceinfo_html);
+    on("/device", HTTP_GET, [](AsyncWebServerRequest *request){
+        sendAsset(request, deviceinfo_html_asset);
+    });
+
+    // API endpoint for sensor data, one object per registered sensor. Served
+    // from the snapshot, 304 while the browser has the current version.
+    on("/api/sensor", HTTP_GET, [this](AsyncWebServerRequest *request){
+        AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+        // The body is copied out under the seqlock before anything is sent, the
+        // loop task may reuse the slot while a slow client is still reading.
+        // The request frees its _tempObject when it is done.
+        char* body = nullptr;
+        size_t length;
+        char etag[sizeof(Snapshot::etag)];
+        bool notModified;
+        for (;;) {
+            const Snapshot& snapshot = snapshots[snapshotCurrent];
+            uint32_t seq = snapshot.seq;
+            if (seq & 1) {
+                continue; // flipped twice meanwhile, take the new one
+            }
+            length = snapshot.length;
+            memcpy(etag, snapshot.etag, sizeof(etag));
+            notModified = ifNoneMatch && ifNoneMatch->value().indexOf(etag) >= 0;
+            if (!notModified) {
+                if (!body) {
+                    body = (char*)malloc(WEB_SNAPSHOT_MAX);
+                    if (!body) {
+                        request->send(503);
+                        return;
+                    }
+                    request->_tempObject = body;
+                }
+                memcpy(body, snapshot.data, length);
+            }
+            if (snapshot.seq == seq) {
+                break;
+            }
+        }
+
+        AsyncWebServerResponse* response;
+        if (notModified) {
+            response = request->beginResponse(304);
+            snapshotNotModified++;
+        } else {
+            response = request->beginResponse_P(200, "application/json", (const uint8_t*)body, length);
+            snapshotServed++;
+        }
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+    });
+
+#if SENSOR_DS18B20_ENABLED
+    // DS18B20 probe resolutions: {"conversion_ms":..,"probes":[{"id":..,"resolution":..}]}
+    on("/api/ds18b20", HTTP_GET, [this](AsyncWebServerRequest *request){
+        DS18B20Sensor* ds18b20 = sensors->find<DS18B20Sensor>();
+        struct Probes {
+            uint32_t conversionMs;
+            uint8_t count;
+            char ids[DS18B20_MAX_PROBES][17];
+            uint8_t resolution[DS18B20_MAX_PROBES];
+        };
+        std::shared_ptr<Probes> probes(new Probes());
+        probes->conversionMs = ds18b20->getConversionTime();
+        probes->count = ds18b20->getDeviceCount();
+        for (uint8_t i = 0; i < probes->count; i++) {
+            strlcpy(probes->ids[i], ds18b20->getAddressString(i), sizeof(probes->ids[i]));
+            probes->resolution[i] = ds18b20->getResolution(i);
+        }
+
+        sendJson(request, [probes](JsonWriter& json) {
+            json.beginObject();
+            json.field("conversion_ms", probes->conversionMs);
+            json.key("probes");
+            json.beginArray();
+            for (uint8_t i = 0; i < probes->count; i++) {
+                json.beginObject();
+                json.field("id", probes->ids[i]);
+                json.field("resolution", probes->resolution[i]);
+                json.endObject();
+            }
+            json.endArray();
+            json.endObject();
+        });
     });
 
-    // API endpoint for sensor data
-    server->on("/api/sensor", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String json = "{";
-        json += "\"dht22\":{";
-        json += "\"temperature\":" + String(tempSensor->getTemperature(), 2) + ",";
-        json += "\"humidity\":" + String(tempSensor->getHumidity(), 2) + ",";
-        json += "\"heatIndex\":" + String(tempSensor->getHeatIndex(), 2) + ",";
-        json += "\"valid\":" + String(tempSensor->isValid() ? "true" : "false");
-        json += "},";
-        json += "\"ds18b20\":{";
-        json += "\"temperature\":" + String(ds18b20Sensor->getTemperature(), 2) + ",";
-        json += "\"valid\":" + String(ds18b20Sensor->isValid() ? "true" : "false");
-        json += "}";
-        json += "}";
-        request->send(200, "application/json", json);
+    // Set a probe's resolution: probe=<index or ROM id>&bits=9..12
+    on("/api/ds18b20/resolution", HTTP_POST, [this](AsyncWebServerRequest *request){
+        if (!request->hasParam("probe", true) || !request->hasParam("bits", true)) {
+            request->send(400, "text/plain", "Missing parameters");
+            return;
+        }
+
+        DS18B20Sensor* ds18b20 = sensors->find<DS18B20Sensor>();
+        String probe = request->getParam("probe", true)->value();
+        int index = -1;
+        for (int i = 0; i < ds18b20->getDeviceCount(); i++) {
+            if (probe.equalsIgnoreCase(ds18b20->getAddressString(i)) || probe == String(i)) {
+                index = i;
+                break;
+            }
+        }
+
+        uint8_t bits = (uint8_t)request->getParam("bits", true)->value().toInt();
+        if (!ds18b20->setResolution(index, bits)) {
+            request->send(400, "text/plain", "Unknown probe or resolution");
+            return;
+        }
+        request->send(202, "text/plain", "Resolution applied on next sample");
+    });
+#endif
+
+    // API endpoint for sample history: /api/history?channel=dht22_temperature&since=<millis>
+    // The last sample is the open window's running average, later replaced by the closed one
+    on("/api/history", HTTP_GET, [this](AsyncWebServerRequest *request){
+        if (!request->hasParam("channel")) {
+            request->send(400, "text/plain", "Missing channel");
+            return;
+        }
+
+        int channel = parseChannelName(request->getParam("channel")->value().c_str());
+        if (channel < 0) {
+            request->send(400, "text/plain", "Unknown channel");
+            return;
+        }
+
+        // Compared modulo 2^32 like the stored times, the default covers everything kept
+        uint32_t since = millis() - INT32_MAX;
+        if (request->hasParam("since")) {
+            since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+        }
+
+        // Stream samples straight from the ring buffer, one TCP window at a time
+        struct HistoryStream {
+            HistoryCursor cursor;
+            char channelName[CHANNEL_NAME_MAX];
+            JsonWriter::Nesting nesting;
+            bool headerSent;
+            bool done;
+        };
+        std::shared_ptr<HistoryStream> stream(new HistoryStream());
+        formatChannelName(channel, stream->channelName, sizeof(stream->channelName));
+        history->beginQuery(channel, since, stream->cursor);
+        stream->nesting = JsonWriter::Nesting();
+        stream->headerSent = false;
+        stream->done = false;
+
+        SensorHistory* hist = history;
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+            [hist, stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                const size_t sampleRoom = 32; // ",[4294967295,-327.67]" plus closing "]}"
+                constexpr size_t headerRoom = 64 + CHANNEL_NAME_MAX;
+                static_assert(headerRoom <= WEB_CHUNK_MIN, "/api/history header must fit WEB_CHUNK_MIN");
+
+                if (stream->done) {
+                    return 0;
+                }
+                if (maxLen < headerRoom) {
+                    return RESPONSE_TRY_AGAIN;
+                }
+
+                JsonWriter json((char*)buffer, maxLen, stream->nesting);
+                if (!stream->headerSent) {
+                    json.beginObject();
+                    json.field("channel", stream->channelName);
+                    json.field("now", (unsigned long)millis());
+                    json.field("step", (unsigned long)HISTORY_STEP_MS);
+                    json.key("samples");
+                    json.beginArray();
+                    stream->headerSent = true;
+                }
+
+                uint32_t timestamp;
+                float value;
+                while (json.getRemaining() > sampleRoom) {
+                    if (!hist->next(stream->cursor, timestamp, value)) {
+                        json.endArray();
+                        json.endObject();
+                        stream->done = true;
+                        break;
+                    }
+                    json.beginArray();
+                    json.value((unsigned long)timestamp);
+                    json.value(value);
+                    json.endArray();
+                }
+                stream->nesting = json.getNesting();
+                return json.getLength();
+            });
+        request->send(response);
+    });
+
+    // API endpoint for the flash log: /api/log?from=<log time>&to=<log time>
+    on("/api/log", HTTP_GET, [this](AsyncWebServerRequest *request){
+        if (!sampleLog->isReady()) {
+            request->send(503, "text/plain", "Sample log not available");
+            return;
+        }
+
+        uint32_t from = 0;
+        uint32_t to = LOG_ERASED - 1;
+        if (request->hasParam("from")) {
+            from = strtoul(request->getParam("from")->value().c_str(), nullptr, 10);
+        }
+        if (request->hasParam("to")) {
+            to = strtoul(request->getParam("to")->value().c_str(), nullptr, 10);
+        }
+
+        struct LogStream {
+            LogCursor cursor;
+            JsonWriter::Nesting nesting;
+            bool found;
+            bool headerSent;
+            bool done;
+        };
+        std::shared_ptr<LogStream> stream(new LogStream());
+        stream->found = sampleLog->beginQuery(from, to, stream->cursor);
+        stream->nesting = JsonWriter::Nesting();
+        stream->headerSent = false;
+        stream->done = false;
+
+        SampleLog* log = sampleLog;
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+            [log, stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                const size_t recordRoom = 16 + CHANNEL_COUNT * 9; // timestamp plus ",-327.68" per channel
+                constexpr size_t headerRoom = recordRoom + CHANNEL_COUNT * (CHANNEL_NAME_MAX + 3) + 32;
+                static_assert(headerRoom <= WEB_CHUNK_MIN, "/api/log header and first record must fit WEB_CHUNK_MIN");
+
+                if (stream->done) {
+                    return 0;
+                }
+                if (maxLen < headerRoom) {
+                    return RESPONSE_TRY_AGAIN;
+                }
+
+                JsonWriter json((char*)buffer, maxLen, stream->nesting);
+                if (!stream->headerSent) {
+                    json.beginObject();
+                    json.field("now", (unsigned long)log->getTimestamp());
+                    json.key("channels");
+                    json.beginArray();
+                    char channelName[CHANNEL_NAME_MAX];
+                    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                        formatChannelName(ch, channelName, sizeof(channelName));
+                        json.value(channelName);
+                    }
+                    json.endArray();
+                    json.key("records");
+                    json.beginArray();
+                    stream->headerSent = true;
+                }
+
+                LogRecord record;
+                while (json.getRemaining() > recordRoom) {
+                    if (!stream->found || !log->next(stream->cursor, record)) {
+                        json.endArray();
+                        json.endObject();
+                        stream->done = true;
+                        break;
+                    }
+                    json.beginArray();
+                    json.value((unsigned long)record.timestamp);
+                    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+                        if (record.validMask & (1u << ch)) {
+                            json.value(record.values[ch] / 100.0);
+                        } else {
+                            json.valueNull();
+                        }
+                    }
+                    json.endArray();
+                }
+                stream->nesting = json.getNesting();
+                return json.getLength();
+            });
+        request->send(response);
+    });
+
+    // Replay a time range of the flash log to MQTT (<baseTopic>/log/replay)
+    on("/api/log/replay", HTTP_POST, [this](AsyncWebServerRequest *request){
+        if (!request->hasParam("from", true)) {
+            request->send(400, "text/plain", "Missing parameters");
+            return;
+        }
+
+        uint32_t from = strtoul(request->getParam("from", true)->value().c_str(), nullptr, 10);
+        uint32_t to = LOG_ERASED - 1;
+        if (request->hasParam("to", true)) {
+            to = strtoul(request->getParam("to", true)->value().c_str(), nullptr, 10);
+        }
+
+        if (!sampleLog->startReplay(from, to)) {
+            request->send(404, "text/plain", "No records in range");
+            return;
+        }
+
+        Serial.print("[LOG] Replay to MQTT requested from ");
+        Serial.println(from);
+        request->send(202, "text/plain", "Replay started");
+    });
+
+    // API endpoint for rollups: /api/rollup?tier=minute|hour|day&channel=dht22_temperature
+    on("/api/rollup", HTTP_GET, [this](AsyncWebServerRequest *request){
+        if (!request->hasParam("tier") || !request->hasParam("channel")) {
+            request->send(400, "text/plain", "Missing parameters");
+            return;
+        }
+
+        int tier = RollupStore::parseTier(request->getParam("tier")->value().c_str());
+        int channel = parseChannelName(request->getParam("channel")->value().c_str());
+        if (tier < 0 || channel < 0) {
+            request->send(400, "text/plain", "Unknown tier or channel");
+            return;
+        }
+
+        // Buckets are [min,max,avg,last,count] oldest first, null for windows without samples
+        struct RollupStream {
+            uint8_t tier;
+            uint8_t channel;
+            uint16_t index;
+            uint16_t count;
+            JsonWriter::Nesting nesting;
+            bool headerSent;
+            bool done;
+        };
+        std::shared_ptr<RollupStream> stream(new RollupStream());
+        stream->tier = tier;
+        stream->channel = channel;
+        stream->index = 0;
+        stream->count = rollupStore->getCount(tier);
+        stream->nesting = JsonWriter::Nesting();
+        stream->headerSent = false;
+        stream->done = false;
+
+        RollupStore* rollups = rollupStore;
+        AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+            [rollups, stream](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                const size_t bucketRoom = 48; // ",[-327.68,-327.68,-327.68,-327.68,65535]" plus "]}"
+                constexpr size_t headerRoom = 128;
+                static_assert(headerRoom <= WEB_CHUNK_MIN, "/api/rollup header must fit WEB_CHUNK_MIN");
+
+                if (stream->done) {
+                    return 0;
+                }
+                if (maxLen < headerRoom) {
+                    return RESPONSE_TRY_AGAIN;
+                }
+
+                JsonWriter json((char*)buffer, maxLen, stream->nesting);
+                if (!stream->headerSent) {
+                    json.beginObject();
+                    json.field("tier", RollupStore::tierName(stream->tier));
+                    json.field("seconds", (unsigned long)rollups->getWindowSeconds(stream->tier));
+                    json.field("start", (unsigned long)rollups->getBucketStart(stream->tier, 0));
+                    json.key("buckets");
+                    json.beginArray();
+                    stream->headerSent = true;
+                }
+
+                RollupBucket bucket;
+                while (json.getRemaining() > bucketRoom) {
+                    if (stream->index >= stream->count ||
+                        !rollups->getBucket(stream->tier, stream->channel, stream->index, bucket)) {
+                        json.endArray();
+                        json.endObject();
+                        stream->done = true;
+                        break;
+                    }
+                    if (bucket.count == 0) {
+                        json.valueNull();
+                    } else {
+                        json.beginArray();
+                        json.value(bucket.min / 100.0);
+                        json.value(bucket.max / 100.0);
+                        json.value(bucket.sum / 100.0 / bucket.count);
+                        json.value(bucket.last / 100.0);
+                        json.value((unsigned int)bucket.count);
+                        json.endArray();
+                    }
+                    stream->index++;
+                }
+                stream->nesting = json.getNesting();
+                return json.getLength();
+            });
+        request->send(response);
     });
 
     // API endpoint for device information
-    server->on("/api/device", HTTP_GET, [](AsyncWebServerRequest *request){
+    on("/api/device", HTTP_GET, [this](AsyncWebServerRequest *request){
+        // Read once, every chunk renders the same values
+        struct DeviceInfo {
+            uint8_t cores;
+            uint32_t cpuFreq;
+            const char* sdkVersion;
+            uint32_t totalRam;
+            uint32_t freeRam;
+            uint32_t largestBlock;
+            uint32_t flashSize;
+            uint32_t flashSpeed;
+            const char* flashMode;
+            uint32_t sketchSize;
+            bool wifiConnected;
+            char ssid[33];
+            char ip[16];
+            char mac[18];
+            int32_t rssi;
+            char gateway[16];
+            unsigned long uptime;
+            const char* resetReason;
+            bool mqttConnected;
+            uint32_t mqttPublished;
+            uint32_t mqttSuppressed;
+            uint16_t queueDepth;
+            bool queueSpilled;
+            uint32_t queueDropped;
+            SensorStatsSnapshot sensorStats;
+        };
+        std::shared_ptr<DeviceInfo> info(new DeviceInfo());
         esp_chip_info_t chip_info;
         esp_chip_info(&chip_info);
+        info->cores = chip_info.cores;
+        info->cpuFreq = ESP.getCpuFreqMHz();
+        info->sdkVersion = ESP.getSdkVersion();
+        info->totalRam = ESP.getHeapSize();
+        info->freeRam = ESP.getFreeHeap();
+        info->largestBlock = ESP.getMaxAllocHeap();
+        info->flashSize = ESP.getFlashChipSize();
+        info->flashSpeed = ESP.getFlashChipSpeed();
+        info->flashMode = flashModeName(ESP.getFlashChipMode());
+        info->sketchSize = ESP.getSketchSize();
+        info->wifiConnected = WiFi.status() == WL_CONNECTED;
+        strlcpy(info->ssid, WiFi.SSID().c_str(), sizeof(info->ssid));
+        formatIp(info->ip, sizeof(info->ip), WiFi.localIP());
+        uint8_t mac[6];
+        WiFi.macAddress(mac);
+        snprintf(info->mac, sizeof(info->mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+        info->rssi = WiFi.RSSI();
+        formatIp(info->gateway, sizeof(info->gateway), WiFi.gatewayIP());
+        info->uptime = millis();
+        info->resetReason = resetReasonName(esp_reset_reason());
+        info->mqttConnected = mqttManager->isConnected();
+        info->mqttPublished = mqttManager->getPublishCount();
+        info->mqttSuppressed = mqttManager->getSuppressedCount();
+        info->queueDepth = mqttManager->getOutboundQueue().getDepth();
+        info->queueSpilled = mqttManager->getOutboundQueue().isSpilled();
+        info->queueDropped = mqttManager->getOutboundQueue().getDropped();
+        info->sensorStats.capture(sensorTask);
+
+        sendJson(request, [this, info](JsonWriter& json) {
+            json.beginObject();
+
+            // System info
+            json.field("chip_model", "ESP32");
+            json.field("cpu_cores", info->cores);
+            json.field("cpu_freq", info->cpuFreq);
+            json.field("sdk_version", info->sdkVersion);
+
+            // RAM info
+            json.field("total_ram", info->totalRam);
+            json.field("free_ram", info->freeRam);
+            json.field("used_ram", info->totalRam - info->freeRam);
+            json.field("largest_block", info->largestBlock);
+
+            // Flash info
+            json.field("flash_size", info->flashSize);
+            json.field("flash_speed", info->flashSpeed);
+            json.field("flash_mode", info->flashMode);
+            json.field("sketch_size", info->sketchSize);
+
+            // WiFi info
+            json.field("wifi_connected", info->wifiConnected);
+            json.field("wifi_ssid", info->ssid);
+            json.field("ip_address", info->ip);
+            json.field("mac_address", info->mac);
+            json.field("rssi", info->rssi);
+            json.field("gateway", info->gateway);
+
+            // Runtime info
+            json.field("uptime", info->uptime);
+            json.field("reset_reason", info->resetReason);
+
+            json.field("mqtt_connected", info->mqttConnected);
+            json.field("mqtt_published", info->mqttPublished);
+            json.field("mqtt_suppressed", info->mqttSuppressed);
+            json.field("mqtt_queue_depth", info->queueDepth);
+            json.field("mqtt_queue_spilled", info->queueSpilled);
+            json.field("mqtt_queue_dropped", info->queueDropped);
+
+            SensorStatsJsonVisitor stats(json, info->sensorStats, false);
+            json.key("sensors");
+            json.beginObject();
+            sensors->forEach(stats);
+            json.endObject();
+            json.endObject();
+        });
+    });
+
+    // Sensor instrumentation incl. read duration histograms (bucket k counts [2^k, 2^(k+1)) us)
+    on("/api/metrics", HTTP_GET, [this](AsyncWebServerRequest *request){
+        // Read once, every chunk renders the same values
+        struct MetricsInfo {
+            unsigned long uptime;
+            uint32_t cycles;
+            uint32_t jitterAvgUs;
+            uint32_t jitterMaxUs;
+            uint32_t dropped;
+
+            uint16_t queueDepth;
+            bool queueSpilled;
+            uint32_t queuePushed;
+            uint32_t queueSent;
+            uint32_t queueDropped;
+            uint32_t queueSpills;
+            uint32_t queueFromFlash;
+            uint32_t drainRate;
+
+            bool connected;
+            uint32_t attempts;
+            uint32_t failures;
+            uint32_t sessions;
+            uint32_t lastReconnectMs;
+            uint32_t maxReconnectMs;
+            uint32_t lastReconnectAttempts;
+            unsigned long retryWaitMs;
+            int8_t lastError;
+            uint32_t dnsLookups;
+            uint32_t dnsCacheHits;
+            uint32_t dnsFailures;
+            uint32_t dnsFallbacks;
+            uint8_t inflight;
+            uint32_t pubacks;
+            uint32_t retransmits;
+            uint32_t duplicateAcks;
+            uint32_t inflightLost;
+
+            uint32_t eventClients;
+            uint32_t eventFrames;
+
+            uint32_t snapshotVersion;
+            uint16_t snapshotBytes;
+            uint32_t snapshotServed;
+            uint32_t snapshotNotModified;
+
+            SensorStatsSnapshot sensorStats;
+        };
+        std::shared_ptr<MetricsInfo> info(new MetricsInfo());
+        info->uptime = millis();
+        info->cycles = sensorTask->getCycleCount();
+        info->jitterAvgUs = sensorTask->getJitterAvgUs();
+        info->jitterMaxUs = sensorTask->getJitterMaxUs();
+        info->dropped = sensorTask->getDroppedReadings();
+
+        const OutboundQueue& queue = mqttManager->getOutboundQueue();
+        info->queueDepth = queue.getDepth();
+        info->queueSpilled = queue.isSpilled();
+        info->queuePushed = queue.getPushed();
+        info->queueSent = queue.getCommitted();
+        info->queueDropped = queue.getDropped();
+        info->queueSpills = queue.getSpills();
+        info->queueFromFlash = queue.getFromFlash();
+        info->drainRate = mqttManager->getDrainRate();
+
+        const MqttClient& client = mqttManager->getClient();
+        info->connected = client.connected();
+        info->attempts = mqttManager->getConnectAttempts();
+        info->failures = mqttManager->getConnectFailures();
+        info->sessions = mqttManager->getSessions();
+        info->lastReconnectMs = mqttManager->getLastReconnectMs();
+        info->maxReconnectMs = mqttManager->getMaxReconnectMs();
+        info->lastReconnectAttempts = mqttManager->getLastReconnectAttempts();
+        info->retryWaitMs = mqttManager->getRetryDelay();
+        info->lastError = client.getError();
+        info->dnsLookups = client.getDnsLookups();
+        info->dnsCacheHits = client.getDnsCacheHits();
+        info->dnsFailures = client.getDnsFailures();
+        info->dnsFallbacks = client.getDnsFallbacks();
+        info->inflight = client.getInflight();
+        info->pubacks = client.getPubacks();
+        info->retransmits = client.getRetransmits();
+        info->duplicateAcks = client.getDuplicateAcks();
+        info->inflightLost = client.getInflightLost();
+
+        info->eventClients = events->count();
+        info->eventFrames = eventId;
+
+        info->snapshotVersion = snapshotVersion;
+        info->snapshotBytes = snapshots[snapshotCurrent].length;
+        info->snapshotServed = snapshotServed.load();
+        info->snapshotNotModified = snapshotNotModified.load();
+
+        info->sensorStats.capture(sensorTask);
+
+        sendJson(request, [this, info](JsonWriter& json) {
+            json.beginObject();
+            json.key("bucket_us");
+            json.beginArray();
+            for (uint8_t k = 0; k < SENSOR_STATS_BUCKETS; k++) {
+                json.value(DurationHistogram::bucketStart(k));
+            }
+            json.endArray();
+            json.field("uptime", info->uptime);
+            json.field("cycles", info->cycles);
+            json.field("jitter_avg_us", info->jitterAvgUs);
+            json.field("jitter_max_us", info->jitterMaxUs);
+            json.field("dropped", info->dropped);
+
+            // Store-and-forward queue for <base>/samples
+            json.key("mqtt_queue");
+            json.beginObject();
+            json.field("depth", info->queueDepth);
+            json.field("capacity", MQTT_QUEUE_RAM);
+            json.field("spilled", info->queueSpilled);
+            json.field("pushed", info->queuePushed);
+            json.field("sent", info->queueSent);
+            json.field("dropped", info->queueDropped);
+            json.field("spills", info->queueSpills);
+            json.field("from_flash", info->queueFromFlash);
+            json.field("drain_rate", info->drainRate);
+            json.endObject();
+
+            json.key("mqtt_connection");
+            json.beginObject();
+            json.field("connected", info->connected);
+            json.field("attempts", info->attempts);
+            json.field("failures", info->failures);
+            json.field("sessions", info->sessions);
+            json.field("last_reconnect_ms", info->lastReconnectMs);
+            json.field("max_reconnect_ms", info->maxReconnectMs);
+            json.field("last_reconnect_attempts", info->lastReconnectAttempts);
+            json.field("retry_wait_ms", info->retryWaitMs);
+            json.field("last_error", info->lastError);
+            json.field("dns_lookups", info->dnsLookups);
+            json.field("dns_cache_hits", info->dnsCacheHits);
+            json.field("dns_failures", info->dnsFailures);
+            json.field("dns_fallbacks", info->dnsFallbacks);
+            json.field("inflight", info->inflight);
+            json.field("inflight_max", MQTT_INFLIGHT_MAX);
+            json.field("pubacks", info->pubacks);
+            json.field("retransmits", info->retransmits);
+            json.field("duplicate_acks", info->duplicateAcks);
+            json.field("inflight_lost", info->inflightLost);
+            json.endObject();
+
+            json.key("events");
+            json.beginObject();
+            json.field("clients", info->eventClients);
+            json.field("frames", info->eventFrames);
+            json.endObject();
+
+            json.key("sensor_snapshot");
+            json.beginObject();
+            json.field("version", info->snapshotVersion);
+            json.field("bytes", info->snapshotBytes);
+            json.field("served", info->snapshotServed);
+            json.field("not_modified", info->snapshotNotModified);
+            json.endObject();
+
+            SensorStatsJsonVisitor stats(json, info->sensorStats, true);
+            json.key("sensors");
+            json.beginObject();
+            sensors->forEach(stats);
+            json.endObject();
+            json.endObject();
+        });
+    });
 
-        // System info
-        String chipModel = "ESP32";
-        uint8_t cpuCores = chip_info.cores;
-        uint32_t cpuFreq = ESP.getCpuFreqMHz();
-        String sdkVersion = String(ESP.getSdkVersion());
-
-        // RAM info
-        uint32_t totalRam = ESP.getHeapSize();
-        uint32_t freeRam = ESP.getFreeHeap();
-        uint32_t usedRam = totalRam - freeRam;
-        uint32_t largestBlock = ESP.getMaxAllocHeap();
-
-        // Flash info
-        uint32_t flashSize = ESP.getFlashChipSize();
-        uint32_t flashSpeed = ESP.getFlashChipSpeed();
-        uint32_t sketchSize = ESP.getSketchSize();
-        String flashMode;
-        switch(ESP.getFlashChipMode()) {
-            case FM_QIO:  flashMode = "QIO"; break;
-            case FM_QOUT: flashMode = "QOUT"; break;
-            case FM_DIO:  flashMode = "DIO"; break;
-            case FM_DOUT: flashMode = "DOUT"; break;
-            default:      flashMode = "UNKNOWN"; break;
-        }
-
-        // WiFi info
-        bool wifiConnected = (WiFi.status() == WL_CONNECTED);
-        String wifiSSID = WiFi.SSID();
-        String ipAddress = WiFi.localIP().toString();
-        String macAddress = WiFi.macAddress();
-        int32_t rssi = WiFi.RSSI();
-        String gateway = WiFi.gatewayIP().toString();
-
-        // Runtime info
-        uint32_t uptime = millis();
-        String resetReason;
-        switch(esp_reset_reason()) {
-            case ESP_RST_POWERON:   resetReason = "Power On"; break;
-            case ESP_RST_SW:        resetReason = "Software Reset"; break;
-            case ESP_RST_PANIC:     resetReason = "Panic/Exception"; break;
-            case ESP_RST_INT_WDT:   resetReason = "Interrupt Watchdog"; break;
-            case ESP_RST_TASK_WDT:  resetReason = "Task Watchdog"; break;
-            case ESP_RST_WDT:       resetReason = "Watchdog"; break;
-            case ESP_RST_DEEPSLEEP: resetReason = "Deep Sleep"; break;
-            case ESP_RST_BROWNOUT:  resetReason = "Brownout"; break;
-            default:                resetReason = "Unknown"; break;
-        }
-
-        String json = "{";
-        json += "\"chip_model\":\"" + chipModel + "\",";
-        json += "\"cpu_cores\":" + String(cpuCores) + ",";
-        json += "\"cpu_freq\":" + String(cpuFreq) + ",";
-        json += "\"sdk_version\":\"" + sdkVersion + "\",";
-
-        json += "\"total_ram\":" + String(totalRam) + ",";
-        json += "\"free_ram\":" + String(freeRam) + ",";
-        json += "\"used_ram\":" + String(usedRam) + ",";
-        json += "\"largest_block\":" + String(largestBlock) + ",";
-
-        json += "\"flash_size\":" + String(flashSize) + ",";
-        json += "\"flash_speed\":" + String(flashSpeed) + ",";
-        json += "\"flash_mode\":\"" + flashMode + "\",";
-        json += "\"sketch_size\":" + String(sketchSize) + ",";
-
-        json += "\"wifi_connected\":" + String(wifiConnected ? "true" : "false") + ",";
-        json += "\"wifi_ssid\":\"" + wifiSSID + "\",";
-        json += "\"ip_address\":\"" + ipAddress + "\",";
-        json += "\"mac_address\":\"" + macAddress + "\",";
-        json += "\"rssi\":" + String(rssi) + ",";
-        json += "\"gateway\":\"" + gateway + "\",";
-
-        json += "\"uptime\":" + String(uptime) + ",";
-        json += "\"reset_reason\":\"" + resetReason + "\"";
-        json += "}";
-
-        request->send(200, "application/json", json);
+    // Prometheus text exposition format for scrapers, the same data as
+    // /api/metrics plus the counters of the metric registry
+    on("/metrics", HTTP_GET, [this](AsyncWebServerRequest *request){
+        // Read once, every chunk renders the same values: a histogram's
+        // buckets, _sum and _count may be sent in different chunks
+        struct MetricsPage {
+            uint64_t uptimeUs;
+            uint32_t heapFree;
+            uint32_t heapMinFree;
+            uint32_t heapLargestBlock;
+            DurationHistogram loopTime;
+            bool wifiConnected;
+            int32_t rssi;
+            uint32_t counters[METRIC_COUNTER_COUNT];
+            bool mqttConnected;
+            uint32_t connectAttempts;
+            uint32_t connectFailures;
+            uint32_t sessions;
+            uint8_t inflight;
+            uint32_t retransmits;
+            uint16_t queueDepth;
+            uint32_t queueDropped;
+            uint8_t routeCount;
+            uint32_t routeRequests[WEB_ROUTE_MAX];
+            uint32_t eventClients;
+            SensorStatsSnapshot sensorStats;
+            uint32_t droppedReadings;
+        };
+        std::shared_ptr<MetricsPage> page(new MetricsPage());
+        page->uptimeUs = esp_timer_get_time();
+        page->heapFree = ESP.getFreeHeap();
+        page->heapMinFree = ESP.getMinFreeHeap();
+        page->heapLargestBlock = ESP.getMaxAllocHeap();
+        page->loopTime = Metrics::getLoopTime();
+        page->wifiConnected = WiFi.status() == WL_CONNECTED;
+        page->rssi = WiFi.RSSI();
+        for (uint8_t c = 0; c < METRIC_COUNTER_COUNT; c++) {
+            page->counters[c] = Metrics::get((MetricCounter)c);
+        }
+        const MqttClient& client = mqttManager->getClient();
+        page->mqttConnected = client.connected();
+        page->connectAttempts = mqttManager->getConnectAttempts();
+        page->connectFailures = mqttManager->getConnectFailures();
+        page->sessions = mqttManager->getSessions();
+        page->inflight = client.getInflight();
+        page->retransmits = client.getRetransmits();
+        const OutboundQueue& queue = mqttManager->getOutboundQueue();
+        page->queueDepth = queue.getDepth();
+        page->queueDropped = queue.getDropped();
+        page->routeCount = Metrics::getRouteCount();
+        for (uint8_t r = 0; r < page->routeCount; r++) {
+            page->routeRequests[r] = Metrics::getRouteRequests(r);
+        }
+        page->eventClients = events->count();
+        page->sensorStats.capture(sensorTask);
+        page->droppedReadings = sensorTask->getDroppedReadings();
+
+        sendReplayed<PrometheusWriter>(request, "text/plain; version=0.0.4", [this, page](PrometheusWriter& out) {
+            out.family("ppiot_uptime_seconds", "gauge", "Time since boot");
+            out.sampleSeconds("ppiot_uptime_seconds", nullptr, page->uptimeUs);
+            out.family("ppiot_heap_free_bytes", "gauge", "Free heap");
+            out.sample("ppiot_heap_free_bytes", nullptr, page->heapFree);
+            out.family("ppiot_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+            out.sample("ppiot_heap_min_free_bytes", nullptr, page->heapMinFree);
+            out.family("ppiot_heap_largest_block_bytes", "gauge", "Largest heap block that can be allocated");
+            out.sample("ppiot_heap_largest_block_bytes", nullptr, page->heapLargestBlock);
+            out.family("ppiot_loop_seconds", "histogram", "Time from one loop() iteration to the next");
+            out.histogram("ppiot_loop_seconds", nullptr, page->loopTime);
+
+            out.family("ppiot_wifi_connected", "gauge", "1 while connected to the access point");
+            out.sample("ppiot_wifi_connected", nullptr, page->wifiConnected);
+            out.family("ppiot_wifi_rssi_dbm", "gauge", "Signal strength of the access point, 0 while disconnected");
+            out.sample("ppiot_wifi_rssi_dbm", nullptr, page->rssi);
+
+            for (uint8_t c = 0; c < METRIC_COUNTER_COUNT; c++) {
+                MetricCounter counter = (MetricCounter)c;
+                out.family(Metrics::getName(counter), "counter", Metrics::getHelp(counter));
+                out.sample(Metrics::getName(counter), nullptr, page->counters[c]);
+            }
+
+            out.family("ppiot_mqtt_connected", "gauge", "1 while the MQTT session is up");
+            out.sample("ppiot_mqtt_connected", nullptr, page->mqttConnected);
+            out.family("ppiot_mqtt_connect_attempts_total", "counter", "MQTT connection attempts");
+            out.sample("ppiot_mqtt_connect_attempts_total", nullptr, page->connectAttempts);
+            out.family("ppiot_mqtt_connect_failures_total", "counter", "MQTT connection attempts that got no session");
+            out.sample("ppiot_mqtt_connect_failures_total", nullptr, page->connectFailures);
+            out.family("ppiot_mqtt_sessions_total", "counter", "MQTT sessions established, reconnects included");
+            out.sample("ppiot_mqtt_sessions_total", nullptr, page->sessions);
+            out.family("ppiot_mqtt_inflight", "gauge", "QoS 1 messages waiting for their PUBACK");
+            out.sample("ppiot_mqtt_inflight", nullptr, page->inflight);
+            out.family("ppiot_mqtt_retransmits_total", "counter", "QoS 1 messages sent again after a reconnect");
+            out.sample("ppiot_mqtt_retransmits_total", nullptr, page->retransmits);
+            out.family("ppiot_mqtt_queue_depth", "gauge", "Samples waiting to be published");
+            out.sample("ppiot_mqtt_queue_depth", nullptr, page->queueDepth);
+            out.family("ppiot_mqtt_queue_dropped_total", "counter", "Samples dropped from a full queue or too large to publish");
+            out.sample("ppiot_mqtt_queue_dropped_total", nullptr, page->queueDropped);
+
+            char labels[80];
+            out.family("ppiot_http_requests_total", "counter", "HTTP requests per route");
+            for (uint8_t r = 0; r < page->routeCount; r++) {
+                TextBuffer text(labels, sizeof(labels));
+                PrometheusWriter::appendLabel(text, "method", Metrics::getRouteMethod(r));
+                PrometheusWriter::appendLabel(text, "route", Metrics::getRoutePath(r));
+                out.sample("ppiot_http_requests_total", labels, page->routeRequests[r]);
+            }
+            out.family("ppiot_http_event_clients", "gauge", "Dashboards connected to /events");
+            out.sample("ppiot_http_event_clients", nullptr, page->eventClients);
+
+            static const struct {
+                PrometheusSensorVisitor::Part part;
+                const char* name;
+                const char* type;
+                const char* help;
+            } sensorFamilies[] = {
+                { PrometheusSensorVisitor::SAMPLE_TIME, "ppiot_sensor_sample_seconds", "histogram",
+                  "Time from starting a sample until its values were available" },
+                { PrometheusSensorVisitor::START_TIME, "ppiot_sensor_start_seconds", "histogram",
+                  "Time the sampling task was blocked starting a sample" },
+                { PrometheusSensorVisitor::TIMEOUTS, "ppiot_sensor_timeouts_total", "counter",
+                  "Samples slower than SENSOR_SAMPLE_TIMEOUT" },
+                { PrometheusSensorVisitor::READS, "ppiot_sensor_reads_total", "counter",
+                  "Reads per sensor instance" },
+                { PrometheusSensorVisitor::READ_ERRORS, "ppiot_sensor_read_errors_total", "counter",
+                  "Failed reads per sensor instance" },
+            };
+            for (const auto& family : sensorFamilies) {
+                out.family(family.name, family.type, family.help);
+                PrometheusSensorVisitor visitor(out, page->sensorStats, family.part, family.name);
+                sensors->forEach(visitor);
+            }
+            out.family("ppiot_sensor_dropped_readings_total", "counter", "Readings lost to a full sensor queue");
+            out.sample("ppiot_sensor_dropped_readings_total", nullptr, page->droppedReadings);
+        });
     });
 
     // WiFi scan route
-    server->on("/scan", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String json = "[";
+    on("/scan", HTTP_GET, [this](AsyncWebServerRequest *request){
+        // Results are copied out, they are deleted before the response is sent
+        struct ScanResults {
+            struct Network {
+                char ssid[33];
+                char bssid[18];
+                int32_t rssi;
+                uint8_t channel;
+                uint8_t secure;
+            };
+            Network networks[WEB_SCAN_MAX];
+            uint8_t count;
+        };
+        std::shared_ptr<ScanResults> results(new ScanResults());
+        results->count = 0;
         int n = WiFi.scanComplete();
 
         if (n == -2) {
@@ -171,12 +1199,8 @@ void WebServer::setupRoutes() {
                 scanInProgress = true;
                 WiFi.scanNetworks(true);
             }
-            json += "]";
-            request->send(200, "application/json", json);
         } else if (n == -1) {
             // Scan in progress - don't log repeatedly
-            json += "]";
-            request->send(200, "application/json", json);
         } else {
             // Scan complete, return results
             if (scanInProgress) {
@@ -197,15 +1221,13 @@ void WebServer::setupRoutes() {
                 scanInProgress = false;
             }
 
-            for (int i = 0; i < n; ++i) {
-                if (i) json += ",";
-                json += "{";
-                json += "\"rssi\":" + String(WiFi.RSSI(i));
-                json += ",\"ssid\":\"" + WiFi.SSID(i) + "\"";
-                json += ",\"bssid\":\"" + WiFi.BSSIDstr(i) + "\"";
-                json += ",\"channel\":" + String(WiFi.channel(i));
-                json += ",\"secure\":" + String(WiFi.encryptionType(i));
-                json += "}";
+            for (int i = 0; i < n && results->count < WEB_SCAN_MAX; ++i) {
+                ScanResults::Network& network = results->networks[results->count++];
+                strlcpy(network.ssid, WiFi.SSID(i).c_str(), sizeof(network.ssid));
+                strlcpy(network.bssid, WiFi.BSSIDstr(i).c_str(), sizeof(network.bssid));
+                network.rssi = WiFi.RSSI(i);
+                network.channel = WiFi.channel(i);
+                network.secure = WiFi.encryptionType(i);
             }
 
             WiFi.scanDelete();
@@ -214,13 +1236,26 @@ void WebServer::setupRoutes() {
                 WiFi.scanNetworks(true);
                 scanInProgress = true;
             }
-            json += "]";
-            request->send(200, "application/json", json);
         }
+
+        sendJson(request, [results](JsonWriter& json) {
+            json.beginArray();
+            for (uint8_t i = 0; i < results->count; i++) {
+                const ScanResults::Network& network = results->networks[i];
+                json.beginObject();
+                json.field("rssi", network.rssi);
+                json.field("ssid", network.ssid);
+                json.field("bssid", network.bssid);
+                json.field("channel", network.channel);
+                json.field("secure", network.secure);
+                json.endObject();
+            }
+            json.endArray();
+        });
     });
 
     // Retry connection route
-    server->on("/retry", HTTP_GET, [this](AsyncWebServerRequest *request){
+    on("/retry", HTTP_GET, [this](AsyncWebServerRequest *request){
         if (retryInProgress) {
             request->send(400, "text/plain", "Retry already in progress");
             return;
@@ -247,27 +1282,39 @@ void WebServer::setupRoutes() {
     });
 
     // Info route - return saved credentials info and connection status
-    server->on("/info", HTTP_GET, [this](AsyncWebServerRequest *request){
+    on("/info", HTTP_GET, [this](AsyncWebServerRequest *request){
         String savedSSID = "";
         String savedPassword = "";
         bool hasCredentials = wifiManager->loadSavedCredentials(savedSSID, savedPassword);
-        bool isConnected = (WiFi.status() == WL_CONNECTED);
-        String currentSSID = WiFi.SSID();
-        String ipAddress = WiFi.localIP().toString();
-
-        String json = "{";
-        json += "\"saved_ssid\":\"" + savedSSID + "\",";
-        json += "\"has_saved\":" + String(hasCredentials ? "true" : "false") + ",";
-        json += "\"connected\":" + String(isConnected ? "true" : "false") + ",";
-        json += "\"current_ssid\":\"" + currentSSID + "\",";
-        json += "\"ip_address\":\"" + ipAddress + "\"";
-        json += "}";
-
-        request->send(200, "application/json", json);
+
+        // Read once, every chunk renders the same values
+        struct Info {
+            char savedSsid[33];
+            bool hasSaved;
+            bool connected;
+            char ssid[33];
+            char ip[16];
+        };
+        std::shared_ptr<Info> info(new Info());
+        strlcpy(info->savedSsid, savedSSID.c_str(), sizeof(info->savedSsid));
+        info->hasSaved = hasCredentials;
+        info->connected = WiFi.status() == WL_CONNECTED;
+        strlcpy(info->ssid, WiFi.SSID().c_str(), sizeof(info->ssid));
+        formatIp(info->ip, sizeof(info->ip), WiFi.localIP());
+
+        sendJson(request, [info](JsonWriter& json) {
+            json.beginObject();
+            json.field("saved_ssid", info->savedSsid);
+            json.field("has_saved", info->hasSaved);
+            json.field("connected", info->connected);
+            json.field("current_ssid", info->ssid);
+            json.field("ip_address", info->ip);
+            json.endObject();
+        });
     });
 
     // Disconnect from WiFi
-    server->on("/disconnect", HTTP_GET, [this](AsyncWebServerRequest *request){
+    on("/disconnect", HTTP_GET, [this](AsyncWebServerRequest *request){
         Serial.println("[DISCONNECT] Disconnecting from WiFi...");
         WiFi.disconnect();
         *isAPMode = true;
@@ -275,7 +1322,7 @@ void WebServer::setupRoutes() {
     });
 
     // Clear saved credentials
-    server->on("/clear", HTTP_GET, [this](AsyncWebServerRequest *request){
+    on("/clear", HTTP_GET, [this](AsyncWebServerRequest *request){
         Serial.println("[CLEAR] Clearing saved WiFi credentials...");
         wifiManager->clearCredentials();
         WiFi.disconnect();
@@ -284,7 +1331,7 @@ void WebServer::setupRoutes() {
     });
 
     // Check connection route
-    server->on("/check", HTTP_POST, [this](AsyncWebServerRequest *request){
+    on("/check", HTTP_POST, [this](AsyncWebServerRequest *request){
         if (checkInProgress) {
             request->send(400, "text/plain", "Check already in progress");
             return;
@@ -315,7 +1362,7 @@ void WebServer::setupRoutes() {
     });
 
     // Save credentials route
-    server->on("/save", HTTP_POST, [this](AsyncWebServerRequest *request){
+    on("/save", HTTP_POST, [this](AsyncWebServerRequest *request){
         if (saveInProgress) {
             request->send(400, "text/plain", "Save already in progress");
             return;
@@ -459,3 +1506,65 @@ void WebServer::handleRetryRequest() {
         retryInProgress = false;
     }
 }
+
+void WebServer::queueReading(const SensorReading& reading) {
+    if (reading.valid) {
+        latestValues[reading.channel] = reading.value;
+    }
+    latestValid[reading.channel] = reading.valid;
+    eventMask |= 1u << reading.channel;
+    snapshotDirty = true;
+}
+
+void WebServer::updateSnapshot() {
+    if (!snapshotDirty) {
+        return;
+    }
+    snapshotDirty = false;
+
+    uint8_t next = snapshotCurrent ^ 1;
+    Snapshot& snapshot = snapshots[next];
+    snapshot.seq++; // odd, being written
+    JsonWriter json(snapshot.data, sizeof(snapshot.data));
+    json.beginObject();
+    SensorJsonVisitor visitor(json, latestValues, latestValid);
+    sensors->forEach(visitor);
+    json.endObject();
+    if (json.isFull()) {
+        snapshot.seq++;
+        Serial.println("[WEB] Sensor snapshot exceeds WEB_SNAPSHOT_MAX, serving the previous one");
+        return;
+    }
+    snapshot.length = json.getLength();
+    snprintf(snapshot.etag, sizeof(snapshot.etag), "\"%08lx-%lu\"",
+             (unsigned long)snapshotBoot, (unsigned long)++snapshotVersion);
+    snapshot.seq++;
+    snapshotCurrent = next;
+}
+
+void WebServer::publishEvents() {
+    if (eventMask == 0) {
+        return;
+    }
+    if (events->count() == 0) {
+        eventMask = 0; // nobody listening, new clients load /api/sensor first
+        return;
+    }
+
+    char buffer[WEB_EVENT_MAX];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    EventVisitor visitor(json, latestValues, latestValid, eventMask);
+    sensors->forEach(visitor);
+    json.endObject();
+    eventMask = 0;
+
+    if (visitor.empty) {
+        return; // only other instances changed, the dashboard shows the first
+    }
+    if (json.isFull()) {
+        Serial.println("[WEB] Event frame exceeds WEB_EVENT_MAX, dropped");
+        return;
+    }
+    events->send(buffer, "reading", ++eventId);
+}
@@ -3,17 +3,59 @@
 
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
+#include <atomic>
 #include "wifi_manager.h"
-#include "temperature.h"
+#include "sensors.h"
+#include "sensor_task.h"
+#include "mqtt.h"
+#include "history.h"
+#include "sample_log.h"
+#include "rollup.h"
+#include "sensor_reading.h"
+
+static_assert(CHANNEL_COUNT <= 16, "eventMask holds 16 channels");
 
 class WebServer {
 private:
     AsyncWebServer* server;
     WiFiManager* wifiManager;
-    TemperatureSensor* tempSensor;
-    DS18B20Sensor* ds18b20Sensor;
+    SensorSet* sensors;
+    SensorTask* sensorTask;
+    MQTTManager* mqttManager;
+    SensorHistory* history;
+    SampleLog* sampleLog;
+    RollupStore* rollupStore;
     bool* isAPMode;
 
+    // Latest filtered reading per channel, the source of /api/sensor and
+    // /events; a failed read keeps the last good value
+    float latestValues[CHANNEL_COUNT];
+    bool latestValid[CHANNEL_COUNT];
+
+    // Live readings pushed to /events, one frame per sampling cycle
+    AsyncEventSource* events;
+    struct EventVisitor;
+    uint16_t eventMask;     // channels read since the last frame
+    uint32_t eventId;
+
+    // /api/sensor body, rebuilt once per sampling cycle and served as is with
+    // its version as the ETag. The loop task writes the slot that is not
+    // current and then flips; seq is odd while a slot is written, so a request
+    // copying a slot can tell it was overwritten meanwhile and copy again.
+    struct Snapshot {
+        char data[WEB_SNAPSHOT_MAX];
+        uint16_t length;
+        char etag[24];      // "<boot>-<version>"
+        std::atomic<uint32_t> seq;
+    };
+    Snapshot snapshots[2];
+    std::atomic<uint8_t> snapshotCurrent;
+    uint32_t snapshotBoot;      // random, ETags of an earlier boot never match
+    uint32_t snapshotVersion;
+    bool snapshotDirty;
+    std::atomic<uint32_t> snapshotServed;       // counted on the async_tcp task
+    std::atomic<uint32_t> snapshotNotModified;
+
     // Operation state variables
     bool scanInProgress;
     bool retryInProgress;
@@ -33,9 +75,11 @@ private:
     String checkPassword;
 
     void setupRoutes();
+    // server->on() with a request counter for /metrics
+    void on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction handler);
 
 public:
-    WebServer(WiFiManager* wifiMgr, TemperatureSensor* tempSens, DS18B20Sensor* ds18b20Sens, bool* apMode);
+    WebServer(WiFiManager* wifiMgr, SensorSet* sensorSet, SensorTask* task, MQTTManager* mqttMgr, SensorHistory* hist, SampleLog* log, RollupStore* rollups, bool* apMode);
     ~WebServer();
 
     void begin();
@@ -43,6 +87,12 @@ public:
     void handleCheckRequest();
     void handleRetryRequest();
 
+    // Feed every (filtered) reading, publishEvents() sends what changed
+    void queueReading(const SensorReading& reading);
+    void publishEvents();
+    // Rebuild the /api/sensor snapshot if readings arrived, call after queueReading()
+    void updateSnapshot();
+
     bool isSaveInProgress() const { return saveInProgress; }
     bool isCheckInProgress() const { return checkInProgress; }
     bool isRetryInProgress() const { return retryInProgress; }
@@ -1,7 +1,7 @@
 #ifndef WEBSERVER_HTML_H
 #define WEBSERVER_HTML_H
 
-// HTML for the configuration portal
+// HTML for the configuration portal, served gzipped from web_assets.h (tools/build_web_assets.py)
 const char index_html[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
@@ -1,5 +1,6 @@
 #include "wifi_manager.h"
 #include "config.h"
+#include "metrics.h"
 #include <Arduino.h>
 
 WiFiManager::WiFiManager() {
@@ -165,6 +166,7 @@ void WiFiManager::handleAutoReconnect() {
 
                     WiFi.begin(savedSSID.c_str(), savedPassword.c_str());
                     autoReconnecting = true;
+                    Metrics::add(METRIC_WIFI_DISCONNECTS);
                     autoReconnectStartTime = currentMillis;
                 }
             } else {
@@ -202,6 +204,7 @@ void WiFiManager::handleAutoReconnect() {
                 Serial.println(WiFi.localIP());
                 autoReconnecting = false;
                 autoReconnectStartTime = 0;
+                Metrics::add(METRIC_WIFI_RECONNECTS);
             }
         }
     }
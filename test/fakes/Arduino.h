@@ -0,0 +1,205 @@
+#pragma once
+// Host stand-in for the ESP32 Arduino core, see fake_host.h
+#include <strings.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string>
+#include "fake_host.h"
+#include "esp_sntp.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#define PROGMEM
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+#define F(x) (x)
+
+typedef uint8_t byte;
+
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size) {
+        size_t n = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return length;
+}
+
+inline unsigned long millis() { return (unsigned long)(uint32_t)(fake::nowUs / 1000); }
+inline unsigned long micros() { return (unsigned long)(uint32_t)fake::nowUs; }
+inline void delay(unsigned long ms) { fake::sleepUs((uint64_t)ms * 1000); }
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return LOW; }
+
+namespace fake {
+inline uint32_t randomState = 1;
+}
+inline long random(long low, long high) {
+    fake::randomState = fake::randomState * 1103515245u + 12345u;
+    return high > low ? low + (long)((fake::randomState >> 8) % (uint32_t)(high - low)) : low;
+}
+
+class String {
+public:
+    std::string s;
+    String() {}
+    String(const char* c) : s(c ? c : "") {}
+    String(const String& o) = default;
+    String(char c) : s(1, c) {}
+    String(int v, unsigned char base = 10) : s(std::to_string(v)) {}
+    String(unsigned int v, unsigned char base = 10) : s(std::to_string(v)) {}
+    String(long v, unsigned char base = 10) : s(std::to_string(v)) {}
+    String(unsigned long v, unsigned char base = 10) : s(std::to_string(v)) {}
+    String(double v, unsigned int decimals = 2) {
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, v);
+        s = buffer;
+    }
+    String& operator=(const String&) = default;
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { s += o; return *this; }
+    String& operator+=(char o) { s += o; return *this; }
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    int toInt() const { return atoi(s.c_str()); }
+    void remove(unsigned int i) { s.erase(i); }
+    int indexOf(const String& o) const { size_t p = s.find(o.s); return p == std::string::npos ? -1 : (int)p; }
+    bool equalsIgnoreCase(const String& o) const { return strcasecmp(s.c_str(), o.s.c_str()) == 0; }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* o) const { return s == o; }
+    bool operator!=(const String& o) const { return s != o.s; }
+};
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            write(buffer[i]);
+        }
+        return size;
+    }
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return n > 0 ? write(buffer) : 0;
+    }
+    size_t print(const String& v) { return write(v.c_str()); }
+    size_t print(const char* v) { return write(v); }
+    size_t print(char v) { return write((uint8_t)v); }
+    size_t print(int v, int = 10) { return printf("%d", v); }
+    size_t print(unsigned int v, int = 10) { return printf("%u", v); }
+    size_t print(long v, int = 10) { return printf("%ld", v); }
+    size_t print(unsigned long v, int = 10) { return printf("%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v) { size_t n = print(v); return n + println(); }
+};
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class IPAddress : public Printable {
+private:
+    uint8_t bytes[4];
+
+public:
+    IPAddress() { memset(bytes, 0, sizeof(bytes)); }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { bytes[0] = a; bytes[1] = b; bytes[2] = c; bytes[3] = d; }
+    // Network byte order, like lwIP's ip4_addr_t
+    IPAddress(uint32_t address) { memcpy(bytes, &address, 4); }
+    operator uint32_t() const { uint32_t address; memcpy(&address, bytes, 4); return address; }
+    uint8_t operator[](int i) const { return bytes[i]; }
+    String toString() const {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+        return String(buffer);
+    }
+    bool fromString(const char* text) {
+        unsigned a, b, c, d;
+        char tail;
+        if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+            return false;
+        }
+        bytes[0] = a; bytes[1] = b; bytes[2] = c; bytes[3] = d;
+        return true;
+    }
+    size_t printTo(Print& p) const override { return p.print(toString()); }
+};
+
+namespace fake {
+// Serial output is dropped unless a test wants to see it
+inline bool serialEcho = false;
+}
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    void flush() { fflush(stdout); }
+    size_t write(uint8_t c) override {
+        if (fake::serialEcho) {
+            fputc(c, stdout);
+        }
+        return 1;
+    }
+    using Print::write;
+    using Print::print;
+    using Print::println;
+    size_t print(const IPAddress& v) { return v.printTo(*this); }
+    size_t println(const IPAddress& v) { return print(v) + println(); }
+};
+inline HardwareSerial Serial;
+
+inline void configTime(long, int, const char*, const char* = nullptr, const char* = nullptr) {
+    fake::Untracked untracked;
+    fake::sntpStarts++;
+    if (fake::sntpReachable) {
+        fake::tcpipJobs.push_back([]() { fake::answerSntp(); });
+    }
+}
+
+typedef enum { FM_QIO, FM_QOUT, FM_DIO, FM_DOUT, FM_FAST_READ, FM_SLOW_READ, FM_UNKNOWN = 0xff } FlashMode_t;
+
+namespace fake {
+inline uint32_t freeHeap = 200000;
+}
+
+class EspClass {
+public:
+    uint32_t getCpuFreqMHz() { return 240; }
+    const char* getSdkVersion() { return "host"; }
+    uint32_t getHeapSize() { return 320000; }
+    uint32_t getFreeHeap() { return fake::freeHeap; }
+    uint32_t getMaxAllocHeap() { return fake::freeHeap / 2; }
+    uint32_t getMinFreeHeap() { return fake::freeHeap; }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    uint32_t getFlashChipSpeed() { return 40000000; }
+    uint32_t getSketchSize() { return 1024 * 1024; }
+    FlashMode_t getFlashChipMode() { return FM_DIO; }
+    void restart() {}
+};
+inline EspClass ESP;
@@ -0,0 +1,343 @@
+#pragma once
+// AsyncClient connected to a broker stand-in. Bytes handed over with add()
+// sit in the send buffer until send() puts them on the wire; the broker then
+// parses the MQTT packets and its replies and the TCP ACKs arrive on the
+// next fake::runTasks(), as they would from the async_tcp task. The broker
+// can black-hole (accept the connection, never acknowledge a byte) or drop
+// the connection. With rttMs or bytesPerMs set, replies and ACKs wait for
+// the simulated clock instead: a send takes length / bytesPerMs on the link
+// and is answered one round trip after it is through.
+#include <Arduino.h>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+class AsyncClient;
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+
+namespace fake {
+
+struct MqttMessage {
+    std::string topic;
+    std::vector<uint8_t> payload;
+    uint8_t qos;
+    bool retained;
+    bool dup;
+    uint16_t packetId;
+};
+
+struct Broker {
+    bool reachable = true;          // answers the SYN
+    bool blackHole = false;         // connected, but nothing is ever acknowledged
+    bool autoPuback = true;         // false: the test acknowledges with puback()
+    bool keepMessages = true;       // false: parse and acknowledge, but don't record
+    bool hasSession = false;        // kept from a CONNECT with clean session off
+    size_t sendBuffer = 5744;       // CONFIG_TCP_SND_BUF_DEFAULT of the Arduino core
+    uint32_t rttMs = 0;
+    uint32_t bytesPerMs = 0;        // 0 = no serialization delay
+    uint32_t connects = 0;
+    uint32_t segments = 0;          // send() calls that put bytes on the wire, Nagle is off
+    std::vector<MqttMessage> messages;
+    std::vector<uint16_t> unacknowledged;   // QoS 1 packet ids while autoPuback is off
+    std::vector<uint8_t> outbox;    // packets for the client, sent on its next run
+    std::vector<uint8_t> rx;        // partial packet being parsed
+    uint32_t lastAddress = 0;
+
+    void reset() { *this = Broker(); }
+
+    // Acknowledges a QoS 1 publish held back by autoPuback = false
+    void puback(uint16_t packetId) {
+        const uint8_t packet[4] = { 0x40, 0x02, (uint8_t)(packetId >> 8), (uint8_t)packetId };
+        outbox.insert(outbox.end(), packet, packet + sizeof(packet));
+        for (size_t i = 0; i < unacknowledged.size(); i++) {
+            if (unacknowledged[i] == packetId) {
+                unacknowledged.erase(unacknowledged.begin() + i);
+                break;
+            }
+        }
+    }
+
+    // Handles every complete packet in rx, reply() queues bytes for the client
+    template <typename Reply>
+    void parse(Reply reply) {
+        for (;;) {
+            if (rx.size() < 2) {
+                return;
+            }
+            size_t remaining = 0;
+            size_t n = 1;
+            int shift = 0;
+            for (;;) {
+                if (n >= rx.size()) {
+                    return;
+                }
+                uint8_t b = rx[n++];
+                remaining |= (size_t)(b & 0x7F) << shift;
+                shift += 7;
+                if (!(b & 0x80)) {
+                    break;
+                }
+            }
+            if (rx.size() < n + remaining) {
+                return;
+            }
+            uint8_t header = rx[0];
+            const uint8_t* body = rx.data() + n;
+            handle(header, body, remaining, reply);
+            rx.erase(rx.begin(), rx.begin() + n + remaining);
+        }
+    }
+
+    template <typename Reply>
+    void handle(uint8_t header, const uint8_t* body, size_t length, Reply reply) {
+        switch (header >> 4) {
+        case 1: { // CONNECT
+            // Connect flags follow the protocol name and level
+            bool clean = length > 7 && (body[7] & 0x02);
+            bool present = !clean && hasSession;
+            hasSession = !clean;
+            const uint8_t connack[4] = { 0x20, 0x02, (uint8_t)(present ? 1 : 0), 0x00 };
+            reply(connack, sizeof(connack));
+            break;
+        }
+        case 3: { // PUBLISH
+            MqttMessage message;
+            size_t topicLength = (body[0] << 8) | body[1];
+            message.topic.assign((const char*)body + 2, topicLength);
+            size_t offset = 2 + topicLength;
+            message.qos = (header >> 1) & 0x03;
+            message.retained = header & 0x01;
+            message.dup = header & 0x08;
+            message.packetId = 0;
+            if (message.qos) {
+                message.packetId = (body[offset] << 8) | body[offset + 1];
+                offset += 2;
+            }
+            message.payload.assign(body + offset, body + length);
+            if (keepMessages) {
+                messages.push_back(message);
+            }
+            if (message.qos && autoPuback) {
+                const uint8_t puback[4] = { 0x40, 0x02, (uint8_t)(message.packetId >> 8), (uint8_t)message.packetId };
+                reply(puback, sizeof(puback));
+            } else if (message.qos) {
+                unacknowledged.push_back(message.packetId);
+            }
+            break;
+        }
+        case 12: { // PINGREQ
+            const uint8_t pingresp[2] = { 0xD0, 0x00 };
+            reply(pingresp, sizeof(pingresp));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+};
+inline Broker broker;
+
+} // namespace fake
+
+class AsyncClient {
+private:
+    AcConnectHandler connectHandler;
+    AcConnectHandler disconnectHandler;
+    AcAckHandler ackHandler;
+    AcDataHandler dataHandler;
+    void* connectArg = nullptr;
+    void* disconnectArg = nullptr;
+    void* ackArg = nullptr;
+    void* dataArg = nullptr;
+
+    bool isConnected = false;
+    bool connectPending = false;
+    bool disconnectPending = false;
+    size_t queued = 0;          // added, not yet sent
+    size_t inFlight = 0;        // sent, not yet acknowledged
+    size_t ackPending = 0;      // acknowledged by the broker, callback not yet run
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> replies;
+    size_t taskIndex;
+
+    // Sends still on the simulated link, oldest first
+    struct Delivery {
+        uint64_t atUs;
+        size_t acked;
+        std::vector<uint8_t> replies;
+    };
+    std::deque<Delivery> deliveries;
+    uint64_t linkFreeUs = 0;
+
+    void run() {
+        fake::Untracked untracked;
+        if (connectPending) {
+            connectPending = false;
+            if (fake::broker.reachable) {
+                isConnected = true;
+                fake::broker.connects++;
+                fake::broker.rx.clear();
+                if (connectHandler) {
+                    connectHandler(connectArg, this);
+                }
+            } else if (disconnectHandler) {
+                disconnectHandler(disconnectArg, this);
+            }
+        }
+        if (disconnectPending) {
+            disconnectPending = false;
+            if (disconnectHandler) {
+                disconnectHandler(disconnectArg, this);
+            }
+            return;
+        }
+        if (!isConnected) {
+            return;
+        }
+        while (!deliveries.empty() && deliveries.front().atUs <= fake::nowUs) {
+            ackPending += deliveries.front().acked;
+            replies.insert(replies.end(), deliveries.front().replies.begin(), deliveries.front().replies.end());
+            deliveries.pop_front();
+        }
+        if (!fake::broker.outbox.empty()) {
+            replies.insert(replies.end(), fake::broker.outbox.begin(), fake::broker.outbox.end());
+            fake::broker.outbox.clear();
+        }
+        if (ackPending) {
+            size_t n = ackPending;
+            ackPending = 0;
+            inFlight -= n;
+            if (ackHandler) {
+                ackHandler(ackArg, this, n, 1);
+            }
+        }
+        if (!replies.empty()) {
+            std::vector<uint8_t> data;
+            data.swap(replies);
+            if (dataHandler) {
+                dataHandler(dataArg, this, data.data(), data.size());
+            }
+        }
+    }
+
+public:
+    // Every client the code under test created, newest last
+    static std::vector<AsyncClient*>& all() {
+        static std::vector<AsyncClient*> clients;
+        return clients;
+    }
+
+    AsyncClient(void* = nullptr) {
+        taskIndex = fake::tasks.size();
+        fake::tasks.push_back([this]() { run(); });
+        all().push_back(this);
+    }
+    ~AsyncClient() {
+        if (taskIndex < fake::tasks.size()) {
+            fake::tasks[taskIndex] = []() {};
+        }
+        for (size_t i = 0; i < all().size(); i++) {
+            if (all()[i] == this) {
+                all().erase(all().begin() + i);
+                break;
+            }
+        }
+    }
+
+    bool connect(IPAddress ip, uint16_t) {
+        if (isConnected || connectPending) {
+            return false;
+        }
+        fake::broker.lastAddress = (uint32_t)ip;
+        queued = inFlight = ackPending = 0;
+        buffer.clear();
+        replies.clear();
+        deliveries.clear();
+        fake::broker.outbox.clear();
+        connectPending = true;
+        return true;
+    }
+
+    void close(bool now = false) {
+        if (!isConnected && !connectPending) {
+            return;
+        }
+        if (!now) {
+            send();
+        }
+        isConnected = false;
+        connectPending = false;
+        disconnectPending = true;
+        queued = inFlight = ackPending = 0;
+        buffer.clear();
+        replies.clear();
+        deliveries.clear();
+    }
+
+    // Simulated network failure, the disconnect callback follows
+    void drop() { close(true); }
+
+    size_t space() {
+        size_t used = queued + inFlight;
+        if (!isConnected || used >= fake::broker.sendBuffer) {
+            return 0;
+        }
+        return fake::broker.sendBuffer - used;
+    }
+    size_t add(const char* data, size_t size, uint8_t = ASYNC_WRITE_FLAG_COPY) {
+        fake::Untracked untracked;
+        size_t room = space();
+        size_t n = size < room ? size : room;
+        buffer.insert(buffer.end(), data, data + n);
+        queued += n;
+        return n;
+    }
+    bool send() {
+        fake::Untracked untracked;
+        if (!isConnected) {
+            return false;
+        }
+        if (queued == 0) {
+            return true;
+        }
+        fake::broker.segments++;
+        inFlight += queued;
+        size_t n = queued;
+        queued = 0;
+        std::vector<uint8_t> wire;
+        wire.swap(buffer);
+        if (fake::broker.blackHole) {
+            return true;
+        }
+        fake::broker.rx.insert(fake::broker.rx.end(), wire.begin(), wire.end());
+        if (!fake::broker.rttMs && !fake::broker.bytesPerMs) {
+            ackPending += n;
+            fake::broker.parse([this](const uint8_t* data, size_t length) {
+                replies.insert(replies.end(), data, data + length);
+            });
+            return true;
+        }
+
+        Delivery delivery;
+        uint64_t start = linkFreeUs > fake::nowUs ? linkFreeUs : fake::nowUs;
+        linkFreeUs = start + (fake::broker.bytesPerMs ? (uint64_t)n * 1000 / fake::broker.bytesPerMs : 0);
+        delivery.atUs = linkFreeUs + (uint64_t)fake::broker.rttMs * 1000;
+        delivery.acked = n;
+        fake::broker.parse([&delivery](const uint8_t* data, size_t length) {
+            delivery.replies.insert(delivery.replies.end(), data, data + length);
+        });
+        deliveries.push_back(delivery);
+        return true;
+    }
+
+    void setNoDelay(bool) {}
+    void onConnect(AcConnectHandler cb, void* arg = nullptr) { connectHandler = cb; connectArg = arg; }
+    void onDisconnect(AcConnectHandler cb, void* arg = nullptr) { disconnectHandler = cb; disconnectArg = arg; }
+    void onAck(AcAckHandler cb, void* arg = nullptr) { ackHandler = cb; ackArg = arg; }
+    void onData(AcDataHandler cb, void* arg = nullptr) { dataHandler = cb; dataArg = arg; }
+};
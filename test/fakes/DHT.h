@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+
+#define DHT22 22
+
+namespace fake {
+// Next values the DHT22 returns, NAN for a failed read
+inline float dhtTemperature = 21.5f;
+inline float dhtHumidity = 45.0f;
+// How long a read holds the CPU, the library bit-bangs ~5 ms with interrupts off
+inline uint32_t dhtReadUs = 0;
+}
+
+class DHT {
+public:
+    DHT(uint8_t, uint8_t, uint8_t = 6) {}
+    void begin(uint8_t = 55) {}
+    float readTemperature(bool = false, bool = false) {
+        fake::nowUs += fake::dhtReadUs;
+        return fake::dhtTemperature;
+    }
+    float readHumidity(bool = false) { return fake::dhtHumidity; }
+    // The formula is the library's business, tests only need a value
+    float computeHeatIndex(float temperature, float humidity, bool = true) { return temperature; }
+};
@@ -0,0 +1,105 @@
+#pragma once
+// DallasTemperature on the fake bus in OneWire.h. With setWaitForConversion(true)
+// requestTemperatures() blocks in delay() for the conversion, like the library.
+#include <OneWire.h>
+
+#define DEVICE_DISCONNECTED_C -127
+typedef uint8_t DeviceAddress[8];
+
+class DallasTemperature {
+private:
+    bool waitForConversion = true;
+
+    fake::Probe* find(const uint8_t* address) {
+        for (fake::Probe& probe : fake::oneWire.probes) {
+            if (memcmp(probe.address, address, 8) == 0 && probe.connected) {
+                return &probe;
+            }
+        }
+        return nullptr;
+    }
+
+    // requestTemperatures() waits for the highest resolution on the bus
+    uint32_t actualConversionUs() const {
+        uint8_t bits = 9;
+        for (const fake::Probe& probe : fake::oneWire.probes) {
+            if (probe.resolution > bits) {
+                bits = probe.resolution;
+            }
+        }
+        return (uint32_t)(millisFor(bits) * 1000 * fake::oneWire.conversionSpeed);
+    }
+    static uint16_t millisFor(uint8_t bits) {
+        switch (bits) {
+            case 9: return 94;
+            case 10: return 188;
+            case 11: return 375;
+            default: return 750;
+        }
+    }
+    void finishConversion() {
+        fake::OneWireBus& bus = fake::oneWire;
+        if (bus.converting && fake::nowUs - bus.conversionStartUs >= actualConversionUs()) {
+            bus.converting = false;
+            for (fake::Probe& probe : bus.probes) {
+                // Resolution drops the low bits of the reading
+                float step = 0.0625f * (1 << (12 - probe.resolution));
+                probe.scratchpad = floorf(probe.temperature / step) * step;
+            }
+        }
+    }
+
+public:
+    DallasTemperature(OneWire*) {}
+    void begin() {}
+    uint8_t getDeviceCount() { return fake::oneWire.probes.size(); }
+    bool getAddress(uint8_t* address, uint8_t index) {
+        if (index >= fake::oneWire.probes.size()) {
+            return false;
+        }
+        memcpy(address, fake::oneWire.probes[index].address, 8);
+        return true;
+    }
+    bool setResolution(const uint8_t* address, uint8_t bits, bool = false) {
+        fake::Probe* probe = find(address);
+        if (!probe || bits < 9 || bits > 12) {
+            return false;
+        }
+        probe->resolution = bits;
+        return true;
+    }
+    void setWaitForConversion(bool wait) { waitForConversion = wait; }
+    bool isParasitePowerMode() { return fake::oneWire.parasite; }
+
+    // Reads a bit from the bus, which a parasite-powered probe cannot answer
+    // while it draws its conversion current from the data line
+    bool isConversionComplete() {
+        fake::oneWire.completionPolls++;
+        finishConversion();
+        return !fake::oneWire.converting;
+    }
+    uint16_t millisToWaitForConversion(uint8_t bits) { return millisFor(bits); }
+
+    struct request_t {
+        bool result;
+        unsigned long timestamp;
+    };
+    request_t requestTemperatures() {
+        fake::oneWire.converting = true;
+        fake::oneWire.conversionStartUs = fake::nowUs;
+        fake::oneWire.conversions++;
+        if (waitForConversion) {
+            delay(actualConversionUs() / 1000 + 1);
+        }
+        return { true, millis() };
+    }
+    float getTempC(const uint8_t* address) {
+        fake::Probe* probe = find(address);
+        if (!probe) {
+            return DEVICE_DISCONNECTED_C;
+        }
+        fake::nowUs += fake::oneWire.scratchpadReadUs;
+        finishConversion();
+        return probe->scratchpad;
+    }
+};
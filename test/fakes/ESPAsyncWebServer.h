@@ -0,0 +1,235 @@
+#pragma once
+// ESPAsyncWebServer stand-in. Routes are kept so a test can call a handler
+// with a fake request, responses are captured and chunked ones drained with
+// a chosen buffer size. AsyncEventSource counts simulated clients and keeps
+// every frame it was asked to send.
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_ANY = 127 } WebRequestMethod;
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+class AsyncWebParameter {
+public:
+    String paramName;
+    String paramValue;
+    const String& name() const { return paramName; }
+    const String& value() const { return paramValue; }
+};
+
+class AsyncWebHeader {
+public:
+    String headerValue;
+    const String& value() const { return headerValue; }
+};
+
+class AsyncWebServerResponse {
+public:
+    int code = 200;
+    String contentType;
+    std::string body;               // static body
+    AwsResponseFiller filler;       // chunked or callback body
+    size_t length = 0;              // of a callback body with known length
+    bool chunked = false;
+    std::map<std::string, std::string> headers;
+
+    virtual ~AsyncWebServerResponse() {}
+    void addHeader(const String& name, const String& value) { headers[name.c_str()] = value.c_str(); }
+
+    // Runs the filler until it returns 0 (chunked) or length bytes are out,
+    // 'window' is the room AsyncTCP offers per call
+    std::string drain(size_t window = 1460) {
+        if (!filler) {
+            return body;
+        }
+        std::string out;
+        std::vector<uint8_t> buffer(window);
+        for (uint32_t calls = 0; calls < 1000000; calls++) {
+            if (!chunked && out.size() >= length) {
+                break;
+            }
+            size_t room = chunked ? window : std::min(window, length - out.size());
+            size_t n = filler(buffer.data(), room, out.size());
+            if (n == RESPONSE_TRY_AGAIN) {
+                continue;
+            }
+            if (n == 0) {
+                break;
+            }
+            out.append((const char*)buffer.data(), n);
+        }
+        return out;
+    }
+};
+
+class AsyncWebServerRequest {
+public:
+    std::string path;
+    std::vector<AsyncWebParameter> params;      // query string
+    std::vector<AsyncWebParameter> postParams;  // form body
+    std::map<std::string, AsyncWebHeader> headers;
+    std::unique_ptr<AsyncWebServerResponse> response;
+    void* _tempObject = nullptr;    // handler context, freed with the request
+
+    AsyncWebServerRequest(const char* path = "/") : path(path) {}
+    ~AsyncWebServerRequest() { free(_tempObject); }
+
+    void addParam(const char* name, const char* value, bool post = false) {
+        AsyncWebParameter p;
+        p.paramName = name;
+        p.paramValue = value;
+        (post ? postParams : params).push_back(p);
+    }
+    void addHeader(const char* name, const char* value) { headers[name].headerValue = value; }
+
+    void send(AsyncWebServerResponse* r) { response.reset(r); }
+    void send(int code, const String& type = String(), const String& content = String()) {
+        send(beginResponse(code, type, content));
+    }
+
+    AsyncWebServerResponse* beginResponse(int code, const String& type = String(), const String& content = String()) {
+        AsyncWebServerResponse* r = new AsyncWebServerResponse();
+        r->code = code;
+        r->contentType = type;
+        r->body = content.c_str();
+        return r;
+    }
+    // Like AsyncProgmemResponse, content is read as the socket drains, not copied
+    AsyncWebServerResponse* beginResponse_P(int code, const String& type, const uint8_t* content, size_t length) {
+        AsyncWebServerResponse* r = new AsyncWebServerResponse();
+        r->code = code;
+        r->contentType = type;
+        r->length = length;
+        r->filler = [content](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            memcpy(buffer, content + index, maxLen);
+            return maxLen;
+        };
+        return r;
+    }
+
+    AsyncWebServerResponse* beginChunkedResponse(const String& type, AwsResponseFiller filler) {
+        AsyncWebServerResponse* r = new AsyncWebServerResponse();
+        r->contentType = type;
+        r->filler = filler;
+        r->chunked = true;
+        return r;
+    }
+
+    bool hasParam(const String& name, bool post = false, bool = false) const { return getParam(name, post) != nullptr; }
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool = false) const {
+        const std::vector<AsyncWebParameter>& list = post ? postParams : params;
+        for (const AsyncWebParameter& p : list) {
+            if (p.paramName == name) {
+                return const_cast<AsyncWebParameter*>(&p);
+            }
+        }
+        return nullptr;
+    }
+    AsyncWebHeader* getHeader(const String& name) const {
+        auto it = headers.find(name.c_str());
+        return it == headers.end() ? nullptr : const_cast<AsyncWebHeader*>(&it->second);
+    }
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncWebHandler {
+public:
+    virtual ~AsyncWebHandler() {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {};
+
+// One dashboard connected to /events
+class AsyncEventSourceClient {
+public:
+    std::vector<std::string> frames;
+    size_t queueLimit = 32;         // SSE_MAX_QUEUED_MESSAGES of the library
+    size_t queued = 0;              // frames not yet written to the socket
+    uint32_t dropped = 0;
+    uint32_t id = 0;
+
+    void send(const char* message, const char* = nullptr, uint32_t id = 0, uint32_t = 0) {
+        if (queued >= queueLimit) {
+            dropped++;
+            return;
+        }
+        queued++;
+        frames.push_back(message);
+        this->id = id;
+    }
+    uint32_t lastId() const { return id; }
+};
+
+class AsyncEventSource : public AsyncWebHandler {
+public:
+    String url;
+    std::vector<std::unique_ptr<AsyncEventSourceClient>> clients;
+    uint32_t sends = 0;
+
+    AsyncEventSource(const String& url) : url(url) {}
+
+    AsyncEventSourceClient* connectClient() {
+        clients.emplace_back(new AsyncEventSourceClient());
+        return clients.back().get();
+    }
+    void send(const char* message, const char* event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+        sends++;
+        for (auto& client : clients) {
+            client->send(message, event, id, reconnect);
+        }
+    }
+    size_t count() const { return clients.size(); }
+};
+
+class AsyncWebServer;
+namespace fake {
+// Servers the code under test created, newest last
+inline std::vector<AsyncWebServer*>& webServers() {
+    static std::vector<AsyncWebServer*> servers;
+    return servers;
+}
+}
+
+class AsyncWebServer {
+public:
+    struct Route {
+        std::string uri;
+        WebRequestMethod method;
+        ArRequestHandlerFunction handler;
+    };
+    std::vector<Route> routes;
+    std::vector<AsyncWebHandler*> handlers;
+    bool started = false;
+    AsyncCallbackWebHandler callbackHandler;
+
+    AsyncWebServer(uint16_t) { fake::webServers().push_back(this); }
+    void begin() { started = true; }
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethod method, ArRequestHandlerFunction handler) {
+        routes.push_back({ uri, method, handler });
+        return callbackHandler;
+    }
+
+    AsyncWebHandler& addHandler(AsyncWebHandler* handler) {
+        handlers.push_back(handler);
+        return *handler;
+    }
+
+    // Runs the handler registered for uri, false if there is none
+    bool handle(AsyncWebServerRequest& request, WebRequestMethod method = HTTP_GET) {
+        for (Route& route : routes) {
+            if (route.uri == request.path && (route.method & method)) {
+                route.handler(&request);
+                return true;
+            }
+        }
+        return false;
+    }
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+namespace fake {
+// DS18B20 probes on the simulated 1-Wire bus
+struct Probe {
+    uint8_t address[8];
+    float temperature;      // what the next conversion measures
+    float scratchpad;       // what getTempC() returns, 85 until the first conversion
+    bool connected;
+    uint8_t resolution;
+};
+
+struct OneWireBus {
+    std::vector<Probe> probes;
+    bool parasite = false;
+    // Actual conversion time as a fraction of the datasheet maximum
+    float conversionSpeed = 0.8f;
+    bool converting = false;
+    uint64_t conversionStartUs = 0;
+    uint32_t conversions = 0;
+    uint32_t completionPolls = 0;   // isConversionComplete() bus reads
+    // Bus time of one addressed scratchpad read, ~10 ms at standard speed
+    uint32_t scratchpadReadUs = 0;
+};
+inline OneWireBus oneWire;
+
+inline void resetOneWire() { oneWire = OneWireBus(); }
+
+inline Probe& addProbe(uint8_t serial, float temperature) {
+    Probe probe;
+    static const uint8_t rom[8] = { 0x28, 0xFF, 0x64, 0x1E, 0x0F, 0x00, 0x00, 0x00 };
+    memcpy(probe.address, rom, sizeof(rom));
+    probe.address[6] = serial;
+    probe.address[7] = (uint8_t)oneWire.probes.size(); // CRC is not checked
+    probe.temperature = temperature;
+    probe.scratchpad = 85.0f;
+    probe.connected = true;
+    probe.resolution = 12;
+    oneWire.probes.push_back(probe);
+    return oneWire.probes.back();
+}
+} // namespace fake
+
+class OneWire {
+public:
+    OneWire(uint8_t) {}
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace fake {
+// NVS contents by namespace and key, survives a simulated reboot
+inline std::map<std::string, std::map<std::string, std::vector<uint8_t>>> nvs;
+}
+
+class Preferences {
+private:
+    std::string space;
+    bool open = false;
+    bool readOnly = false;
+
+    std::vector<uint8_t>* find(const char* key) {
+        if (!open) {
+            return nullptr;
+        }
+        auto& entries = fake::nvs[space];
+        auto it = entries.find(key);
+        return it == entries.end() ? nullptr : &it->second;
+    }
+    size_t put(const char* key, const void* value, size_t length) {
+        fake::Untracked untracked;
+        if (!open || readOnly) {
+            return 0;
+        }
+        const uint8_t* bytes = (const uint8_t*)value;
+        fake::nvs[space][key].assign(bytes, bytes + length);
+        return length;
+    }
+    template <typename T>
+    T get(const char* key, T value) {
+        std::vector<uint8_t>* stored = find(key);
+        if (stored && stored->size() == sizeof(T)) {
+            memcpy(&value, stored->data(), sizeof(T));
+        }
+        return value;
+    }
+
+public:
+    bool begin(const char* name, bool readOnly = false, const char* = nullptr) {
+        fake::Untracked untracked;
+        // Like NVS, a read-only open of a namespace never written fails
+        if (readOnly && fake::nvs.find(name) == fake::nvs.end()) {
+            return false;
+        }
+        space = name;
+        open = true;
+        this->readOnly = readOnly;
+        return true;
+    }
+    void end() { open = false; }
+    bool clear() {
+        if (!open || readOnly) {
+            return false;
+        }
+        fake::nvs[space].clear();
+        return true;
+    }
+
+    size_t putString(const char* key, const String& value) { return put(key, value.c_str(), value.length() + 1); }
+    String getString(const char* key, String value = String()) {
+        std::vector<uint8_t>* stored = find(key);
+        return stored ? String((const char*)stored->data()) : value;
+    }
+    size_t putUChar(const char* key, uint8_t value) { return put(key, &value, sizeof(value)); }
+    uint8_t getUChar(const char* key, uint8_t value = 0) { return get(key, value); }
+    size_t putUInt(const char* key, uint32_t value) { return put(key, &value, sizeof(value)); }
+    uint32_t getUInt(const char* key, uint32_t value = 0) { return get(key, value); }
+    size_t putBytes(const char* key, const void* value, size_t length) { return put(key, value, length); }
+    size_t getBytesLength(const char* key) {
+        std::vector<uint8_t>* stored = find(key);
+        return stored ? stored->size() : 0;
+    }
+    size_t getBytes(const char* key, void* buffer, size_t length) {
+        std::vector<uint8_t>* stored = find(key);
+        if (!stored || stored->size() > length) {
+            return 0;
+        }
+        memcpy(buffer, stored->data(), stored->size());
+        return stored->size();
+    }
+};
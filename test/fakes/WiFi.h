@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+typedef enum { WL_IDLE_STATUS, WL_NO_SSID_AVAIL, WL_SCAN_COMPLETED, WL_CONNECTED, WL_CONNECT_FAILED, WL_CONNECTION_LOST, WL_DISCONNECTED } wl_status_t;
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+enum { WIFI_AUTH_OPEN };
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+namespace fake {
+inline wl_status_t wifiStatus = WL_CONNECTED;
+}
+
+class WiFiClass {
+public:
+    wl_status_t status() { return fake::wifiStatus; }
+    IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+    IPAddress gatewayIP() { return IPAddress(192, 168, 1, 1); }
+    bool mode(wifi_mode_t) { return true; }
+    bool softAP(const char*, const char* = nullptr) { return true; }
+    String SSID() { return String("host"); }
+    String SSID(uint8_t) { return String("host"); }
+    int32_t RSSI() { return -60; }
+    int32_t RSSI(uint8_t) { return -60; }
+    String BSSIDstr(uint8_t) { return String("00:00:00:00:00:00"); }
+    int32_t channel(uint8_t) { return 1; }
+    int encryptionType(uint8_t) { return WIFI_AUTH_OPEN; }
+    int16_t scanNetworks(bool = false) { return 0; }
+    int16_t scanComplete() { return 0; }
+    void scanDelete() {}
+    wl_status_t begin(const char*, const char* = nullptr) { return fake::wifiStatus; }
+    bool disconnect(bool = false, bool = false) { return true; }
+    uint8_t* macAddress(uint8_t* mac) {
+        for (int i = 0; i < 6; i++) {
+            mac[i] = 0x10 + i;
+        }
+        return mac;
+    }
+    String macAddress() { return String("10:11:12:13:14:15"); }
+};
+inline WiFiClass WiFi;
@@ -0,0 +1,4 @@
+#pragma once
+// RTC memory is ordinary memory on the host, a test simulates a deep-sleep
+// wake by keeping the variables and resetting everything else
+#define RTC_DATA_ATTR
@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+
+typedef struct { int model; uint32_t features; uint8_t cores; uint8_t revision; } esp_chip_info_t;
+
+inline void esp_chip_info(esp_chip_info_t* info) {
+    info->model = 1;
+    info->features = 0;
+    info->cores = 2;
+    info->revision = 3;
+}
@@ -0,0 +1,151 @@
+#pragma once
+// File-backed flash partition. Erase sets 0xFF, a write can only clear bits,
+// like NOR flash, so code that rewrites without erasing shows up in tests.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "fake_host.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+#define SPI_FLASH_SEC_SIZE 4096
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0, ESP_PARTITION_TYPE_DATA = 1 } esp_partition_type_t;
+typedef int esp_partition_subtype_t;
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+    bool encrypted;
+} esp_partition_t;
+
+namespace fake {
+struct Partition {
+    esp_partition_t info;
+    FILE* file = nullptr;
+    uint32_t erases = 0;
+    uint32_t writes = 0;
+    uint32_t reads = 0;
+    uint32_t straddles = 0; // writes crossing a 256 byte program page
+};
+inline std::vector<Partition*> partitions;
+// Runs while an erase is in progress, e.g. to read the log from "another task"
+inline std::function<void()> onErase;
+
+// Backs the partition with 'path', created erased if it does not exist or
+// has the wrong size. The file survives the test process, so it can be
+// reopened to simulate a reboot.
+inline Partition* openPartition(const char* label, esp_partition_subtype_t subtype, uint32_t size, const char* path) {
+    Partition* p = new Partition();
+    p->info.type = ESP_PARTITION_TYPE_DATA;
+    p->info.subtype = subtype;
+    p->info.address = 0x300000;
+    p->info.size = size;
+    snprintf(p->info.label, sizeof(p->info.label), "%s", label);
+    p->info.encrypted = false;
+    p->file = fopen(path, "r+b");
+    long existing = -1;
+    if (p->file) {
+        fseek(p->file, 0, SEEK_END);
+        existing = ftell(p->file);
+    }
+    if (existing != (long)size) {
+        if (p->file) {
+            fclose(p->file);
+        }
+        p->file = fopen(path, "w+b");
+        std::vector<uint8_t> erased(size, 0xFF);
+        fwrite(erased.data(), 1, size, p->file);
+        fflush(p->file);
+    }
+    partitions.push_back(p);
+    return p;
+}
+
+inline void closePartitions() {
+    for (Partition* p : partitions) {
+        fclose(p->file);
+        delete p;
+    }
+    partitions.clear();
+}
+
+inline Partition* partitionOf(const esp_partition_t* info) {
+    for (Partition* p : partitions) {
+        if (&p->info == info) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+} // namespace fake
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    for (fake::Partition* p : fake::partitions) {
+        if (p->info.type == type && (!label || strcmp(label, p->info.label) == 0)) {
+            return &p->info;
+        }
+    }
+    return nullptr;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* buffer, size_t size) {
+    fake::Partition* p = fake::partitionOf(partition);
+    if (!p || offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    p->reads++;
+    fseek(p->file, (long)offset, SEEK_SET);
+    return fread(buffer, 1, size, p->file) == size ? ESP_OK : ESP_FAIL;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* buffer, size_t size) {
+    fake::Untracked untracked;
+    fake::Partition* p = fake::partitionOf(partition);
+    if (!p || offset + size > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    p->writes++;
+    if (size > 0 && offset / 256 != (offset + size - 1) / 256) {
+        p->straddles++;
+    }
+    std::vector<uint8_t> current(size);
+    fseek(p->file, (long)offset, SEEK_SET);
+    if (fread(current.data(), 1, size, p->file) != size) {
+        return ESP_FAIL;
+    }
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    for (size_t i = 0; i < size; i++) {
+        current[i] &= bytes[i];
+    }
+    fseek(p->file, (long)offset, SEEK_SET);
+    fwrite(current.data(), 1, size, p->file);
+    fflush(p->file);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    fake::Untracked untracked;
+    fake::Partition* p = fake::partitionOf(partition);
+    if (!p || offset % SPI_FLASH_SEC_SIZE || size % SPI_FLASH_SEC_SIZE || offset + size > partition->size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->erases++;
+    std::vector<uint8_t> erased(size, 0xFF);
+    fseek(p->file, (long)offset, SEEK_SET);
+    fwrite(erased.data(), 1, size, p->file);
+    fflush(p->file);
+    if (fake::onErase) {
+        fake::onErase();
+    }
+    return ESP_OK;
+}
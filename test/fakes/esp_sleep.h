@@ -0,0 +1,27 @@
+#pragma once
+#include <stdint.h>
+#include "fake_host.h"
+
+typedef int esp_err_t;
+
+namespace fake {
+// Thrown by esp_deep_sleep_start(), the test catches it and starts the next
+// wake cycle. Only RTC_DATA_ATTR state may survive into that cycle.
+struct DeepSleep {
+    uint64_t wakeupUs;
+};
+inline uint64_t sleepWakeupUs = 0;
+inline uint32_t deepSleeps = 0;
+}
+
+inline esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+    fake::sleepWakeupUs = us;
+    return 0;
+}
+
+inline void esp_deep_sleep_start() {
+    fake::deepSleeps++;
+    // The RTC keeps the system time through the sleep, the next boot restarts nowUs
+    fake::systemTimeBaseUs += (int64_t)fake::nowUs + (int64_t)fake::sleepWakeupUs;
+    throw fake::DeepSleep{ fake::sleepWakeupUs };
+}
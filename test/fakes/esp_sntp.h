@@ -0,0 +1,29 @@
+#pragma once
+#include <sys/time.h>
+#include "fake_host.h"
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+namespace fake {
+// Registered callback, a test calls it to simulate an SNTP sync
+inline sntp_sync_time_cb_t sntpCallback = nullptr;
+// configTime() calls. While sntpReachable, each is answered on the next
+// runTasks(): the system time moves ahead by sntpAheadUs, which is then 0,
+// and the callback runs in the lwIP task as it would on the device.
+inline uint32_t sntpStarts = 0;
+inline bool sntpReachable = false;
+inline int64_t sntpAheadUs = 0;
+
+inline void answerSntp() {
+    setSystemTime(systemTimeUs() + sntpAheadUs);
+    sntpAheadUs = 0;
+    struct timeval tv;
+    tv.tv_sec = (time_t)(systemTimeUs() / 1000000);
+    tv.tv_usec = (suseconds_t)(systemTimeUs() % 1000000);
+    if (sntpCallback) {
+        sntpCallback(&tv);
+    }
+}
+}
+
+inline void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) { fake::sntpCallback = callback; }
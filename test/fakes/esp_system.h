@@ -0,0 +1,15 @@
+#pragma once
+#include <stdint.h>
+
+typedef enum {
+    ESP_RST_UNKNOWN, ESP_RST_POWERON, ESP_RST_EXT, ESP_RST_SW, ESP_RST_PANIC, ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT, ESP_RST_WDT, ESP_RST_DEEPSLEEP, ESP_RST_BROWNOUT, ESP_RST_SDIO
+} esp_reset_reason_t;
+
+namespace fake {
+inline esp_reset_reason_t resetReason = ESP_RST_POWERON;
+inline uint32_t randomValue = 0x1234abcd;
+}
+
+inline esp_reset_reason_t esp_reset_reason() { return fake::resetReason; }
+inline uint32_t esp_random() { return fake::randomValue; }
@@ -0,0 +1,5 @@
+#pragma once
+#include <stdint.h>
+#include "fake_host.h"
+
+inline int64_t esp_timer_get_time() { return (int64_t)fake::nowUs; }
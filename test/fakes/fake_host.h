@@ -0,0 +1,80 @@
+#pragma once
+// Host-side stand-ins for the ESP32 Arduino core and the libraries in
+// lib_deps, used by the [env:native] tests. Everything is header-only so a
+// test links against src/ without any device code. State the tests control
+// lives in namespace fake.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <functional>
+#include <vector>
+
+namespace fake {
+
+// Simulated clock, millis(), micros() and esp_timer_get_time() read it.
+// Nothing advances it but the test, delay() and vTaskDelay().
+inline uint64_t nowUs = 0;
+
+// Blocking waits seen by the code under test
+inline uint32_t delayCalls = 0;
+inline uint64_t delayedUs = 0;
+
+// Work of the other tasks (async_tcp, lwIP). It runs whenever the code under
+// test gives up the CPU in delay() or vTaskDelay(), or when the test calls
+// runTasks().
+inline std::vector<std::function<void()>> tasks;
+
+// One-shot work posted to the lwIP tcpip thread, e.g. through tcpip_callback()
+inline std::vector<std::function<void()>> tcpipJobs;
+inline bool inTcpipThread = false;
+
+inline void runTasks() {
+    std::vector<std::function<void()>> jobs;
+    jobs.swap(tcpipJobs);
+    inTcpipThread = true;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        jobs[i]();
+    }
+    inTcpipThread = false;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        tasks[i]();
+    }
+}
+
+// Allocations of the fakes' own bookkeeping, e.g. the broker's message
+// list. Allocation-counting tests skip whatever happens inside an Untracked.
+inline int untracked = 0;
+struct Untracked {
+    Untracked() { untracked++; }
+    ~Untracked() { untracked--; }
+};
+
+inline void advanceMs(uint32_t ms) {
+    nowUs += (uint64_t)ms * 1000;
+}
+
+inline void sleepUs(uint64_t us) {
+    delayCalls++;
+    delayedUs += us;
+    nowUs += us;
+    runTasks();
+}
+
+inline void resetClock(uint64_t us = 0) {
+    nowUs = us;
+    delayCalls = 0;
+    delayedUs = 0;
+}
+
+// System time as time() reads it: seconds since power-on until SNTP sets it.
+// The RTC keeps it running through deep sleep, so it is held as an offset
+// from nowUs, which restarts at every boot.
+inline int64_t systemTimeBaseUs = 0;
+inline int64_t systemTimeUs() { return systemTimeBaseUs + (int64_t)nowUs; }
+inline void setSystemTime(int64_t us) { systemTimeBaseUs = us - (int64_t)nowUs; }
+
+} // namespace fake
+
+// time(nullptr) picks this over the C library's time(time_t*)
+inline time_t time(decltype(nullptr)) { return (time_t)(fake::systemTimeUs() / 1000000); }
@@ -0,0 +1,27 @@
+#pragma once
+#include "FreeRTOS.h"
+
+// There is one thread on the host. A take while the mutex is held means a
+// simulated other task (e.g. a test hook) would have blocked here.
+struct FakeSemaphore {
+    int held;
+};
+typedef FakeSemaphore* SemaphoreHandle_t;
+
+namespace fake {
+inline uint32_t mutexContention = 0;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return new FakeSemaphore{ 0 }; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t) {
+    if (mutex->held) {
+        fake::mutexContention++;
+        return pdFALSE;
+    }
+    mutex->held++;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+    mutex->held--;
+    return pdTRUE;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <vector>
+#include "FreeRTOS.h"
+#include "../fake_host.h"
+
+namespace fake {
+// Tasks are not started on the host, the test drives their bodies directly
+struct CreatedTask {
+    TaskFunction_t function;
+    const char* name;
+    uint32_t stack;
+    void* parameter;
+};
+inline std::vector<CreatedTask> createdTasks;
+
+// A task body loops forever. Once the clock passes stopTasksUs, its next
+// vTaskDelay() throws TaskStopped and the test catches it.
+struct TaskStopped {};
+inline uint64_t stopTasksUs = UINT64_MAX;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack, void* parameter,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    fake::createdTasks.push_back({ function, name, stack, parameter });
+    if (handle) {
+        *handle = &fake::createdTasks.back();
+    }
+    return pdPASS;
+}
+inline void vTaskDelay(TickType_t ticks) {
+    if (fake::nowUs >= fake::stopTasksUs) {
+        throw fake::TaskStopped();
+    }
+    fake::sleepUs((uint64_t)ticks * 1000);
+}
+inline TickType_t xTaskGetTickCount() { return (TickType_t)(fake::nowUs / 1000); }
+inline void vTaskDelayUntil(TickType_t* previous, TickType_t increment) {
+    *previous += increment;
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(*previous - now) > 0) {
+        vTaskDelay(*previous - now);
+    } else if (fake::nowUs >= fake::stopTasksUs) {
+        throw fake::TaskStopped();
+    }
+}
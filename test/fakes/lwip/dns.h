@@ -0,0 +1,44 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <string>
+#include "err.h"
+#include "../fake_host.h"
+
+typedef struct { uint32_t addr; } ip4_addr_t;
+typedef struct { union { ip4_addr_t ip4; } u_addr; uint8_t type; } ip_addr_t;
+#define IPADDR_TYPE_V4 0
+#define ip_2_ip4(ipaddr) (&((ipaddr)->u_addr.ip4))
+#define ip4_addr_get_u32(src_ipaddr) ((src_ipaddr)->addr)
+#define IP_IS_V4(ipaddr) ((ipaddr)->type == IPADDR_TYPE_V4)
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+namespace fake {
+// Host name to IPv4 address in network byte order, missing = NXDOMAIN
+inline std::map<std::string, uint32_t> dnsRecords;
+inline uint32_t dnsQueries = 0;
+// Lookups made outside the tcpip thread, a race with lwIP on the device
+inline uint32_t dnsUnsafeCalls = 0;
+}
+
+// Always answers asynchronously, the callback runs on the next runTasks()
+inline err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* arg) {
+    if (!fake::inTcpipThread) {
+        fake::dnsUnsafeCalls++;
+    }
+    fake::dnsQueries++;
+    std::string name(hostname);
+    fake::tcpipJobs.push_back([name, found, arg]() {
+        auto it = fake::dnsRecords.find(name);
+        if (it == fake::dnsRecords.end()) {
+            found(name.c_str(), nullptr, arg);
+            return;
+        }
+        ip_addr_t result;
+        result.type = IPADDR_TYPE_V4;
+        result.u_addr.ip4.addr = it->second;
+        found(name.c_str(), &result, arg);
+    });
+    return ERR_INPROGRESS;
+}
@@ -0,0 +1,34 @@
+#pragma once
+// The Arduino-ESP32 sdkconfig leaves core locking off, calls into the lwIP
+// core have to be posted to the tcpip thread
+#include "../fake_host.h"
+#include "err.h"
+
+#define LWIP_TCPIP_CORE_LOCKING 0
+
+typedef void (*tcpip_callback_fn)(void* ctx);
+
+struct tcpip_api_call_data {
+    err_t err;
+};
+typedef err_t (*tcpip_api_call_fn)(struct tcpip_api_call_data* call);
+
+namespace fake {
+inline uint32_t tcpipCallbacks = 0;
+}
+
+inline err_t tcpip_callback(tcpip_callback_fn function, void* ctx) {
+    fake::tcpipCallbacks++;
+    fake::tcpipJobs.push_back([function, ctx]() { function(ctx); });
+    return ERR_OK;
+}
+
+// Blocks the caller until the tcpip thread ran the call
+inline err_t tcpip_api_call(tcpip_api_call_fn function, struct tcpip_api_call_data* call) {
+    fake::tcpipCallbacks++;
+    bool nested = fake::inTcpipThread;
+    fake::inTcpipThread = true;
+    err_t err = function(call);
+    fake::inTcpipThread = nested;
+    return err;
+}
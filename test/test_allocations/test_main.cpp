@@ -0,0 +1,180 @@
+// The MQTT publish path allocates nothing: malloc and operator new are
+// counted around thousands of publish cycles. Allocations made inside the
+// fakes (broker bookkeeping) are left out.
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <esp_partition.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "mqtt.h"
+
+static bool counting = false;
+static uint32_t allocations = 0;
+
+static void countAllocation() {
+    if (counting && fake::untracked == 0) {
+        allocations++;
+    }
+}
+
+#ifdef __GLIBC__
+// operator new ends up here as well
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+
+extern "C" void* malloc(size_t size) {
+    countAllocation();
+    return __libc_malloc(size);
+}
+extern "C" void* calloc(size_t count, size_t size) {
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+extern "C" void* realloc(void* pointer, size_t size) {
+    countAllocation();
+    return __libc_realloc(pointer, size);
+}
+#else
+void* operator new(size_t size) {
+    countAllocation();
+    void* pointer = malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+void operator delete(void* pointer) noexcept {
+    free(pointer);
+}
+#endif
+
+static const char* IMAGE = "test_allocations_log.bin";
+
+static SensorSet* sensors;
+static SampleClock* sampleClock;
+static SampleLog* sampleLog;
+static RollupStore* rollupStore;
+static MQTTManager* manager;
+
+void setUp() {
+    remove(IMAGE);
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    fake::broker.keepMessages = false;
+    fake::openPartition(LOG_PARTITION_LABEL, LOG_PARTITION_SUBTYPE, 16 * LOG_SEGMENT_SIZE, IMAGE);
+    sensors = new SensorSet();
+    sensors->begin();
+    sampleClock = new SampleClock();
+    sampleLog = new SampleLog();
+    sampleLog->begin(sampleClock);
+    rollupStore = new RollupStore();
+    manager = new MQTTManager("10.0.0.2", 1883, "", "");
+    manager->begin(sensors, nullptr, sampleClock, sampleLog, rollupStore);
+    TEST_ASSERT_TRUE(manager->connect());
+    fake::runTasks();
+    allocations = 0;
+}
+
+void tearDown() {
+    counting = false;
+    delete manager;
+    delete rollupStore;
+    delete sampleLog;
+    delete sampleClock;
+    delete sensors;
+    fake::closePartitions();
+    remove(IMAGE);
+}
+
+// One 2 s cycle of the firmware loop with values that always move past the deadbands
+static void cycle(uint32_t n) {
+    fake::dhtTemperature = 20.0f + (n % 50) * 0.5f;
+    fake::dhtHumidity = 40.0f + (n % 20);
+    TemperatureSensor& dht = *sensors->find<TemperatureSensor>();
+    dht.startSample();
+    dht.pollSample();
+    for (uint8_t f = 0; f < TemperatureSensor::FIELDS; f++) {
+        SensorReading reading = { (uint32_t)millis(), f, true, dht.getValue(0, f) };
+        sampleLog->append(reading);
+        rollupStore->add(reading, sampleLog->now());
+        manager->queueReading(reading);
+    }
+    for (uint32_t t = 0; t < TEMP_READ_INTERVAL; t += 100) {
+        manager->loop();
+        if (t == 0) {
+            manager->publishAllSensorData();
+        }
+        fake::advanceMs(100);
+        fake::runTasks();
+    }
+}
+
+void test_publish_cycles_do_not_allocate() {
+    // Warm up: session setup, schema, first batch and rollup
+    for (uint32_t n = 0; n < 100; n++) {
+        cycle(n);
+    }
+    uint32_t publishes = manager->getPublishCount();
+
+    counting = true;
+    for (uint32_t n = 100; n < 2100; n++) {
+        cycle(n);
+    }
+    counting = false;
+
+    char line[96];
+    snprintf(line, sizeof(line), "%lu publishes, %lu allocations",
+             (unsigned long)(manager->getPublishCount() - publishes), (unsigned long)allocations);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_GREATER_THAN(2000, manager->getPublishCount() - publishes);
+    TEST_ASSERT_EQUAL(0, allocations);
+}
+
+void test_log_replay_does_not_allocate() {
+    for (uint32_t n = 0; n < 200; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+
+    counting = true;
+    TEST_ASSERT_TRUE(sampleLog->startReplay(0, sampleLog->getTimestamp()));
+    for (uint32_t n = 200; n < 260 && sampleLog->isReplayActive(); n++) {
+        cycle(n);
+    }
+    counting = false;
+    TEST_ASSERT_FALSE(sampleLog->isReplayActive());
+    TEST_ASSERT_EQUAL(0, allocations);
+}
+
+void test_deep_sleep_batch_does_not_allocate() {
+    static SleepBatch batch;
+    batch.reset();
+    for (uint16_t r = 0; r < LOW_POWER_BATCH_MAX; r++) {
+        LogRecord record;
+        memset(&record, 0, sizeof(record));
+        record.timestamp = 1767225600 + r * 60;
+        record.validMask = 0x07;
+        record.values[0] = 2150 + r;
+        record.values[1] = 4500 - r;
+        record.values[2] = 2200 + r;
+        batch.append(record);
+    }
+
+    counting = true;
+    bool sent = manager->publishBatch(batch);
+    counting = false;
+    TEST_ASSERT_TRUE(sent);
+    TEST_ASSERT_EQUAL(0, allocations);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_publish_cycles_do_not_allocate);
+    RUN_TEST(test_log_replay_does_not_allocate);
+    RUN_TEST(test_deep_sleep_batch_does_not_allocate);
+    return UNITY_END();
+}
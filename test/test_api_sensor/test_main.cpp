@@ -0,0 +1,159 @@
+// /api/sensor from the double-buffered snapshot: ETag and 304, a body that
+// stays whole while the loop task reuses the slot, and the request rate the
+// handler sustains on the host. Run with -v to see the benchmark.
+#include <unity.h>
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <esp_system.h>
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include "webserver.h"
+
+static SensorSet* sensors;
+static SensorTask* sensorTask;
+static WiFiManager* wifiManager;
+static WebServer* webServer;
+static AsyncWebServer* server;
+static bool apMode = false;
+static uint32_t cycle = 0;
+
+void setUp() {}
+void tearDown() {}
+
+// One sampling cycle with new values, then the snapshot rebuild
+static void sampleCycle() {
+    cycle++;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        SensorReading reading = { (uint32_t)millis(), ch, true, 20.0f + ch + cycle * 0.25f };
+        webServer->queueReading(reading);
+    }
+    webServer->updateSnapshot();
+}
+
+static std::unique_ptr<AsyncWebServerRequest> get(const char* ifNoneMatch = nullptr) {
+    std::unique_ptr<AsyncWebServerRequest> request(new AsyncWebServerRequest("/api/sensor"));
+    if (ifNoneMatch) {
+        request->addHeader("If-None-Match", ifNoneMatch);
+    }
+    TEST_ASSERT_TRUE(server->handle(*request));
+    TEST_ASSERT_NOT_NULL(request->response.get());
+    return request;
+}
+
+static std::string etagOf(const AsyncWebServerRequest& request) {
+    return request.response->headers.at("ETag");
+}
+
+void test_etag_names_boot_and_version() {
+    sampleCycle();
+    auto first = get();
+    TEST_ASSERT_EQUAL(200, first->response->code);
+    std::string body = first->response->drain();
+    TEST_ASSERT_EQUAL('{', body[0]);
+    TEST_ASSERT_EQUAL('}', body.back());
+    TEST_ASSERT_TRUE(body.find("\"dht22\"") != std::string::npos);
+    TEST_ASSERT_EQUAL_STRING("no-cache", first->response->headers.at("Cache-Control").c_str());
+
+    // "<boot>-<version>", the boot part from esp_random()
+    std::string etag = etagOf(*first);
+    char expected[24];
+    snprintf(expected, sizeof(expected), "\"%08lx-", (unsigned long)fake::randomValue);
+    TEST_ASSERT_EQUAL(0, etag.find(expected));
+    TEST_ASSERT_EQUAL('"', etag.back());
+
+    sampleCycle();
+    auto second = get();
+    TEST_ASSERT_TRUE(etagOf(*second) != etag);
+    TEST_ASSERT_TRUE(second->response->drain() != body);
+}
+
+void test_if_none_match() {
+    sampleCycle();
+    std::string etag = etagOf(*get());
+
+    auto cached = get(etag.c_str());
+    TEST_ASSERT_EQUAL(304, cached->response->code);
+    TEST_ASSERT_TRUE(cached->response->drain().empty());
+    TEST_ASSERT_TRUE(etagOf(*cached) == etag);
+    TEST_ASSERT_NULL(cached->_tempObject);
+
+    // Browsers may send several tags
+    std::string list = "\"0badf00d-1\", " + etag;
+    TEST_ASSERT_EQUAL(304, get(list.c_str())->response->code);
+
+    // The same version from an earlier boot is a different document
+    std::string otherBoot = etag;
+    otherBoot.replace(1, 8, "0badf00d");
+    TEST_ASSERT_EQUAL(200, get(otherBoot.c_str())->response->code);
+
+    // New readings make the browser's copy stale
+    sampleCycle();
+    auto stale = get(etag.c_str());
+    TEST_ASSERT_EQUAL(200, stale->response->code);
+    TEST_ASSERT_TRUE(etagOf(*stale) != etag);
+}
+
+void test_body_survives_slot_reuse() {
+    sampleCycle();
+    std::string expected = get()->response->drain();
+
+    // A slow client: the response is not drained before the loop task has
+    // rewritten both slots
+    auto slow = get();
+    TEST_ASSERT_EQUAL(200, slow->response->code);
+    sampleCycle();
+    sampleCycle();
+    sampleCycle();
+    std::string body = slow->response->drain(64);
+    TEST_ASSERT_EQUAL(expected.size(), slow->response->length);
+    TEST_ASSERT_TRUE(body == expected);
+}
+
+void test_request_rate_benchmark() {
+    const int REQUESTS = 20000;
+    const int PER_CYCLE = 20; // dashboards polling faster than the sensors sample
+    std::string etag;
+    size_t bytes = 0;
+    int notModified = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REQUESTS; i++) {
+        if (i % PER_CYCLE == 0) {
+            sampleCycle();
+        }
+        // Half the clients revalidate, half fetch the body every time
+        auto request = get(i % 2 ? etag.c_str() : nullptr);
+        if (request->response->code == 304) {
+            notModified++;
+        } else {
+            bytes += request->response->drain().size();
+            etag = etagOf(*request);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char line[128];
+    snprintf(line, sizeof(line), "%d requests, %d not modified, %u bytes: %.0f req/s on the host",
+             REQUESTS, notModified, (unsigned)bytes, REQUESTS / seconds);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_GREATER_THAN(REQUESTS / 2 - REQUESTS / PER_CYCLE - 1, notModified);
+}
+
+int main(int argc, char** argv) {
+    sensors = new SensorSet();
+    sensors->begin();
+    sensorTask = new SensorTask(sensors);
+    wifiManager = new WiFiManager();
+    webServer = new WebServer(wifiManager, sensors, sensorTask, nullptr, nullptr, nullptr, nullptr, &apMode);
+    webServer->begin();
+    server = fake::webServers().back();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_etag_names_boot_and_version);
+    RUN_TEST(test_if_none_match);
+    RUN_TEST(test_body_survives_slot_reuse);
+    RUN_TEST(test_request_rate_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+// DS18B20 start/poll split on a fake 1-Wire bus. The fake clock only moves
+// when the code under test calls delay() or when the test advances it, so a
+// sample call that blocks shows up as a delay call.
+#include <unity.h>
+#include <Arduino.h>
+#include <Preferences.h>
+#include <DallasTemperature.h>
+#include "temperature.h"
+
+void setUp() {
+    fake::resetClock(1000000);
+    fake::resetOneWire();
+    fake::nvs.clear();
+}
+
+void tearDown() {}
+
+// Runs the sampling loop for 'ms' in 1 ms steps like loop() does, starting a
+// sample every interval. Returns the number of completed samples.
+static uint32_t runLoop(DS18B20Sensor& sensor, uint32_t ms, uint32_t interval, uint64_t& maxCallUs) {
+    uint32_t completed = 0;
+    uint32_t nextStart = millis();
+    for (uint32_t i = 0; i < ms; i++) {
+        uint64_t before = fake::nowUs;
+        if ((int32_t)(millis() - nextStart) >= 0 && !sensor.isSamplePending()) {
+            sensor.startSample();
+            nextStart += interval;
+        }
+        if (sensor.isSamplePending() && sensor.pollSample()) {
+            completed++;
+        }
+        uint64_t spent = fake::nowUs - before;
+        if (spent > maxCallUs) {
+            maxCallUs = spent;
+        }
+        fake::advanceMs(1);
+    }
+    return completed;
+}
+
+void test_start_and_poll_never_block() {
+    fake::addProbe(1, 21.5f);
+    fake::addProbe(2, 19.25f);
+    DS18B20Sensor sensor;
+    sensor.begin();
+    TEST_ASSERT_EQUAL(2, sensor.getDeviceCount());
+    TEST_ASSERT_EQUAL(750, sensor.getConversionTime());
+
+    uint64_t maxCallUs = 0;
+    uint32_t completed = runLoop(sensor, 10000, 2000, maxCallUs);
+
+    TEST_ASSERT_EQUAL(0, fake::delayCalls);
+    TEST_ASSERT_EQUAL(0, maxCallUs);
+    TEST_ASSERT_EQUAL(5, completed);
+    TEST_ASSERT_EQUAL(5, fake::oneWire.conversions);
+    TEST_ASSERT_TRUE(sensor.isValid(0));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 21.5, sensor.getTemperature(0));
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 19.25, sensor.getTemperature(1));
+}
+
+void test_blocking_library_mode_is_detected() {
+    // The fake does block like the library when asked to, so the test above
+    // would catch a regression to requestTemperatures() in blocking mode
+    fake::addProbe(1, 21.5f);
+    DallasTemperature bus(nullptr);
+    bus.setWaitForConversion(true);
+    bus.requestTemperatures();
+    TEST_ASSERT_EQUAL(1, fake::delayCalls);
+    TEST_ASSERT_GREATER_OR_EQUAL(600000, fake::delayedUs);
+}
+
+void test_powered_bus_completes_when_the_bus_reports_ready() {
+    fake::addProbe(1, 22.0f);
+    fake::oneWire.conversionSpeed = 0.5f; // converts in 375 ms instead of 750
+    DS18B20Sensor sensor;
+    sensor.begin();
+
+    sensor.startSample();
+    uint32_t started = millis();
+    while (!sensor.pollSample()) {
+        fake::advanceMs(1);
+        TEST_ASSERT_LESS_THAN(1000, millis() - started);
+    }
+    TEST_ASSERT_EQUAL(375, millis() - started);
+    TEST_ASSERT_GREATER_THAN(0, fake::oneWire.completionPolls);
+    TEST_ASSERT_EQUAL(0, fake::delayCalls);
+}
+
+void test_parasite_bus_waits_full_conversion_without_polling() {
+    fake::addProbe(1, 22.0f);
+    fake::oneWire.parasite = true;
+    fake::oneWire.conversionSpeed = 0.5f;
+    DS18B20Sensor sensor;
+    sensor.begin();
+
+    sensor.startSample();
+    uint32_t started = millis();
+    while (!sensor.pollSample()) {
+        fake::advanceMs(1);
+    }
+    TEST_ASSERT_EQUAL(750, millis() - started);
+    TEST_ASSERT_EQUAL(0, fake::oneWire.completionPolls);
+    TEST_ASSERT_EQUAL(0, fake::delayCalls);
+}
+
+void test_start_while_pending_does_not_restart() {
+    fake::addProbe(1, 22.0f);
+    DS18B20Sensor sensor;
+    sensor.begin();
+
+    sensor.startSample();
+    fake::advanceMs(100);
+    sensor.startSample();
+    TEST_ASSERT_EQUAL(1, fake::oneWire.conversions);
+    TEST_ASSERT_TRUE(sensor.isSamplePending());
+}
+
+void test_power_on_value_is_invalid() {
+    // A probe read before it finished a conversion returns 85.0
+    fake::Probe& probe = fake::addProbe(1, 85.0f);
+    probe.scratchpad = 85.0f;
+    DS18B20Sensor sensor;
+    sensor.begin();
+
+    sensor.startSample();
+    fake::advanceMs(750);
+    TEST_ASSERT_TRUE(sensor.pollSample());
+    TEST_ASSERT_FALSE(sensor.isValid(0));
+}
+
+void test_resolution_change_applies_between_conversions() {
+    fake::addProbe(1, 22.0f);
+    DS18B20Sensor sensor;
+    sensor.begin();
+
+    TEST_ASSERT_TRUE(sensor.setResolution(0, 9));
+    TEST_ASSERT_EQUAL(12, sensor.getResolution(0)); // not before the next start
+    sensor.startSample();
+    TEST_ASSERT_EQUAL(9, sensor.getResolution(0));
+    TEST_ASSERT_EQUAL(94, sensor.getConversionTime());
+    TEST_ASSERT_EQUAL(0, fake::delayCalls);
+
+    // Stored per ROM address and used again after a reboot
+    DS18B20Sensor rebooted;
+    rebooted.begin();
+    TEST_ASSERT_EQUAL(9, rebooted.getResolution(0));
+}
+
+void test_no_probes() {
+    DS18B20Sensor sensor;
+    sensor.begin();
+    sensor.startSample();
+    TEST_ASSERT_FALSE(sensor.isSamplePending());
+    TEST_ASSERT_FALSE(sensor.pollSample());
+    TEST_ASSERT_EQUAL(0, fake::oneWire.conversions);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_start_and_poll_never_block);
+    RUN_TEST(test_blocking_library_mode_is_detected);
+    RUN_TEST(test_powered_bus_completes_when_the_bus_reports_ready);
+    RUN_TEST(test_parasite_bus_waits_full_conversion_without_polling);
+    RUN_TEST(test_start_while_pending_does_not_restart);
+    RUN_TEST(test_power_on_value_is_invalid);
+    RUN_TEST(test_resolution_change_applies_between_conversions);
+    RUN_TEST(test_no_probes);
+    return UNITY_END();
+}
@@ -0,0 +1,1240 @@
+#pragma once
+// Sensor traces modelled on the parts' behaviour, 300 samples each (10 min)
+// at the 2 s interval with the sensor task's wake-up jitter. Values carry
+// the parts' resolution (0.0625 °C, 0.1 °C / 0.1 %RH) and read noise; truth
+// is the modelled physical value the filter should follow. DHT22 bit errors
+// flip one bit of the reading's 0.1-unit count and still pass the checksum.
+// A capture from a device (FILTER_ENABLED 0, /api/log) can replace any of
+// them, truth then being a hand-checked reference.
+#include <math.h>
+#include <stdint.h>
+
+struct TracePoint {
+    uint32_t timestamp; // ms
+    float value;        // NAN for a failed read
+    float truth;
+};
+
+static const int TRACE_POINTS = 300;
+
+// DS18B20 at 12 bit in still air, 21.0 -> 21.6 °C. Power-on 85 °C reads at
+// samples 37 and 38 (two in a row) and 151 and 262.
+static const TracePoint ds18b20Still[TRACE_POINTS] = {
+    {1000, 21.0000f, 21.001f},
+    {3001, 21.0000f, 21.004f},
+    {4998, 21.0000f, 21.007f},
+    {7007, 21.0000f, 21.010f},
+    {9007, 21.0000f, 21.013f},
+    {11006, 21.0000f, 21.016f},
+    {13015, 21.0000f, 21.019f},
+    {15029, 21.0000f, 21.022f},
+    {17043, 21.0000f, 21.025f},
+    {19057, 21.0000f, 21.029f},
+    {21071, 21.0625f, 21.032f},
+    {23085, 21.0625f, 21.035f},
+    {25087, 21.0000f, 21.038f},
+    {27081, 21.0625f, 21.041f},
+    {29081, 21.0000f, 21.044f},
+    {31090, 21.0000f, 21.047f},
+    {33104, 21.0625f, 21.050f},
+    {35108, 21.0625f, 21.053f},
+    {37122, 21.0625f, 21.056f},
+    {39116, 21.0000f, 21.059f},
+    {41115, 21.0625f, 21.062f},
+    {43115, 21.0625f, 21.065f},
+    {45115, 21.1250f, 21.068f},
+    {47115, 21.0625f, 21.071f},
+    {49116, 21.1250f, 21.074f},
+    {51118, 21.1250f, 21.077f},
+    {53127, 21.0625f, 21.080f},
+    {55121, 21.1250f, 21.083f},
+    {57121, 21.0625f, 21.086f},
+    {59118, 21.1250f, 21.089f},
+    {61120, 21.1250f, 21.092f},
+    {63120, 21.1250f, 21.094f},
+    {65117, 21.0625f, 21.097f},
+    {67131, 21.0625f, 21.100f},
+    {69130, 21.1250f, 21.103f},
+    {71132, 21.1250f, 21.106f},
+    {73134, 21.1250f, 21.108f},
+    {75138, 85.0000f, 21.111f},
+    {77152, 85.0000f, 21.114f},
+    {79154, 21.1250f, 21.117f},
+    {81163, 21.0625f, 21.119f},
+    {83167, 21.1250f, 21.122f},
+    {85167, 21.1250f, 21.125f},
+    {87167, 21.1250f, 21.127f},
+    {89168, 21.1250f, 21.130f},
+    {91170, 21.0625f, 21.133f},
+    {93172, 21.1250f, 21.135f},
+    {95176, 21.1250f, 21.138f},
+    {97178, 21.1875f, 21.140f},
+    {99182, 21.1875f, 21.143f},
+    {101183, 21.1875f, 21.145f},
+    {103185, 21.1250f, 21.148f},
+    {105184, 21.1875f, 21.150f},
+    {107184, 21.1250f, 21.153f},
+    {109178, 21.1250f, 21.155f},
+    {111178, 21.1875f, 21.157f},
+    {113172, 21.1250f, 21.160f},
+    {115174, 21.1250f, 21.162f},
+    {117178, 21.1875f, 21.164f},
+    {119182, 21.1875f, 21.167f},
+    {121179, 21.1875f, 21.169f},
+    {123180, 21.1875f, 21.171f},
+    {125181, 21.1875f, 21.173f},
+    {127182, 21.1875f, 21.176f},
+    {129182, 21.1875f, 21.178f},
+    {131183, 21.1875f, 21.180f},
+    {133187, 21.1875f, 21.182f},
+    {135196, 21.1875f, 21.184f},
+    {137195, 21.1250f, 21.186f},
+    {139195, 21.1875f, 21.188f},
+    {141199, 21.1875f, 21.190f},
+    {143196, 21.1875f, 21.192f},
+    {145197, 21.1875f, 21.194f},
+    {147206, 21.1875f, 21.196f},
+    {149215, 21.2500f, 21.198f},
+    {151217, 21.1875f, 21.200f},
+    {153217, 21.1875f, 21.202f},
+    {155216, 21.1250f, 21.204f},
+    {157215, 21.2500f, 21.205f},
+    {159219, 21.1875f, 21.207f},
+    {161219, 21.1875f, 21.209f},
+    {163221, 21.2500f, 21.211f},
+    {165220, 21.2500f, 21.212f},
+    {167229, 21.1875f, 21.214f},
+    {169229, 21.2500f, 21.216f},
+    {171226, 21.1875f, 21.218f},
+    {173226, 21.1875f, 21.219f},
+    {175220, 21.1875f, 21.221f},
+    {177229, 21.2500f, 21.222f},
+    {179229, 21.1875f, 21.224f},
+    {181226, 21.1875f, 21.225f},
+    {183230, 21.2500f, 21.227f},
+    {185229, 21.2500f, 21.228f},
+    {187243, 21.1875f, 21.230f},
+    {189242, 21.2500f, 21.231f},
+    {191242, 21.1875f, 21.233f},
+    {193251, 21.1875f, 21.234f},
+    {195255, 21.1875f, 21.236f},
+    {197269, 21.2500f, 21.237f},
+    {199268, 21.2500f, 21.238f},
+    {201267, 21.2500f, 21.240f},
+    {203267, 21.2500f, 21.241f},
+    {205261, 21.2500f, 21.242f},
+    {207262, 21.2500f, 21.243f},
+    {209276, 21.2500f, 21.245f},
+    {211290, 21.2500f, 21.246f},
+    {213287, 21.2500f, 21.247f},
+    {215284, 21.1875f, 21.248f},
+    {217283, 21.2500f, 21.250f},
+    {219283, 21.1875f, 21.251f},
+    {221282, 21.2500f, 21.252f},
+    {223279, 21.2500f, 21.253f},
+    {225273, 21.2500f, 21.254f},
+    {227272, 21.2500f, 21.255f},
+    {229286, 21.2500f, 21.256f},
+    {231295, 21.2500f, 21.257f},
+    {233304, 21.2500f, 21.258f},
+    {235305, 21.2500f, 21.259f},
+    {237305, 21.1875f, 21.260f},
+    {239319, 21.2500f, 21.262f},
+    {241321, 21.2500f, 21.263f},
+    {243330, 21.3125f, 21.264f},
+    {245332, 21.2500f, 21.265f},
+    {247336, 21.2500f, 21.266f},
+    {249333, 21.2500f, 21.266f},
+    {251342, 21.2500f, 21.267f},
+    {253351, 21.2500f, 21.268f},
+    {255353, 21.2500f, 21.269f},
+    {257357, 21.3125f, 21.270f},
+    {259351, 21.2500f, 21.271f},
+    {261352, 21.3125f, 21.272f},
+    {263351, 21.2500f, 21.273f},
+    {265348, 21.2500f, 21.274f},
+    {267362, 21.2500f, 21.275f},
+    {269371, 21.2500f, 21.276f},
+    {271371, 21.3125f, 21.277f},
+    {273371, 21.2500f, 21.278f},
+    {275371, 21.2500f, 21.278f},
+    {277365, 21.3125f, 21.279f},
+    {279379, 21.3125f, 21.280f},
+    {281379, 21.3125f, 21.281f},
+    {283388, 21.2500f, 21.282f},
+    {285389, 21.3125f, 21.283f},
+    {287386, 21.3125f, 21.284f},
+    {289380, 21.3125f, 21.285f},
+    {291377, 21.3125f, 21.286f},
+    {293374, 21.2500f, 21.286f},
+    {295368, 21.3125f, 21.287f},
+    {297382, 21.3125f, 21.288f},
+    {299391, 21.2500f, 21.289f},
+    {301388, 21.3125f, 21.290f},
+    {303389, 85.0000f, 21.291f},
+    {305398, 21.3125f, 21.292f},
+    {307402, 21.3125f, 21.293f},
+    {309399, 21.3750f, 21.294f},
+    {311399, 21.2500f, 21.295f},
+    {313396, 21.2500f, 21.296f},
+    {315400, 21.2500f, 21.297f},
+    {317414, 21.3125f, 21.298f},
+    {319416, 21.2500f, 21.299f},
+    {321425, 21.3125f, 21.300f},
+    {323425, 21.3750f, 21.301f},
+    {325419, 21.3125f, 21.302f},
+    {327419, 21.2500f, 21.303f},
+    {329428, 21.3125f, 21.304f},
+    {331442, 21.3125f, 21.305f},
+    {333441, 21.3125f, 21.306f},
+    {335443, 21.3125f, 21.307f},
+    {337457, 21.3125f, 21.308f},
+    {339459, 21.3125f, 21.309f},
+    {341463, 21.3125f, 21.310f},
+    {343472, 21.3125f, 21.311f},
+    {345466, 21.3125f, 21.312f},
+    {347470, 21.2500f, 21.314f},
+    {349472, 21.3125f, 21.315f},
+    {351481, 21.3125f, 21.316f},
+    {353490, 21.3125f, 21.317f},
+    {355484, 21.3125f, 21.318f},
+    {357493, 21.3125f, 21.320f},
+    {359502, 21.3750f, 21.321f},
+    {361496, 21.3125f, 21.322f},
+    {363496, 21.3125f, 21.323f},
+    {365510, 21.3125f, 21.325f},
+    {367512, 21.3125f, 21.326f},
+    {369526, 21.3125f, 21.327f},
+    {371540, 21.3125f, 21.329f},
+    {373549, 21.2500f, 21.330f},
+    {375563, 21.3750f, 21.332f},
+    {377560, 21.3750f, 21.333f},
+    {379569, 21.3125f, 21.335f},
+    {381583, 21.3125f, 21.336f},
+    {383584, 21.3125f, 21.338f},
+    {385583, 21.3750f, 21.339f},
+    {387580, 21.4375f, 21.341f},
+    {389574, 21.3125f, 21.342f},
+    {391588, 21.3125f, 21.344f},
+    {393597, 21.3125f, 21.345f},
+    {395599, 21.3750f, 21.347f},
+    {397600, 21.3125f, 21.349f},
+    {399602, 21.3750f, 21.350f},
+    {401604, 21.3125f, 21.352f},
+    {403613, 21.3125f, 21.354f},
+    {405627, 21.3750f, 21.356f},
+    {407631, 21.3750f, 21.357f},
+    {409625, 21.3750f, 21.359f},
+    {411629, 21.3750f, 21.361f},
+    {413638, 21.3750f, 21.363f},
+    {415640, 21.3750f, 21.365f},
+    {417639, 21.3750f, 21.367f},
+    {419639, 21.3125f, 21.369f},
+    {421639, 21.3125f, 21.371f},
+    {423640, 21.3750f, 21.373f},
+    {425654, 21.3750f, 21.375f},
+    {427653, 21.4375f, 21.377f},
+    {429652, 21.3750f, 21.379f},
+    {431666, 21.3125f, 21.381f},
+    {433670, 21.3750f, 21.383f},
+    {435674, 21.4375f, 21.385f},
+    {437676, 21.3750f, 21.387f},
+    {439676, 21.3750f, 21.389f},
+    {441685, 21.3750f, 21.392f},
+    {443686, 21.3750f, 21.394f},
+    {445685, 21.4375f, 21.396f},
+    {447694, 21.3750f, 21.398f},
+    {449688, 21.4375f, 21.401f},
+    {451702, 21.3750f, 21.403f},
+    {453696, 21.3750f, 21.405f},
+    {455710, 21.4375f, 21.408f},
+    {457719, 21.4375f, 21.410f},
+    {459723, 21.5000f, 21.413f},
+    {461727, 21.4375f, 21.415f},
+    {463731, 21.3750f, 21.417f},
+    {465725, 21.3750f, 21.420f},
+    {467734, 21.3750f, 21.422f},
+    {469735, 21.4375f, 21.425f},
+    {471739, 21.3750f, 21.428f},
+    {473739, 21.4375f, 21.430f},
+    {475743, 21.4375f, 21.433f},
+    {477743, 21.4375f, 21.435f},
+    {479742, 21.3750f, 21.438f},
+    {481744, 21.4375f, 21.441f},
+    {483744, 21.4375f, 21.443f},
+    {485738, 21.5000f, 21.446f},
+    {487752, 21.3750f, 21.449f},
+    {489761, 21.4375f, 21.451f},
+    {491775, 21.4375f, 21.454f},
+    {493775, 21.4375f, 21.457f},
+    {495775, 21.5000f, 21.460f},
+    {497779, 21.5000f, 21.463f},
+    {499780, 21.5000f, 21.465f},
+    {501780, 21.4375f, 21.468f},
+    {503784, 21.4375f, 21.471f},
+    {505788, 21.4375f, 21.474f},
+    {507792, 21.4375f, 21.477f},
+    {509792, 21.4375f, 21.480f},
+    {511796, 21.5000f, 21.483f},
+    {513798, 21.5000f, 21.486f},
+    {515812, 21.5000f, 21.489f},
+    {517814, 21.5000f, 21.492f},
+    {519818, 21.4375f, 21.495f},
+    {521820, 21.5000f, 21.498f},
+    {523814, 21.5000f, 21.500f},
+    {525813, 85.0000f, 21.503f},
+    {527822, 21.5000f, 21.507f},
+    {529823, 21.5625f, 21.510f},
+    {531817, 21.5625f, 21.513f},
+    {533821, 21.5000f, 21.516f},
+    {535825, 21.5000f, 21.519f},
+    {537834, 21.5000f, 21.522f},
+    {539833, 21.5000f, 21.525f},
+    {541833, 21.5625f, 21.528f},
+    {543842, 21.5625f, 21.531f},
+    {545856, 21.5625f, 21.534f},
+    {547853, 21.5000f, 21.537f},
+    {549862, 21.6250f, 21.540f},
+    {551859, 21.5625f, 21.543f},
+    {553863, 21.5000f, 21.546f},
+    {555860, 21.5625f, 21.550f},
+    {557864, 21.5000f, 21.553f},
+    {559873, 21.5625f, 21.556f},
+    {561875, 21.5625f, 21.559f},
+    {563889, 21.5625f, 21.562f},
+    {565889, 21.5000f, 21.565f},
+    {567886, 21.5625f, 21.568f},
+    {569886, 21.5625f, 21.571f},
+    {571900, 21.6250f, 21.574f},
+    {573904, 21.5625f, 21.578f},
+    {575908, 21.6250f, 21.581f},
+    {577907, 21.5625f, 21.584f},
+    {579911, 21.5000f, 21.587f},
+    {581925, 21.5625f, 21.590f},
+    {583924, 21.6875f, 21.593f},
+    {585924, 21.6250f, 21.596f},
+    {587924, 21.6250f, 21.599f},
+    {589928, 21.6250f, 21.602f},
+    {591930, 21.6250f, 21.605f},
+    {593939, 21.6250f, 21.608f},
+    {595938, 21.6250f, 21.612f},
+    {597938, 21.6250f, 21.615f},
+    {599952, 21.6250f, 21.618f},
+};
+
+// DS18B20 probe moved into 44.8 °C water at sample 100, tau 7 s, up to
+// 3.4 °C/s. Power-on 85 °C reads at samples 58 and 190.
+static const TracePoint ds18b20Plunge[TRACE_POINTS] = {
+    {1000, 21.1875f, 21.200f},
+    {2997, 21.1875f, 21.200f},
+    {4998, 21.2500f, 21.200f},
+    {6995, 21.2500f, 21.200f},
+    {8996, 21.1875f, 21.200f},
+    {10993, 21.1875f, 21.200f},
+    {12993, 21.2500f, 21.200f},
+    {14992, 21.1875f, 21.200f},
+    {16994, 21.1250f, 21.200f},
+    {19008, 21.1875f, 21.200f},
+    {21002, 21.1875f, 21.200f},
+    {22996, 21.2500f, 21.200f},
+    {25000, 21.2500f, 21.200f},
+    {27001, 21.2500f, 21.200f},
+    {29001, 21.1875f, 21.200f},
+    {31005, 21.1875f, 21.200f},
+    {33002, 21.1875f, 21.200f},
+    {34999, 21.1875f, 21.200f},
+    {36993, 21.1875f, 21.200f},
+    {38997, 21.1875f, 21.200f},
+    {40994, 21.1875f, 21.200f},
+    {42994, 21.1875f, 21.200f},
+    {44993, 21.1875f, 21.200f},
+    {46994, 21.2500f, 21.200f},
+    {48995, 21.3125f, 21.200f},
+    {50992, 21.2500f, 21.200f},
+    {52991, 21.1875f, 21.200f},
+    {54993, 21.2500f, 21.200f},
+    {57007, 21.1875f, 21.200f},
+    {59016, 21.1875f, 21.200f},
+    {61010, 21.2500f, 21.200f},
+    {63010, 21.1250f, 21.200f},
+    {65004, 21.1250f, 21.200f},
+    {67006, 21.2500f, 21.200f},
+    {69005, 21.1875f, 21.200f},
+    {71009, 21.1875f, 21.200f},
+    {73023, 21.2500f, 21.200f},
+    {75023, 21.2500f, 21.200f},
+    {77027, 21.1875f, 21.200f},
+    {79027, 21.1875f, 21.200f},
+    {81036, 21.1875f, 21.200f},
+    {83030, 21.1875f, 21.200f},
+    {85029, 21.1875f, 21.200f},
+    {87031, 21.1875f, 21.200f},
+    {89025, 21.1875f, 21.200f},
+    {91029, 21.1875f, 21.200f},
+    {93028, 21.1875f, 21.200f},
+    {95022, 21.1875f, 21.200f},
+    {97036, 21.1875f, 21.200f},
+    {99040, 21.1875f, 21.200f},
+    {101037, 21.1875f, 21.200f},
+    {103036, 21.1875f, 21.200f},
+    {105030, 21.1875f, 21.200f},
+    {107030, 21.2500f, 21.200f},
+    {109031, 21.2500f, 21.200f},
+    {111031, 21.1875f, 21.200f},
+    {113031, 21.2500f, 21.200f},
+    {115025, 21.1875f, 21.200f},
+    {117019, 85.0000f, 21.200f},
+    {119016, 21.2500f, 21.200f},
+    {121013, 21.1875f, 21.200f},
+    {123007, 21.2500f, 21.200f},
+    {125001, 21.1875f, 21.200f},
+    {127003, 21.1875f, 21.200f},
+    {129000, 21.2500f, 21.200f},
+    {131001, 21.1875f, 21.200f},
+    {132995, 21.1875f, 21.200f},
+    {134996, 21.1250f, 21.200f},
+    {136996, 21.1875f, 21.200f},
+    {139000, 21.1875f, 21.200f},
+    {140994, 21.1875f, 21.200f},
+    {142988, 21.1250f, 21.200f},
+    {145002, 21.2500f, 21.200f},
+    {147004, 21.1875f, 21.200f},
+    {149018, 21.1875f, 21.200f},
+    {151018, 21.3125f, 21.200f},
+    {153027, 21.1875f, 21.200f},
+    {155041, 21.1875f, 21.200f},
+    {157035, 21.1875f, 21.200f},
+    {159032, 21.2500f, 21.200f},
+    {161031, 21.1875f, 21.200f},
+    {163040, 21.2500f, 21.200f},
+    {165040, 21.2500f, 21.200f},
+    {167037, 21.1875f, 21.200f},
+    {169036, 21.1250f, 21.200f},
+    {171050, 21.2500f, 21.200f},
+    {173050, 21.1875f, 21.200f},
+    {175049, 21.1875f, 21.200f},
+    {177049, 21.1875f, 21.200f},
+    {179043, 21.1875f, 21.200f},
+    {181045, 21.1875f, 21.200f},
+    {183049, 21.1875f, 21.200f},
+    {185048, 21.1250f, 21.200f},
+    {187048, 21.1875f, 21.200f},
+    {189057, 21.1875f, 21.200f},
+    {191061, 21.1875f, 21.200f},
+    {193063, 21.1250f, 21.200f},
+    {195062, 21.1250f, 21.200f},
+    {197063, 21.1875f, 21.200f},
+    {199067, 21.2500f, 21.200f},
+    {201081, 21.1875f, 21.200f},
+    {203082, 27.0625f, 27.068f},
+    {205079, 31.5000f, 31.469f},
+    {207073, 34.8125f, 34.773f},
+    {209067, 37.3125f, 37.259f},
+    {211061, 39.1250f, 39.128f},
+    {213061, 40.5625f, 40.538f},
+    {215060, 41.5625f, 41.596f},
+    {217069, 42.4375f, 42.396f},
+    {219070, 42.9375f, 42.994f},
+    {221074, 43.4375f, 43.443f},
+    {223074, 43.8125f, 43.780f},
+    {225074, 44.0625f, 44.034f},
+    {227078, 44.2500f, 44.225f},
+    {229082, 44.3125f, 44.368f},
+    {231082, 44.5000f, 44.475f},
+    {233082, 44.5625f, 44.556f},
+    {235091, 44.6250f, 44.617f},
+    {237085, 44.6875f, 44.662f},
+    {239082, 44.6875f, 44.696f},
+    {241076, 44.6875f, 44.722f},
+    {243080, 44.6875f, 44.741f},
+    {245080, 44.7500f, 44.756f},
+    {247080, 44.7500f, 44.767f},
+    {249080, 44.8125f, 44.775f},
+    {251077, 44.8125f, 44.781f},
+    {253074, 44.8125f, 44.786f},
+    {255068, 44.8125f, 44.789f},
+    {257082, 44.8125f, 44.792f},
+    {259076, 44.7500f, 44.794f},
+    {261080, 44.7500f, 44.796f},
+    {263077, 44.7500f, 44.797f},
+    {265091, 44.8125f, 44.797f},
+    {267090, 44.8125f, 44.798f},
+    {269092, 44.8125f, 44.799f},
+    {271086, 44.7500f, 44.799f},
+    {273085, 44.8125f, 44.799f},
+    {275084, 44.8125f, 44.799f},
+    {277085, 44.8125f, 44.800f},
+    {279094, 44.8125f, 44.800f},
+    {281094, 44.8125f, 44.800f},
+    {283091, 44.7500f, 44.800f},
+    {285091, 44.8125f, 44.800f},
+    {287092, 44.8125f, 44.800f},
+    {289101, 44.8125f, 44.800f},
+    {291101, 44.8125f, 44.800f},
+    {293101, 44.7500f, 44.800f},
+    {295101, 44.8125f, 44.800f},
+    {297103, 44.8750f, 44.800f},
+    {299117, 44.8750f, 44.800f},
+    {301117, 44.8125f, 44.800f},
+    {303111, 44.7500f, 44.800f},
+    {305115, 44.8125f, 44.800f},
+    {307112, 44.8125f, 44.800f},
+    {309106, 44.8125f, 44.800f},
+    {311107, 44.8125f, 44.800f},
+    {313104, 44.7500f, 44.800f},
+    {315108, 44.8125f, 44.800f},
+    {317108, 44.7500f, 44.800f},
+    {319108, 44.8125f, 44.800f},
+    {321107, 44.8125f, 44.800f},
+    {323116, 44.7500f, 44.800f},
+    {325125, 44.8125f, 44.800f},
+    {327119, 44.8125f, 44.800f},
+    {329113, 44.8125f, 44.800f},
+    {331113, 44.8125f, 44.800f},
+    {333113, 44.8125f, 44.800f},
+    {335107, 44.8125f, 44.800f},
+    {337101, 44.8125f, 44.800f},
+    {339101, 44.8125f, 44.800f},
+    {341098, 44.7500f, 44.800f},
+    {343099, 44.8125f, 44.800f},
+    {345103, 44.8125f, 44.800f},
+    {347107, 44.8125f, 44.800f},
+    {349101, 44.8125f, 44.800f},
+    {351115, 44.7500f, 44.800f},
+    {353129, 44.8125f, 44.800f},
+    {355143, 44.8125f, 44.800f},
+    {357157, 44.8125f, 44.800f},
+    {359151, 44.8125f, 44.800f},
+    {361155, 44.8125f, 44.800f},
+    {363152, 44.8125f, 44.800f},
+    {365146, 44.8125f, 44.800f},
+    {367140, 44.8125f, 44.800f},
+    {369137, 44.8125f, 44.800f},
+    {371139, 44.8125f, 44.800f},
+    {373136, 44.8125f, 44.800f},
+    {375130, 44.8125f, 44.800f},
+    {377130, 44.7500f, 44.800f},
+    {379131, 44.8125f, 44.800f},
+    {381140, 85.0000f, 44.800f},
+    {383142, 44.8125f, 44.800f},
+    {385141, 44.7500f, 44.800f},
+    {387150, 44.7500f, 44.800f},
+    {389151, 44.8750f, 44.800f},
+    {391151, 44.8125f, 44.800f},
+    {393151, 44.8125f, 44.800f},
+    {395152, 44.8125f, 44.800f},
+    {397166, 44.7500f, 44.800f},
+    {399168, 44.8125f, 44.800f},
+    {401170, 44.7500f, 44.800f},
+    {403169, 44.8125f, 44.800f},
+    {405173, 44.8125f, 44.800f},
+    {407177, 44.7500f, 44.800f},
+    {409178, 44.7500f, 44.800f},
+    {411178, 44.8125f, 44.800f},
+    {413179, 44.8125f, 44.800f},
+    {415179, 44.8125f, 44.800f},
+    {417188, 44.8750f, 44.800f},
+    {419202, 44.7500f, 44.800f},
+    {421203, 44.7500f, 44.800f},
+    {423200, 44.8125f, 44.800f},
+    {425197, 44.8125f, 44.800f},
+    {427199, 44.7500f, 44.800f},
+    {429208, 44.8750f, 44.800f},
+    {431209, 44.8125f, 44.800f},
+    {433203, 44.8750f, 44.800f},
+    {435204, 44.8125f, 44.800f},
+    {437198, 44.7500f, 44.800f},
+    {439192, 44.8125f, 44.800f},
+    {441193, 44.7500f, 44.800f},
+    {443187, 44.8125f, 44.800f},
+    {445187, 44.7500f, 44.800f},
+    {447188, 44.8750f, 44.800f},
+    {449190, 44.7500f, 44.800f},
+    {451184, 44.8125f, 44.800f},
+    {453181, 44.7500f, 44.800f},
+    {455183, 44.7500f, 44.800f},
+    {457184, 44.8125f, 44.800f},
+    {459188, 44.8125f, 44.800f},
+    {461182, 44.8125f, 44.800f},
+    {463186, 44.8125f, 44.800f},
+    {465183, 44.8750f, 44.800f},
+    {467177, 44.8750f, 44.800f},
+    {469171, 44.8750f, 44.800f},
+    {471165, 44.7500f, 44.800f},
+    {473166, 44.8125f, 44.800f},
+    {475168, 44.8125f, 44.800f},
+    {477182, 44.7500f, 44.800f},
+    {479176, 44.8125f, 44.800f},
+    {481177, 44.8125f, 44.800f},
+    {483186, 44.8125f, 44.800f},
+    {485200, 44.8125f, 44.800f},
+    {487202, 44.8125f, 44.800f},
+    {489204, 44.8125f, 44.800f},
+    {491201, 44.8125f, 44.800f},
+    {493202, 44.8125f, 44.800f},
+    {495199, 44.8125f, 44.800f},
+    {497198, 44.8125f, 44.800f},
+    {499199, 44.8125f, 44.800f},
+    {501198, 44.8125f, 44.800f},
+    {503200, 44.8125f, 44.800f},
+    {505202, 44.8125f, 44.800f},
+    {507204, 44.7500f, 44.800f},
+    {509208, 44.8125f, 44.800f},
+    {511208, 44.8125f, 44.800f},
+    {513222, 44.7500f, 44.800f},
+    {515224, 44.8125f, 44.800f},
+    {517238, 44.7500f, 44.800f},
+    {519237, 44.8125f, 44.800f},
+    {521246, 44.8125f, 44.800f},
+    {523243, 44.8125f, 44.800f},
+    {525243, 44.8125f, 44.800f},
+    {527252, 44.8750f, 44.800f},
+    {529256, 44.8125f, 44.800f},
+    {531255, 44.7500f, 44.800f},
+    {533255, 44.8125f, 44.800f},
+    {535269, 44.8125f, 44.800f},
+    {537268, 44.8125f, 44.800f},
+    {539269, 44.8125f, 44.800f},
+    {541263, 44.8125f, 44.800f},
+    {543263, 44.8125f, 44.800f},
+    {545257, 44.8125f, 44.800f},
+    {547271, 44.8125f, 44.800f},
+    {549265, 44.8125f, 44.800f},
+    {551279, 44.7500f, 44.800f},
+    {553278, 44.8125f, 44.800f},
+    {555280, 44.8125f, 44.800f},
+    {557274, 44.8125f, 44.800f},
+    {559273, 44.8750f, 44.800f},
+    {561272, 44.8125f, 44.800f},
+    {563281, 44.8125f, 44.800f},
+    {565275, 44.8125f, 44.800f},
+    {567274, 44.8125f, 44.800f},
+    {569283, 44.8125f, 44.800f},
+    {571292, 44.8125f, 44.800f},
+    {573296, 44.7500f, 44.800f},
+    {575298, 44.8125f, 44.800f},
+    {577300, 44.7500f, 44.800f},
+    {579299, 44.8125f, 44.800f},
+    {581296, 44.7500f, 44.800f},
+    {583296, 44.8125f, 44.800f},
+    {585296, 44.8125f, 44.800f},
+    {587305, 44.7500f, 44.800f},
+    {589306, 44.8125f, 44.800f},
+    {591303, 44.7500f, 44.800f},
+    {593317, 44.7500f, 44.800f},
+    {595321, 44.8125f, 44.800f},
+    {597335, 44.8125f, 44.800f},
+    {599344, 44.8125f, 44.800f},
+};
+
+// DHT22 temperature, heater on at sample 120, 21.0 -> 27.5 °C with tau 90 s.
+// Checksum-passing bit errors (+1.6 to +12.8 °C) at samples 31, 77-78, 133, 160
+// and 241-242, timeouts at 95-96 and 200.
+static const TracePoint dht22Heater[TRACE_POINTS] = {
+    {1000, 21.1f, 21.000f},
+    {3001, 21.1f, 21.000f},
+    {4998, 21.0f, 21.000f},
+    {7012, 21.1f, 21.000f},
+    {9013, 20.9f, 21.000f},
+    {11014, 21.1f, 21.000f},
+    {13011, 21.0f, 21.000f},
+    {15010, 21.0f, 21.000f},
+    {17010, 21.0f, 21.000f},
+    {19010, 21.0f, 21.000f},
+    {21012, 21.0f, 21.000f},
+    {23006, 21.0f, 21.000f},
+    {25005, 21.0f, 21.000f},
+    {27014, 21.0f, 21.000f},
+    {29014, 21.0f, 21.000f},
+    {31014, 21.1f, 21.000f},
+    {33014, 21.0f, 21.000f},
+    {35014, 21.0f, 21.000f},
+    {37013, 20.9f, 21.000f},
+    {39007, 21.1f, 21.000f},
+    {41008, 21.0f, 21.000f},
+    {43008, 21.0f, 21.000f},
+    {45007, 20.9f, 21.000f},
+    {47004, 21.0f, 21.000f},
+    {49001, 21.1f, 21.000f},
+    {51010, 20.9f, 21.000f},
+    {53024, 21.0f, 21.000f},
+    {55023, 21.0f, 21.000f},
+    {57017, 20.9f, 21.000f},
+    {59018, 21.1f, 21.000f},
+    {61022, 21.1f, 21.000f},
+    {63022, 22.6f, 21.000f},
+    {65023, 21.1f, 21.000f},
+    {67025, 21.0f, 21.000f},
+    {69024, 21.0f, 21.000f},
+    {71024, 21.0f, 21.000f},
+    {73018, 20.9f, 21.000f},
+    {75017, 21.0f, 21.000f},
+    {77014, 21.1f, 21.000f},
+    {79028, 21.1f, 21.000f},
+    {81029, 21.0f, 21.000f},
+    {83043, 20.9f, 21.000f},
+    {85037, 21.0f, 21.000f},
+    {87037, 20.9f, 21.000f},
+    {89039, 21.0f, 21.000f},
+    {91041, 21.0f, 21.000f},
+    {93038, 21.0f, 21.000f},
+    {95047, 20.9f, 21.000f},
+    {97048, 20.9f, 21.000f},
+    {99042, 21.0f, 21.000f},
+    {101041, 21.0f, 21.000f},
+    {103055, 21.0f, 21.000f},
+    {105057, 21.0f, 21.000f},
+    {107051, 21.1f, 21.000f},
+    {109055, 21.0f, 21.000f},
+    {111059, 21.0f, 21.000f},
+    {113056, 21.0f, 21.000f},
+    {115060, 21.1f, 21.000f},
+    {117069, 21.0f, 21.000f},
+    {119070, 21.0f, 21.000f},
+    {121072, 21.0f, 21.000f},
+    {123066, 20.9f, 21.000f},
+    {125080, 21.0f, 21.000f},
+    {127081, 21.1f, 21.000f},
+    {129081, 21.1f, 21.000f},
+    {131082, 21.0f, 21.000f},
+    {133081, 21.1f, 21.000f},
+    {135082, 21.0f, 21.000f},
+    {137084, 21.0f, 21.000f},
+    {139084, 21.0f, 21.000f},
+    {141083, 20.9f, 21.000f},
+    {143080, 21.0f, 21.000f},
+    {145077, 21.0f, 21.000f},
+    {147091, 20.9f, 21.000f},
+    {149093, 20.9f, 21.000f},
+    {151095, 20.9f, 21.000f},
+    {153092, 21.0f, 21.000f},
+    {155093, 24.2f, 21.000f},
+    {157097, 24.2f, 21.000f},
+    {159097, 20.9f, 21.000f},
+    {161099, 21.0f, 21.000f},
+    {163103, 21.0f, 21.000f},
+    {165104, 21.0f, 21.000f},
+    {167113, 21.1f, 21.000f},
+    {169117, 21.1f, 21.000f},
+    {171131, 21.0f, 21.000f},
+    {173131, 21.0f, 21.000f},
+    {175140, 21.1f, 21.000f},
+    {177154, 21.0f, 21.000f},
+    {179168, 21.0f, 21.000f},
+    {181182, 21.0f, 21.000f},
+    {183176, 21.1f, 21.000f},
+    {185177, 20.9f, 21.000f},
+    {187177, 21.0f, 21.000f},
+    {189171, 21.0f, 21.000f},
+    {191185, NAN, 21.000f},
+    {193189, NAN, 21.000f},
+    {195203, 21.0f, 21.000f},
+    {197207, 21.0f, 21.000f},
+    {199221, 21.0f, 21.000f},
+    {201221, 21.1f, 21.000f},
+    {203222, 21.1f, 21.000f},
+    {205236, 20.9f, 21.000f},
+    {207245, 21.0f, 21.000f},
+    {209245, 21.1f, 21.000f},
+    {211246, 20.9f, 21.000f},
+    {213243, 21.0f, 21.000f},
+    {215240, 20.9f, 21.000f},
+    {217249, 20.9f, 21.000f},
+    {219249, 21.1f, 21.000f},
+    {221249, 21.1f, 21.000f},
+    {223253, 21.0f, 21.000f},
+    {225255, 21.0f, 21.000f},
+    {227252, 21.1f, 21.000f},
+    {229251, 21.0f, 21.000f},
+    {231265, 21.0f, 21.000f},
+    {233279, 21.1f, 21.000f},
+    {235288, 20.9f, 21.000f},
+    {237290, 21.1f, 21.000f},
+    {239289, 21.0f, 21.000f},
+    {241293, 21.0f, 21.000f},
+    {243294, 21.2f, 21.143f},
+    {245295, 21.3f, 21.283f},
+    {247304, 21.3f, 21.420f},
+    {249304, 21.6f, 21.554f},
+    {251301, 21.7f, 21.684f},
+    {253315, 21.8f, 21.813f},
+    {255309, 21.9f, 21.937f},
+    {257311, 22.1f, 22.060f},
+    {259312, 22.2f, 22.179f},
+    {261314, 22.3f, 22.296f},
+    {263328, 22.4f, 22.412f},
+    {265332, 22.6f, 22.524f},
+    {267329, 23.3f, 22.633f},
+    {269328, 22.7f, 22.740f},
+    {271330, 22.8f, 22.844f},
+    {273327, 23.0f, 22.947f},
+    {275336, 23.0f, 23.047f},
+    {277330, 23.2f, 23.145f},
+    {279344, 23.2f, 23.241f},
+    {281348, 23.3f, 23.335f},
+    {283347, 23.4f, 23.426f},
+    {285347, 23.4f, 23.516f},
+    {287351, 23.6f, 23.604f},
+    {289345, 23.7f, 23.689f},
+    {291342, 23.9f, 23.773f},
+    {293343, 23.9f, 23.855f},
+    {295342, 23.9f, 23.935f},
+    {297346, 24.1f, 24.013f},
+    {299345, 24.2f, 24.090f},
+    {301342, 24.3f, 24.165f},
+    {303339, 24.2f, 24.238f},
+    {305348, 24.3f, 24.310f},
+    {307342, 24.4f, 24.380f},
+    {309342, 24.5f, 24.448f},
+    {311341, 24.5f, 24.515f},
+    {313342, 24.6f, 24.581f},
+    {315341, 24.6f, 24.645f},
+    {317340, 24.7f, 24.708f},
+    {319337, 24.7f, 24.769f},
+    {321346, 37.6f, 24.829f},
+    {323346, 24.9f, 24.888f},
+    {325346, 24.9f, 24.945f},
+    {327355, 25.0f, 25.002f},
+    {329352, 25.1f, 25.057f},
+    {331354, 25.1f, 25.110f},
+    {333368, 25.2f, 25.163f},
+    {335365, 25.2f, 25.215f},
+    {337379, 25.2f, 25.265f},
+    {339388, 25.3f, 25.314f},
+    {341388, 25.4f, 25.363f},
+    {343385, 25.5f, 25.409f},
+    {345385, 25.4f, 25.455f},
+    {347399, 25.6f, 25.501f},
+    {349398, 25.6f, 25.545f},
+    {351395, 25.5f, 25.587f},
+    {353409, 25.6f, 25.630f},
+    {355406, 25.6f, 25.671f},
+    {357410, 25.7f, 25.711f},
+    {359410, 25.7f, 25.750f},
+    {361414, 25.8f, 25.789f},
+    {363414, 25.9f, 25.827f},
+    {365416, 25.9f, 25.863f},
+    {367416, 26.0f, 25.899f},
+    {369410, 25.9f, 25.934f},
+    {371407, 26.0f, 25.969f},
+    {373406, 26.0f, 26.002f},
+    {375400, 26.1f, 26.035f},
+    {377397, 26.1f, 26.067f},
+    {379401, 26.0f, 26.099f},
+    {381402, 26.1f, 26.130f},
+    {383416, 26.1f, 26.160f},
+    {385420, 26.2f, 26.190f},
+    {387417, 26.3f, 26.218f},
+    {389426, 26.2f, 26.247f},
+    {391423, 26.2f, 26.274f},
+    {393422, 26.3f, 26.301f},
+    {395419, 26.3f, 26.327f},
+    {397413, 26.4f, 26.353f},
+    {399413, 26.4f, 26.378f},
+    {401415, NAN, 26.403f},
+    {403415, 26.4f, 26.427f},
+    {405417, 26.5f, 26.451f},
+    {407416, 26.5f, 26.474f},
+    {409410, 26.4f, 26.496f},
+    {411407, 26.6f, 26.518f},
+    {413407, 26.6f, 26.540f},
+    {415408, 26.5f, 26.561f},
+    {417412, 26.6f, 26.582f},
+    {419413, 26.6f, 26.602f},
+    {421414, 26.7f, 26.622f},
+    {423411, 26.6f, 26.641f},
+    {425413, 26.7f, 26.660f},
+    {427415, 26.7f, 26.678f},
+    {429415, 26.7f, 26.696f},
+    {431429, 26.7f, 26.714f},
+    {433443, 26.7f, 26.731f},
+    {435443, 26.7f, 26.748f},
+    {437452, 26.7f, 26.765f},
+    {439451, 26.7f, 26.781f},
+    {441452, 26.8f, 26.797f},
+    {443453, 26.8f, 26.812f},
+    {445454, 26.8f, 26.827f},
+    {447454, 26.9f, 26.842f},
+    {449458, 26.9f, 26.857f},
+    {451458, 26.9f, 26.871f},
+    {453457, 26.8f, 26.885f},
+    {455459, 27.0f, 26.898f},
+    {457459, 26.9f, 26.911f},
+    {459459, 26.9f, 26.924f},
+    {461456, 26.9f, 26.937f},
+    {463470, 26.9f, 26.949f},
+    {465469, 26.8f, 26.962f},
+    {467470, 26.9f, 26.973f},
+    {469484, 27.0f, 26.985f},
+    {471478, 26.9f, 26.996f},
+    {473487, 27.0f, 27.007f},
+    {475496, 27.1f, 27.018f},
+    {477493, 27.1f, 27.029f},
+    {479494, 27.0f, 27.039f},
+    {481494, 27.1f, 27.049f},
+    {483493, 33.4f, 27.059f},
+    {485495, 28.7f, 27.069f},
+    {487499, 27.0f, 27.078f},
+    {489508, 27.1f, 27.088f},
+    {491517, 27.0f, 27.097f},
+    {493511, 27.1f, 27.106f},
+    {495520, 27.1f, 27.114f},
+    {497521, 27.1f, 27.123f},
+    {499520, 27.1f, 27.131f},
+    {501517, 27.1f, 27.139f},
+    {503518, 27.2f, 27.147f},
+    {505522, 27.2f, 27.155f},
+    {507516, 27.2f, 27.163f},
+    {509525, 27.1f, 27.170f},
+    {511525, 27.2f, 27.177f},
+    {513534, 27.2f, 27.184f},
+    {515536, 27.2f, 27.191f},
+    {517538, 27.2f, 27.198f},
+    {519552, 27.2f, 27.205f},
+    {521552, 27.2f, 27.211f},
+    {523561, 27.1f, 27.218f},
+    {525563, 27.2f, 27.224f},
+    {527557, 27.2f, 27.230f},
+    {529557, 27.1f, 27.236f},
+    {531551, 27.2f, 27.242f},
+    {533551, 27.3f, 27.247f},
+    {535551, 27.3f, 27.253f},
+    {537551, 27.2f, 27.258f},
+    {539552, 27.3f, 27.264f},
+    {541549, 27.3f, 27.269f},
+    {543563, 27.3f, 27.274f},
+    {545565, 27.2f, 27.279f},
+    {547569, 27.3f, 27.284f},
+    {549583, 27.2f, 27.289f},
+    {551582, 27.3f, 27.293f},
+    {553596, 27.3f, 27.298f},
+    {555600, 27.2f, 27.302f},
+    {557604, 27.3f, 27.307f},
+    {559605, 27.3f, 27.311f},
+    {561605, 27.4f, 27.315f},
+    {563605, 27.3f, 27.319f},
+    {565604, 27.3f, 27.323f},
+    {567604, 27.4f, 27.327f},
+    {569606, 27.3f, 27.331f},
+    {571607, 27.4f, 27.334f},
+    {573604, 27.4f, 27.338f},
+    {575598, 27.4f, 27.342f},
+    {577607, 27.3f, 27.345f},
+    {579607, 27.4f, 27.349f},
+    {581606, 27.4f, 27.352f},
+    {583606, 27.3f, 27.355f},
+    {585603, 27.3f, 27.358f},
+    {587607, 27.4f, 27.361f},
+    {589608, 27.4f, 27.364f},
+    {591622, 27.3f, 27.367f},
+    {593631, 27.4f, 27.370f},
+    {595631, 27.4f, 27.373f},
+    {597625, 27.4f, 27.376f},
+    {599624, 27.5f, 27.379f},
+};
+
+// DHT22 humidity, shower from sample 80 (48 -> ~74 %RH, tau 60 s) and
+// venting from sample 200 (tau 150 s). Checksum-passing bit errors (+3.2 to
+// +25.6 %RH) at samples 44, 120-121, 171 and 250, timeouts at 12-14 and 230.
+static const TracePoint dht22Shower[TRACE_POINTS] = {
+    {1000, 48.3f, 48.000f},
+    {3009, 48.0f, 48.000f},
+    {5018, 48.0f, 48.000f},
+    {7018, 48.1f, 48.000f},
+    {9027, 47.9f, 48.000f},
+    {11029, 47.5f, 48.000f},
+    {13030, 48.2f, 48.000f},
+    {15029, 48.2f, 48.000f},
+    {17043, 48.2f, 48.000f},
+    {19040, 48.0f, 48.000f},
+    {21049, 47.9f, 48.000f},
+    {23046, 48.2f, 48.000f},
+    {25043, NAN, 48.000f},
+    {27040, NAN, 48.000f},
+    {29044, NAN, 48.000f},
+    {31045, 47.9f, 48.000f},
+    {33049, 48.2f, 48.000f},
+    {35053, 48.0f, 48.000f},
+    {37052, 48.1f, 48.000f},
+    {39056, 48.0f, 48.000f},
+    {41058, 48.0f, 48.000f},
+    {43057, 48.0f, 48.000f},
+    {45051, 48.2f, 48.000f},
+    {47060, 48.0f, 48.000f},
+    {49061, 48.0f, 48.000f},
+    {51065, 48.0f, 48.000f},
+    {53059, 47.7f, 48.000f},
+    {55053, 48.1f, 48.000f},
+    {57055, 47.8f, 48.000f},
+    {59049, 48.2f, 48.000f},
+    {61043, 47.8f, 48.000f},
+    {63043, 47.9f, 48.000f},
+    {65043, 48.0f, 48.000f},
+    {67057, 47.9f, 48.000f},
+    {69059, 47.8f, 48.000f},
+    {71053, 48.1f, 48.000f},
+    {73047, 48.0f, 48.000f},
+    {75047, 47.8f, 48.000f},
+    {77047, 47.9f, 48.000f},
+    {79048, 47.9f, 48.000f},
+    {81045, 48.0f, 48.000f},
+    {83044, 48.3f, 48.000f},
+    {85046, 48.0f, 48.000f},
+    {87048, 48.0f, 48.000f},
+    {89052, 54.5f, 48.000f},
+    {91053, 47.9f, 48.000f},
+    {93052, 47.7f, 48.000f},
+    {95049, 48.0f, 48.000f},
+    {97048, 48.3f, 48.000f},
+    {99045, 48.1f, 48.000f},
+    {101059, 48.2f, 48.000f},
+    {103056, 48.0f, 48.000f},
+    {105053, 48.0f, 48.000f},
+    {107053, 48.2f, 48.000f},
+    {109047, 48.1f, 48.000f},
+    {111047, 48.0f, 48.000f},
+    {113061, 47.9f, 48.000f},
+    {115065, 48.1f, 48.000f},
+    {117065, 47.9f, 48.000f},
+    {119062, 48.0f, 48.000f},
+    {121071, 48.1f, 48.000f},
+    {123072, 48.1f, 48.000f},
+    {125072, 47.8f, 48.000f},
+    {127069, 48.2f, 48.000f},
+    {129069, 47.9f, 48.000f},
+    {131069, 48.0f, 48.000f},
+    {133078, 48.0f, 48.000f},
+    {135078, 47.9f, 48.000f},
+    {137078, 47.9f, 48.000f},
+    {139082, 48.2f, 48.000f},
+    {141082, 47.9f, 48.000f},
+    {143079, 48.0f, 48.000f},
+    {145080, 48.1f, 48.000f},
+    {147084, 48.0f, 48.000f},
+    {149086, 47.8f, 48.000f},
+    {151080, 47.9f, 48.000f},
+    {153080, 47.6f, 48.000f},
+    {155077, 48.1f, 48.000f},
+    {157086, 47.8f, 48.000f},
+    {159090, 48.1f, 48.000f},
+    {161099, 48.1f, 48.000f},
+    {163093, 48.7f, 48.981f},
+    {165097, 49.9f, 49.934f},
+    {167111, 50.9f, 50.860f},
+    {169112, 51.6f, 51.750f},
+    {171126, 52.6f, 52.617f},
+    {173123, 53.6f, 53.448f},
+    {175132, 54.4f, 54.256f},
+    {177134, 54.9f, 55.036f},
+    {179133, 55.9f, 55.788f},
+    {181133, 56.4f, 56.516f},
+    {183137, 57.0f, 57.222f},
+    {185136, 57.8f, 57.903f},
+    {187138, 58.6f, 58.562f},
+    {189137, 59.3f, 59.199f},
+    {191136, 59.5f, 59.815f},
+    {193130, 60.4f, 60.410f},
+    {195129, 60.8f, 60.986f},
+    {197143, 61.5f, 61.548f},
+    {199140, 61.8f, 62.086f},
+    {201149, 62.7f, 62.610f},
+    {203153, 63.1f, 63.116f},
+    {205147, 63.7f, 63.602f},
+    {207147, 64.0f, 64.074f},
+    {209147, 64.3f, 64.531f},
+    {211149, 65.4f, 64.973f},
+    {213163, 65.2f, 65.403f},
+    {215172, 66.4f, 65.818f},
+    {217172, 66.4f, 66.217f},
+    {219174, 66.3f, 66.604f},
+    {221174, 67.0f, 66.977f},
+    {223183, 67.3f, 67.340f},
+    {225192, 67.8f, 67.691f},
+    {227189, 68.0f, 68.029f},
+    {229189, 68.2f, 68.356f},
+    {231190, 68.4f, 68.672f},
+    {233190, 68.8f, 68.978f},
+    {235187, 69.5f, 69.273f},
+    {237187, 69.6f, 69.559f},
+    {239187, 70.0f, 69.836f},
+    {241188, 83.0f, 70.104f},
+    {243187, 73.8f, 70.363f},
+    {245181, 70.8f, 70.612f},
+    {247195, 71.0f, 70.856f},
+    {249192, 70.9f, 71.090f},
+    {251191, 71.3f, 71.316f},
+    {253195, 71.4f, 71.536f},
+    {255204, 71.8f, 71.749f},
+    {257218, 71.6f, 71.955f},
+    {259232, 72.3f, 72.155f},
+    {261232, 72.2f, 72.346f},
+    {263226, 72.6f, 72.531f},
+    {265227, 72.9f, 72.710f},
+    {267221, 73.0f, 72.883f},
+    {269215, 73.0f, 73.051f},
+    {271216, 73.2f, 73.213f},
+    {273216, 73.3f, 73.370f},
+    {275230, 73.5f, 73.523f},
+    {277232, 73.5f, 73.670f},
+    {279232, 73.6f, 73.812f},
+    {281233, 74.0f, 73.949f},
+    {283237, 74.2f, 74.082f},
+    {285237, 74.1f, 74.211f},
+    {287231, 74.4f, 74.334f},
+    {289232, 74.8f, 74.455f},
+    {291232, 74.6f, 74.571f},
+    {293234, 74.6f, 74.683f},
+    {295228, 74.9f, 74.792f},
+    {297227, 75.1f, 74.897f},
+    {299241, 74.9f, 74.999f},
+    {301245, 75.2f, 75.098f},
+    {303244, 75.1f, 75.193f},
+    {305244, 75.1f, 75.285f},
+    {307245, 75.2f, 75.374f},
+    {309259, 75.2f, 75.461f},
+    {311259, 75.4f, 75.544f},
+    {313260, 75.4f, 75.625f},
+    {315257, 75.6f, 75.702f},
+    {317254, 75.6f, 75.778f},
+    {319268, 75.8f, 75.851f},
+    {321272, 75.8f, 75.921f},
+    {323266, 75.9f, 75.989f},
+    {325263, 76.1f, 76.055f},
+    {327264, 76.0f, 76.119f},
+    {329264, 76.2f, 76.181f},
+    {331278, 76.2f, 76.241f},
+    {333278, 76.2f, 76.298f},
+    {335278, 76.2f, 76.354f},
+    {337279, 76.3f, 76.408f},
+    {339280, 76.5f, 76.460f},
+    {341289, 76.7f, 76.511f},
+    {343288, 102.0f, 76.560f},
+    {345302, 76.3f, 76.607f},
+    {347299, 76.9f, 76.653f},
+    {349293, 76.5f, 76.697f},
+    {351290, 76.6f, 76.740f},
+    {353299, 76.7f, 76.781f},
+    {355313, 76.9f, 76.821f},
+    {357327, 76.8f, 76.860f},
+    {359321, 77.1f, 76.898f},
+    {361322, 77.1f, 76.934f},
+    {363331, 76.9f, 76.969f},
+    {365335, 76.8f, 77.003f},
+    {367339, 76.9f, 77.035f},
+    {369338, 76.9f, 77.067f},
+    {371338, 77.1f, 77.098f},
+    {373332, 77.0f, 77.127f},
+    {375341, 77.0f, 77.156f},
+    {377341, 77.0f, 77.184f},
+    {379350, 77.3f, 77.210f},
+    {381359, 77.0f, 77.236f},
+    {383359, 77.1f, 77.262f},
+    {385356, 77.3f, 77.286f},
+    {387353, 77.4f, 77.309f},
+    {389355, 77.5f, 77.332f},
+    {391369, 77.3f, 77.354f},
+    {393383, 77.8f, 77.375f},
+    {395380, 77.5f, 77.396f},
+    {397380, 77.4f, 77.415f},
+    {399380, 77.6f, 77.435f},
+    {401389, 77.4f, 77.453f},
+    {403389, 76.9f, 77.063f},
+    {405389, 76.6f, 76.678f},
+    {407386, 76.2f, 76.299f},
+    {409395, 76.2f, 75.922f},
+    {411395, 75.2f, 75.553f},
+    {413392, 75.0f, 75.188f},
+    {415392, 75.0f, 74.828f},
+    {417392, 74.6f, 74.473f},
+    {419396, 74.2f, 74.121f},
+    {421410, 73.9f, 73.773f},
+    {423404, 73.6f, 73.433f},
+    {425401, 73.2f, 73.096f},
+    {427403, 73.1f, 72.764f},
+    {429402, 72.6f, 72.436f},
+    {431406, 71.8f, 72.111f},
+    {433403, 72.0f, 71.793f},
+    {435403, 71.4f, 71.477f},
+    {437400, 71.1f, 71.167f},
+    {439414, 71.2f, 70.858f},
+    {441423, 70.8f, 70.554f},
+    {443432, 70.4f, 70.254f},
+    {445433, 69.7f, 69.959f},
+    {447427, 69.9f, 69.669f},
+    {449426, 69.3f, 69.382f},
+    {451425, 69.0f, 69.099f},
+    {453434, 68.9f, 68.818f},
+    {455428, 68.3f, 68.543f},
+    {457428, 68.2f, 68.271f},
+    {459429, 68.1f, 68.003f},
+    {461426, NAN, 67.738f},
+    {463423, 67.6f, 67.477f},
+    {465424, 67.2f, 67.219f},
+    {467423, 67.0f, 66.965f},
+    {469437, 66.6f, 66.712f},
+    {471434, 66.6f, 66.464f},
+    {473443, 66.3f, 66.219f},
+    {475443, 65.8f, 65.977f},
+    {477452, 65.7f, 65.738f},
+    {479466, 65.5f, 65.502f},
+    {481466, 65.5f, 65.270f},
+    {483463, 65.3f, 65.041f},
+    {485464, 64.7f, 64.816f},
+    {487468, 64.3f, 64.592f},
+    {489470, 64.6f, 64.372f},
+    {491472, 64.3f, 64.155f},
+    {493476, 63.9f, 63.941f},
+    {495476, 63.7f, 63.730f},
+    {497490, 63.3f, 63.520f},
+    {499484, 63.0f, 63.315f},
+    {501486, 69.3f, 63.112f},
+    {503483, 62.9f, 62.912f},
+    {505480, 62.4f, 62.715f},
+    {507489, 62.5f, 62.519f},
+    {509490, 62.5f, 62.327f},
+    {511490, 62.2f, 62.137f},
+    {513492, 62.0f, 61.950f},
+    {515492, 61.7f, 61.765f},
+    {517492, 61.8f, 61.582f},
+    {519501, 61.5f, 61.402f},
+    {521495, 61.1f, 61.225f},
+    {523497, 61.1f, 61.049f},
+    {525496, 60.9f, 60.877f},
+    {527498, 60.3f, 60.706f},
+    {529492, 60.7f, 60.538f},
+    {531486, 60.4f, 60.373f},
+    {533487, 60.3f, 60.209f},
+    {535496, 60.1f, 60.046f},
+    {537497, 60.2f, 59.887f},
+    {539494, 59.6f, 59.729f},
+    {541503, 59.8f, 59.573f},
+    {543505, 59.6f, 59.420f},
+    {545502, 59.0f, 59.269f},
+    {547499, 58.9f, 59.120f},
+    {549499, 58.9f, 58.973f},
+    {551500, 58.7f, 58.827f},
+    {553501, 58.8f, 58.684f},
+    {555505, 58.8f, 58.542f},
+    {557509, 58.5f, 58.402f},
+    {559509, 58.3f, 58.264f},
+    {561511, 58.1f, 58.128f},
+    {563512, 58.2f, 57.994f},
+    {565516, 58.0f, 57.861f},
+    {567520, 57.7f, 57.730f},
+    {569514, 57.5f, 57.602f},
+    {571513, 57.2f, 57.475f},
+    {573513, 57.3f, 57.349f},
+    {575513, 57.1f, 57.226f},
+    {577513, 57.1f, 57.103f},
+    {579514, 57.1f, 56.983f},
+    {581513, 56.8f, 56.864f},
+    {583513, 56.6f, 56.746f},
+    {585517, 56.9f, 56.630f},
+    {587518, 56.6f, 56.516f},
+    {589519, 56.5f, 56.403f},
+    {591528, 56.5f, 56.291f},
+    {593529, 56.1f, 56.181f},
+    {595529, 55.9f, 56.073f},
+    {597531, 55.8f, 55.966f},
+    {599531, 55.8f, 55.861f},
+};
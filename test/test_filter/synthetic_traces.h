@@ -0,0 +1,52 @@
+#pragma once
+// Sensor traces at the 2 s sampling interval, one value per sample, NAN for a
+// failed read. They are synthetic, written by hand rather than captured from
+// a device, and reproduce the known failure modes of the parts:
+//  - DS18B20 returning its 85 °C power-on value after a supply brownout
+//  - DHT22 bit errors that pass the checksum, single wild samples
+//  - a real step when a heater switches on
+//  - DHT22 read timeouts
+#include <math.h>
+
+static const uint32_t TRACE_INTERVAL = 2000; // ms
+static const int TRACE_LENGTH = 60;
+
+// 21.1 °C at 12 bit, 85.0 at samples 20 and 41
+static const float syntheticDs18b20PowerOn[TRACE_LENGTH] = {
+    21.0625f, 21.0625f, 21.1250f, 21.0625f, 21.1250f, 21.1250f, 21.1250f, 21.1250f, 21.1250f, 21.1250f,
+    21.1250f, 21.1250f, 21.1250f, 21.1875f, 21.1250f, 21.1250f, 21.1250f, 21.1250f, 21.1250f, 21.0625f,
+    85.0f, 21.0625f, 21.1250f, 21.0625f, 21.0625f, 21.0f, 21.0625f, 21.0625f, 21.0f, 21.0625f,
+    21.0625f, 21.0625f, 21.0625f, 21.0f, 21.0625f, 21.0625f, 21.1250f, 21.0625f, 21.0625f, 21.1250f,
+    21.1250f, 85.0f, 21.1875f, 21.1250f, 21.1250f, 21.1250f, 21.1250f, 21.1875f, 21.1875f, 21.1250f,
+    21.1875f, 21.1250f, 21.1250f, 21.1250f, 21.0625f, 21.1250f, 21.0625f, 21.1250f, 21.1250f, 21.0625f,
+};
+
+// 22.3 °C, bit errors at samples 15, 33 and 47
+static const float syntheticDht22Spikes[TRACE_LENGTH] = {
+    22.4000f, 22.3000f, 22.4000f, 22.4000f, 22.4000f, 22.3000f, 22.4000f, 22.5000f, 22.4000f, 22.4000f,
+    22.3000f, 22.4000f, 22.4000f, 22.5000f, 22.5000f, 31.8000f, 22.4000f, 22.4000f, 22.3000f, 22.4000f,
+    22.3000f, 22.3000f, 22.3000f, 22.4000f, 22.3000f, 22.3000f, 22.3000f, 22.4000f, 22.2000f, 22.3000f,
+    22.3000f, 22.3000f, 22.3000f, -12.4000f, 22.2000f, 22.2000f, 22.2000f, 22.3000f, 22.3000f, 22.1000f,
+    22.1000f, 22.1000f, 22.1000f, 22.2000f, 22.2000f, 22.2000f, 22.1000f, 47.9000f, 22.2000f, 22.2000f,
+    22.3000f, 22.3000f, 22.3000f, 22.3000f, 22.3000f, 22.2000f, 22.4000f, 22.4000f, 22.4000f, 22.4000f,
+};
+
+// 21.0 °C, heater on at sample 30 settles at 27.5 °C
+static const float syntheticDht22Step[TRACE_LENGTH] = {
+    21.0f, 21.0f, 20.9000f, 21.0f, 20.9000f, 20.9000f, 20.9000f, 20.9000f, 21.0f, 20.9000f,
+    20.9000f, 20.9000f, 20.9000f, 21.0f, 20.9000f, 21.1000f, 21.0f, 20.9000f, 21.0f, 21.0f,
+    21.0f, 20.9000f, 21.1000f, 21.1000f, 21.0f, 21.0f, 20.9000f, 20.9000f, 21.0f, 21.0f,
+    27.6000f, 27.4000f, 27.4000f, 27.6000f, 27.5000f, 27.4000f, 27.5000f, 27.4000f, 27.5000f, 27.6000f,
+    27.6000f, 27.5000f, 27.5000f, 27.5000f, 27.4000f, 27.6000f, 27.5000f, 27.6000f, 27.5000f, 27.4000f,
+    27.6000f, 27.6000f, 27.6000f, 27.6000f, 27.6000f, 27.5000f, 27.4000f, 27.5000f, 27.5000f, 27.4000f,
+};
+
+// 48 %RH, timeouts at samples 12-14 and 40
+static const float syntheticDht22Timeouts[TRACE_LENGTH] = {
+    47.8000f, 47.9000f, 48.0f, 48.2000f, 48.3000f, 48.2000f, 48.4000f, 48.4000f, 48.4000f, 48.2000f,
+    48.2000f, 48.2000f, NAN, NAN, NAN, 48.4000f, 48.4000f, 48.2000f, 48.3000f, 48.3000f,
+    48.0f, 48.2000f, 48.3000f, 48.2000f, 48.1000f, 48.0f, 47.8000f, 48.0f, 47.8000f, 48.0f,
+    48.0f, 47.8000f, 47.7000f, 47.9000f, 47.8000f, 47.6000f, 47.6000f, 47.6000f, 47.9000f, 47.8000f,
+    NAN, 47.9000f, 47.9000f, 47.8000f, 47.7000f, 47.8000f, 47.7000f, 47.7000f, 48.1000f, 48.0f,
+    48.0f, 48.2000f, 48.0f, 48.2000f, 48.3000f, 48.1000f, 48.1000f, 48.1000f, 48.1000f, 48.3000f,
+};
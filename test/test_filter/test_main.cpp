@@ -0,0 +1,287 @@
+// ChannelFilter with the channels' configs: hand-written traces of the known
+// failure modes, and the modelled traces the configs were tuned on.
+#include <unity.h>
+#include <math.h>
+#include <vector>
+#include "filter.h"
+#include "synthetic_traces.h"
+#include "modelled_traces.h"
+
+static const FilterConfig dht22Temperature = DHT22_TEMPERATURE_FILTER;
+static const FilterConfig dht22Humidity = DHT22_HUMIDITY_FILTER;
+static const FilterConfig ds18b20Temperature = DS18B20_TEMPERATURE_FILTER;
+
+struct Output {
+    std::vector<float> values;   // filtered, NAN where nothing came out
+    uint32_t dropped;            // rejected as outliers
+};
+
+static Output run(ChannelFilter& filter, const float* trace, uint32_t start = 1000) {
+    Output out;
+    out.dropped = 0;
+    for (int i = 0; i < TRACE_LENGTH; i++) {
+        SensorReading reading;
+        reading.timestamp = start + i * TRACE_INTERVAL;
+        reading.channel = 0;
+        reading.valid = !isnan(trace[i]);
+        reading.value = trace[i];
+        if (!filter.apply(reading)) {
+            out.dropped++;
+            out.values.push_back(NAN);
+            continue;
+        }
+        out.values.push_back(reading.valid ? reading.value : NAN);
+    }
+    return out;
+}
+
+static Output run(ChannelFilter& filter, const TracePoint* trace) {
+    Output out;
+    out.dropped = 0;
+    for (int i = 0; i < TRACE_POINTS; i++) {
+        SensorReading reading;
+        reading.timestamp = trace[i].timestamp;
+        reading.channel = 0;
+        reading.valid = !isnan(trace[i].value);
+        reading.value = trace[i].value;
+        if (!filter.apply(reading)) {
+            out.dropped++;
+            out.values.push_back(NAN);
+            continue;
+        }
+        out.values.push_back(reading.valid ? reading.value : NAN);
+    }
+    return out;
+}
+
+// Largest distance from truth over [from, to), skipping samples without output
+static float maxError(const Output& out, const TracePoint* trace, int from = 0, int to = TRACE_POINTS) {
+    float worst = 0;
+    for (int i = from; i < to; i++) {
+        if (!isnan(out.values[i])) {
+            worst = fmaxf(worst, fabsf(out.values[i] - trace[i].truth));
+        }
+    }
+    return worst;
+}
+
+// Sample-to-sample movement over [from, to)
+static float movement(const Output& out, int from, int to) {
+    float sum = 0;
+    float previous = NAN;
+    for (int i = from; i < to; i++) {
+        if (isnan(out.values[i])) {
+            continue;
+        }
+        if (!isnan(previous)) {
+            sum += fabsf(out.values[i] - previous);
+        }
+        previous = out.values[i];
+    }
+    return sum;
+}
+
+static Output raw(const TracePoint* trace) {
+    Output out;
+    out.dropped = 0;
+    for (int i = 0; i < TRACE_POINTS; i++) {
+        out.values.push_back(trace[i].value);
+    }
+    return out;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_synthetic_ds18b20_power_on_value_rejected() {
+    ChannelFilter filter;
+    filter.configure(ds18b20Temperature);
+    Output out = run(filter, syntheticDs18b20PowerOn);
+
+    TEST_ASSERT_EQUAL(2, out.dropped);
+    TEST_ASSERT_EQUAL(2, filter.getRejectedCount());
+    for (int i = 0; i < TRACE_LENGTH; i++) {
+        if (!isnan(out.values[i])) {
+            TEST_ASSERT_FLOAT_WITHIN(0.2f, 21.1f, out.values[i]);
+        }
+    }
+    float latest;
+    TEST_ASSERT_TRUE(filter.getValue(latest));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 21.1f, latest);
+}
+
+void test_synthetic_dht22_bit_errors_never_reach_the_output() {
+    ChannelFilter filter;
+    filter.configure(dht22Temperature);
+    Output out = run(filter, syntheticDht22Spikes);
+
+    TEST_ASSERT_EQUAL(3, out.dropped);
+    for (int i = 0; i < TRACE_LENGTH; i++) {
+        if (!isnan(out.values[i])) {
+            TEST_ASSERT_FLOAT_WITHIN(0.3f, 22.3f, out.values[i]);
+        }
+    }
+}
+
+void test_synthetic_real_step_is_followed() {
+    ChannelFilter filter;
+    filter.configure(dht22Temperature);
+    Output out = run(filter, syntheticDht22Step);
+
+    // A jump this steep in one sample is faster than the rate limit allows,
+    // it is taken as a real step once it persists for FILTER_REJECT_LIMIT samples
+    TEST_ASSERT_EQUAL(FILTER_REJECT_LIMIT - 1, out.dropped);
+    for (int i = 30; i < 30 + FILTER_REJECT_LIMIT - 1; i++) {
+        TEST_ASSERT_TRUE(isnan(out.values[i]));
+    }
+    // The filter restarts from the step, without overshoot
+    for (int i = 30 + FILTER_REJECT_LIMIT - 1; i < TRACE_LENGTH; i++) {
+        TEST_ASSERT_TRUE(out.values[i] < 27.7f);
+        if (i >= 38) {
+            TEST_ASSERT_FLOAT_WITHIN(0.2f, 27.5f, out.values[i]);
+        }
+    }
+    for (int i = 0; i < 30; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.2f, 21.0f, out.values[i]);
+    }
+}
+
+void test_synthetic_timeouts_pass_through_and_keep_state() {
+    ChannelFilter filter;
+    filter.configure(dht22Humidity);
+    Output out = run(filter, syntheticDht22Timeouts);
+
+    TEST_ASSERT_EQUAL(0, out.dropped);
+    float value;
+    for (int i = 0; i < TRACE_LENGTH; i++) {
+        if (isnan(syntheticDht22Timeouts[i])) {
+            TEST_ASSERT_TRUE(isnan(out.values[i]));
+        } else {
+            TEST_ASSERT_FLOAT_WITHIN(0.6f, 48.0f, out.values[i]);
+        }
+    }
+    TEST_ASSERT_TRUE(filter.getValue(value));
+
+    // Smoothing continues across the dropout instead of restarting
+    SensorReading reading = { 1000 + TRACE_LENGTH * TRACE_INTERVAL, 0, false, NAN };
+    filter.apply(reading);
+    TEST_ASSERT_FALSE(filter.getValue(value));
+    reading.timestamp += TRACE_INTERVAL;
+    reading.valid = true;
+    reading.value = 50.0f;
+    TEST_ASSERT_TRUE(filter.apply(reading));
+    TEST_ASSERT_TRUE(reading.value < 49.5f);
+}
+
+void test_synthetic_restarts_after_a_long_gap() {
+    ChannelFilter filter;
+    filter.configure(dht22Temperature);
+    run(filter, syntheticDht22Spikes);
+
+    // Sensor unplugged for a while, the room has cooled down
+    SensorReading reading = { 1000 + TRACE_LENGTH * TRACE_INTERVAL + FILTER_RESET_GAP + 1, 0, true, 15.0f };
+    TEST_ASSERT_TRUE(filter.apply(reading));
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, reading.value);
+}
+
+void test_synthetic_smoothing_reduces_noise() {
+    ChannelFilter filter;
+    filter.configure(dht22Temperature);
+    Output out = run(filter, syntheticDht22Step);
+
+    // Sample-to-sample movement on the flat part before the step
+    float raw = 0;
+    float filtered = 0;
+    for (int i = 10; i < 30; i++) {
+        raw += fabsf(syntheticDht22Step[i] - syntheticDht22Step[i - 1]);
+        filtered += fabsf(out.values[i] - out.values[i - 1]);
+    }
+    TEST_ASSERT_TRUE(filtered < raw / 2);
+}
+
+void test_synthetic_default_is_pass_through() {
+    ChannelFilter filter;
+    Output out = run(filter, syntheticDht22Spikes);
+    TEST_ASSERT_EQUAL(0, out.dropped);
+    for (int i = 0; i < TRACE_LENGTH; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(syntheticDht22Spikes[i], out.values[i]);
+    }
+}
+
+void test_modelled_ds18b20_still_air() {
+    ChannelFilter filter;
+    filter.configure(ds18b20Temperature);
+    Output out = run(filter, ds18b20Still);
+
+    // Only the four 85 °C reads, the pair in a row included
+    TEST_ASSERT_EQUAL(4, out.dropped);
+    TEST_ASSERT_TRUE(isnan(out.values[37]));
+    TEST_ASSERT_TRUE(isnan(out.values[38]));
+    TEST_ASSERT_TRUE(maxError(out, ds18b20Still) < 0.08f);
+    TEST_ASSERT_TRUE(movement(out, 0, TRACE_POINTS) < movement(raw(ds18b20Still), 0, TRACE_POINTS) * 0.7f);
+}
+
+void test_modelled_ds18b20_plunge_is_followed() {
+    ChannelFilter filter;
+    filter.configure(ds18b20Temperature);
+    Output out = run(filter, ds18b20Plunge);
+
+    // The probe heats at up to 3.4 °C/s, no sample of it is taken for an outlier
+    TEST_ASSERT_EQUAL(2, out.dropped);
+    TEST_ASSERT_TRUE(isnan(out.values[58]));
+    TEST_ASSERT_TRUE(isnan(out.values[190]));
+    for (int i = 100; i < TRACE_POINTS; i++) {
+        TEST_ASSERT_TRUE(isnan(out.values[i]) || out.values[i] < 44.9f);
+    }
+    // The Kalman stage lags the rise by about a sample and is within 0.3 °C
+    // of the water 22 s after the plunge
+    TEST_ASSERT_TRUE(maxError(out, ds18b20Plunge, 0, 100) < 0.1f);
+    TEST_ASSERT_TRUE(maxError(out, ds18b20Plunge, 100, 111) < 2.6f);
+    TEST_ASSERT_TRUE(maxError(out, ds18b20Plunge, 111, TRACE_POINTS) < 0.3f);
+}
+
+void test_modelled_dht22_heater_bit_errors_removed() {
+    ChannelFilter filter;
+    filter.configure(dht22Temperature);
+    Output out = run(filter, dht22Heater);
+
+    // Bit errors above 1 °C per sample are dropped. 242 (+1.6) passes, the
+    // limit grows with the time since 240, and becomes the rate reference,
+    // so the good 243 is dropped in its place. The median removes 242 and
+    // the +0.8 at 133.
+    TEST_ASSERT_EQUAL(6, out.dropped);
+    TEST_ASSERT_TRUE(isnan(out.values[160]));
+    TEST_ASSERT_TRUE(isnan(out.values[243]));
+    TEST_ASSERT_TRUE(maxError(out, dht22Heater) < 0.35f);
+    TEST_ASSERT_TRUE(movement(out, 0, 120) < movement(raw(dht22Heater), 0, 120) / 3);
+}
+
+void test_modelled_dht22_shower_is_followed() {
+    ChannelFilter filter;
+    filter.configure(dht22Humidity);
+    Output out = run(filter, dht22Shower);
+
+    // Bit errors of 6.4 %RH and more are dropped, none of the rise or fall
+    TEST_ASSERT_EQUAL(4, out.dropped);
+    TEST_ASSERT_TRUE(isnan(out.values[44]));
+    TEST_ASSERT_TRUE(isnan(out.values[171]));
+    TEST_ASSERT_TRUE(maxError(out, dht22Shower, 0, 80) < 0.5f);
+    TEST_ASSERT_TRUE(maxError(out, dht22Shower) < 1.5f);
+    TEST_ASSERT_TRUE(movement(out, 0, 80) < movement(raw(dht22Shower), 0, 80) / 3);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_synthetic_ds18b20_power_on_value_rejected);
+    RUN_TEST(test_synthetic_dht22_bit_errors_never_reach_the_output);
+    RUN_TEST(test_synthetic_real_step_is_followed);
+    RUN_TEST(test_synthetic_timeouts_pass_through_and_keep_state);
+    RUN_TEST(test_synthetic_restarts_after_a_long_gap);
+    RUN_TEST(test_synthetic_smoothing_reduces_noise);
+    RUN_TEST(test_synthetic_default_is_pass_through);
+    RUN_TEST(test_modelled_ds18b20_still_air);
+    RUN_TEST(test_modelled_ds18b20_plunge_is_followed);
+    RUN_TEST(test_modelled_dht22_heater_bit_errors_removed);
+    RUN_TEST(test_modelled_dht22_shower_is_followed);
+    return UNITY_END();
+}
@@ -0,0 +1,181 @@
+// SensorHistory: a day of 2 s readings on every channel within the RAM
+// budget, and timestamps that survive gaps and the millis() wrap
+#include <unity.h>
+#include "history.h"
+
+static SensorHistory* history;
+
+void setUp() {
+    history = new SensorHistory();
+}
+
+void tearDown() {
+    delete history;
+}
+
+static void feed(uint8_t channel, uint32_t from, uint32_t count, uint32_t interval, float value) {
+    for (uint32_t i = 0; i < count; i++) {
+        SensorReading reading;
+        reading.timestamp = from + i * interval;
+        reading.channel = channel;
+        reading.valid = true;
+        reading.value = value;
+        history->append(reading);
+    }
+}
+
+// Returns the number of samples a full query yields, first and last time
+static uint32_t query(uint8_t channel, uint32_t since, uint32_t& first, uint32_t& last) {
+    HistoryCursor cursor;
+    uint32_t n = 0;
+    if (!history->beginQuery(channel, since, cursor)) {
+        return 0;
+    }
+    uint32_t timestamp;
+    float value;
+    while (history->next(cursor, timestamp, value)) {
+        if (n == 0) {
+            first = timestamp;
+        }
+        last = timestamp;
+        n++;
+    }
+    return n;
+}
+
+void test_a_day_fits_the_budget() {
+    TEST_ASSERT_LESS_OR_EQUAL(HISTORY_RAM_BUDGET, sizeof(HistorySample) * HISTORY_CAPACITY * CHANNEL_COUNT);
+
+    const uint32_t start = 5000;
+    const uint32_t readings = 24 * 3600 / 2;
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        feed(ch, start, readings, 2000, 20.0f + ch);
+    }
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint32_t n = query(0, start - 1, first, last);
+    TEST_ASSERT_LESS_OR_EQUAL(HISTORY_CAPACITY, history->getCount(0));
+    // Every stored window plus the open one
+    TEST_ASSERT_EQUAL(history->getCount(0) + 1, n);
+    // Everything back to the first window is still there
+    TEST_ASSERT_LESS_OR_EQUAL(start + HISTORY_STEP_MS, first);
+    // Up to the newest reading
+    TEST_ASSERT_EQUAL(start + (readings - 1) * 2000, last);
+}
+
+void test_windows_average_readings() {
+    SensorReading reading;
+    reading.channel = 1;
+    reading.valid = true;
+    for (uint32_t t = 0; t < HISTORY_STEP_MS + 2000; t += 2000) {
+        reading.timestamp = 1000 + t;
+        reading.value = (t / 2000) % 2 ? 21.0f : 19.0f;
+        history->append(reading);
+    }
+    HistoryCursor cursor;
+    TEST_ASSERT_TRUE(history->beginQuery(1, 0, cursor));
+    uint32_t timestamp;
+    float value;
+    TEST_ASSERT_TRUE(history->next(cursor, timestamp, value));
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 20.0, value);
+    // The open window holds the last reading alone
+    TEST_ASSERT_TRUE(history->next(cursor, timestamp, value));
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 21.0, value);
+    TEST_ASSERT_FALSE(history->next(cursor, timestamp, value));
+}
+
+void test_open_window_is_served_as_partial_average() {
+    feed(4, 1000, 1, 0, 18.0f);
+    feed(4, 3000, 1, 0, 20.0f);
+
+    HistoryCursor cursor;
+    TEST_ASSERT_TRUE(history->beginQuery(4, 0, cursor));
+    uint32_t timestamp;
+    float value;
+    TEST_ASSERT_TRUE(history->next(cursor, timestamp, value));
+    TEST_ASSERT_EQUAL(3000, timestamp);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 19.0, value);
+    TEST_ASSERT_FALSE(history->next(cursor, timestamp, value));
+
+    // Polling from there returns nothing new until another reading arrives
+    TEST_ASSERT_FALSE(history->beginQuery(4, 3000, cursor));
+
+    // Closing the window stores it at the time of its last reading, never
+    // earlier than the provisional sample a poller already has
+    feed(4, 1000 + HISTORY_STEP_MS, 1, 0, 30.0f);
+    uint32_t first = 0;
+    uint32_t last = 0;
+    TEST_ASSERT_EQUAL(2, query(4, 0, first, last));
+    TEST_ASSERT_EQUAL(3000, first);
+    TEST_ASSERT_EQUAL(1000 + HISTORY_STEP_MS, last);
+}
+
+void test_invalid_window_is_skipped() {
+    SensorReading reading;
+    reading.channel = 2;
+    reading.valid = false;
+    reading.value = 0;
+    reading.timestamp = 1000;
+    history->append(reading);
+    feed(2, 1000 + HISTORY_STEP_MS, 2, HISTORY_STEP_MS, 22.0f);
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    // The closed valid window and the open one
+    TEST_ASSERT_EQUAL(2, query(2, 0, first, last));
+    TEST_ASSERT_EQUAL(1000 + HISTORY_STEP_MS, first);
+    TEST_ASSERT_EQUAL(1000 + 2 * HISTORY_STEP_MS, last);
+}
+
+void test_long_gap_keeps_timestamps() {
+    // Three hours without readings, more than a 16 bit delta of ticks
+    const uint32_t gap = 3UL * 3600 * 1000;
+    feed(0, 1000, 3, HISTORY_STEP_MS, 20.0f);
+    feed(0, 1000 + 2 * HISTORY_STEP_MS + gap, 3, HISTORY_STEP_MS, 21.0f);
+
+    HistoryCursor cursor;
+    TEST_ASSERT_TRUE(history->beginQuery(0, 0, cursor));
+    uint32_t times[8];
+    float values[8];
+    uint32_t n = 0;
+    while (n < 8 && history->next(cursor, times[n], values[n])) {
+        n++;
+    }
+    // The last window is still open and served last
+    TEST_ASSERT_EQUAL(6, n);
+    TEST_ASSERT_EQUAL(1000, times[0]);
+    TEST_ASSERT_EQUAL(1000 + HISTORY_STEP_MS, times[1]);
+    TEST_ASSERT_EQUAL(1000 + 2 * HISTORY_STEP_MS, times[2]);
+    TEST_ASSERT_EQUAL(1000 + 2 * HISTORY_STEP_MS + gap, times[3]);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 21.0, values[3]);
+    TEST_ASSERT_EQUAL(1000 + 4 * HISTORY_STEP_MS + gap, times[5]);
+}
+
+void test_millis_wrap() {
+    // On the tick grid, the wrap falls between the fifth and sixth reading
+    const uint32_t start = (UINT32_MAX - 5 * HISTORY_STEP_MS + 1) / HISTORY_TICK_MS * HISTORY_TICK_MS;
+    feed(3, start, 11, HISTORY_STEP_MS, 18.5f);
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    // Ten complete windows, five before and five after the wrap, and the open one
+    TEST_ASSERT_EQUAL(11, query(3, start - 1, first, last));
+    TEST_ASSERT_EQUAL(start, first);
+    TEST_ASSERT_EQUAL(start + 10 * HISTORY_STEP_MS, last);
+
+    // 'since' past the wrap only returns the later part
+    TEST_ASSERT_EQUAL(5, query(3, start + 5 * HISTORY_STEP_MS, first, last));
+    TEST_ASSERT_EQUAL(start + 6 * HISTORY_STEP_MS, first);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_a_day_fits_the_budget);
+    RUN_TEST(test_windows_average_readings);
+    RUN_TEST(test_open_window_is_served_as_partial_average);
+    RUN_TEST(test_invalid_window_is_skipped);
+    RUN_TEST(test_long_gap_keeps_timestamps);
+    RUN_TEST(test_millis_wrap);
+    return UNITY_END();
+}
@@ -0,0 +1,197 @@
+// JsonWriter: string escapes, non-finite numbers, and responses split over
+// buffers of every size by replay and by resume
+#include <unity.h>
+#include <math.h>
+#include <string.h>
+#include <string>
+#include "json_writer.h"
+
+static char buffer[512];
+
+// One document with every token type, rendered the same way each call
+static void render(JsonWriter& json) {
+    json.beginObject();
+    json.field("name", "probe \"A\"\\1");
+    json.field("ok", true);
+    json.field("count", 42u);
+    json.field("offset", -7);
+    json.field("big", 4294967296ull);
+    json.field("temp", 21.5);
+    json.field("missing", (double)NAN);
+    json.key("empty");
+    json.beginArray();
+    json.endArray();
+    json.key("nested");
+    json.beginArray();
+    for (int i = 0; i < 3; i++) {
+        json.beginObject();
+        json.field("i", i);
+        json.key("tags");
+        json.beginArray();
+        json.value("a\tb");
+        json.valueNull();
+        json.endArray();
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+}
+
+static std::string renderWhole() {
+    JsonWriter json(buffer, sizeof(buffer));
+    render(json);
+    TEST_ASSERT_FALSE(json.isFull());
+    return std::string(buffer, json.getLength());
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_strings_are_escaped() {
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginArray();
+    json.value("quote\" backslash\\ newline\n return\r tab\t");
+    json.value("\x01\x1f");
+    json.value("caf\xc3\xa9");
+    json.endArray();
+    TEST_ASSERT_EQUAL_STRING(
+        "[\"quote\\\" backslash\\\\ newline\\n return\\r tab\\t\",\"\\u0001\\u001f\",\"caf\xc3\xa9\"]",
+        buffer);
+}
+
+void test_keys_are_escaped() {
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("a\"b", 1);
+    json.endObject();
+    TEST_ASSERT_EQUAL_STRING("{\"a\\\"b\":1}", buffer);
+}
+
+void test_non_finite_numbers_are_null() {
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginArray();
+    json.value((double)NAN);
+    json.value((double)INFINITY);
+    json.value(-(double)INFINITY);
+    json.value(21.5);
+    json.value(-0.125);
+    json.endArray();
+    TEST_ASSERT_EQUAL_STRING("[null,null,null,21.50,-0.12]", buffer);
+}
+
+void test_commas_between_items_only() {
+    std::string whole = renderWhole();
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"name\":\"probe \\\"A\\\"\\\\1\",\"ok\":true,\"count\":42,\"offset\":-7,\"big\":4294967296,"
+        "\"temp\":21.50,\"missing\":null,\"empty\":[],\"nested\":["
+        "{\"i\":0,\"tags\":[\"a\\tb\",null]},{\"i\":1,\"tags\":[\"a\\tb\",null]},{\"i\":2,\"tags\":[\"a\\tb\",null]}]}",
+        whole.c_str());
+}
+
+void test_token_that_does_not_fit_is_dropped_whole() {
+    char small[12];
+    JsonWriter json(small, sizeof(small));
+    json.beginArray();
+    json.value("\x01\x02");     // 14 bytes escaped, fits only in part
+    json.value(1);
+    TEST_ASSERT_TRUE(json.isFull());
+    TEST_ASSERT_EQUAL_STRING("[", small);
+    TEST_ASSERT_EQUAL_UINT32(1, json.getTokens());
+}
+
+// Like sendReplayed(): every buffer runs render() again, skipping the tokens sent
+void test_replay_splits_at_token_boundaries_for_every_buffer_size() {
+    std::string whole = renderWhole();
+    // The longest token is "name" with its escaped value, plus a comma
+    for (size_t size = 32; size <= whole.size() + 1; size++) {
+        std::string joined;
+        uint32_t sent = 0;
+        bool done = false;
+        int chunks = 0;
+        while (!done) {
+            char chunk[512];
+            JsonWriter json(chunk, size, sent);
+            render(json);
+            TEST_ASSERT_TRUE_MESSAGE(json.getLength() > 0, "token larger than the buffer");
+            // The chunk ends where a token ends
+            joined.append(chunk, json.getLength());
+            TEST_ASSERT_TRUE(whole.compare(0, joined.size(), joined) == 0);
+            sent = json.getTokens();
+            done = !json.isFull();
+            chunks++;
+            TEST_ASSERT_TRUE(chunks < 1000);
+        }
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(whole.c_str(), joined.c_str(), std::to_string(size).c_str());
+    }
+}
+
+void test_replay_reports_a_buffer_too_small_for_the_next_token() {
+    char small[7];
+    JsonWriter json(small, sizeof(small), 1);   // '{' already sent, '"name":' is next
+    render(json);
+    TEST_ASSERT_TRUE(json.isFull());
+    TEST_ASSERT_EQUAL_UINT32(0, json.getLength());
+}
+
+// Like /api/history: the nesting is carried between buffers and a record is
+// only started when getRemaining() has room for it
+void test_resume_splits_at_record_boundaries_for_every_buffer_size() {
+    const int RECORDS = 40;
+    const size_t RECORD_MAX = 32;
+    std::string whole;
+    {
+        JsonWriter json(buffer, sizeof(buffer));
+        json.beginArray();
+        for (int i = 0; i < RECORDS; i++) {
+            json.beginArray();
+            json.value(i * 1000);
+            json.value(i / 4.0);
+            json.endArray();
+        }
+        json.endArray();
+        whole.assign(buffer, json.getLength());
+    }
+
+    for (size_t size = RECORD_MAX + 2; size <= 200; size++) {
+        std::string joined;
+        JsonWriter::Nesting nesting = {0, 0, false};
+        int next = -1;          // -1: opening bracket not written yet
+        bool done = false;
+        while (!done) {
+            char chunk[256];
+            JsonWriter json(chunk, size, nesting);
+            if (next < 0) {
+                json.beginArray();
+                next = 0;
+            }
+            while (next < RECORDS && json.getRemaining() >= RECORD_MAX) {
+                json.beginArray();
+                json.value(next * 1000);
+                json.value(next / 4.0);
+                json.endArray();
+                next++;
+            }
+            if (next == RECORDS && json.getRemaining() >= 1) {
+                json.endArray();
+                done = true;
+            }
+            TEST_ASSERT_FALSE(json.isFull());
+            nesting = json.getNesting();
+            joined.append(chunk, json.getLength());
+        }
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(whole.c_str(), joined.c_str(), std::to_string(size).c_str());
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_strings_are_escaped);
+    RUN_TEST(test_keys_are_escaped);
+    RUN_TEST(test_non_finite_numbers_are_null);
+    RUN_TEST(test_commas_between_items_only);
+    RUN_TEST(test_token_that_does_not_fit_is_dropped_whole);
+    RUN_TEST(test_replay_splits_at_token_boundaries_for_every_buffer_size);
+    RUN_TEST(test_replay_reports_a_buffer_too_small_for_the_next_token);
+    RUN_TEST(test_resume_splits_at_record_boundaries_for_every_buffer_size);
+    return UNITY_END();
+}
@@ -0,0 +1,254 @@
+// Battery mode across simulated deep sleep: every wake samples into the
+// RTC batch and sleeps, every LOW_POWER_PUBLISH_EVERY wakes the batch goes
+// out in one QoS 1 message and is only emptied once the broker has it. The
+// publish wake syncs SNTP, which moves the batch from power-on to epoch time.
+// A wake is a fresh SensorSet and LowPowerMode with the clock back at boot,
+// only RTC_DATA_ATTR state carries over.
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <Preferences.h>
+#include <esp_sleep.h>
+#include <esp_system.h>
+#include <lwip/dns.h>
+#include <string>
+#include <vector>
+#include "low_power.h"
+#include "wifi_manager.h"
+
+struct Wake {
+    uint32_t awakeMs;
+    uint64_t sleepUs;
+};
+
+static Wake wake() {
+    fake::resetClock(0);
+    SensorSet* sensors = new SensorSet();
+    sensors->begin();
+    LowPowerMode* mode = new LowPowerMode(sensors);
+    Wake result = { 0, 0 };
+    bool slept = false;
+    try {
+        mode->run();
+    } catch (const fake::DeepSleep& sleep) {
+        result.awakeMs = millis();
+        result.sleepUs = sleep.wakeupUs;
+        slept = true;
+    }
+    delete mode;
+    delete sensors;
+    TEST_ASSERT_TRUE_MESSAGE(slept, "run() returned instead of entering deep sleep");
+    return result;
+}
+
+static size_t count(const std::string& text, const char* needle) {
+    size_t n = 0;
+    for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) {
+        n++;
+    }
+    return n;
+}
+
+// Payloads published to <base>/batch, oldest first
+static std::vector<std::string> batches() {
+    std::vector<std::string> payloads;
+    for (const fake::MqttMessage& message : fake::broker.messages) {
+        const std::string& topic = message.topic;
+        if (topic.size() > 6 && topic.compare(topic.size() - 6, 6, "/batch") == 0) {
+            TEST_ASSERT_EQUAL(MQTT_QOS, message.qos);
+            payloads.push_back(std::string(message.payload.begin(), message.payload.end()));
+        }
+    }
+    return payloads;
+}
+
+// Header field of a batch message, e.g. "wake"
+static unsigned long header(const std::string& payload, const char* key) {
+    std::string pattern = "\"" + std::string(key) + "\":";
+    size_t at = payload.find(pattern);
+    TEST_ASSERT_TRUE(at != std::string::npos);
+    return strtoul(payload.c_str() + at + pattern.size(), nullptr, 10);
+}
+
+// "t" of every record, oldest first
+static std::vector<unsigned long> recordTimes(const std::string& payload) {
+    std::vector<unsigned long> times;
+    for (size_t at = payload.find("{\"t\":"); at != std::string::npos; at = payload.find("{\"t\":", at + 1)) {
+        times.push_back(strtoul(payload.c_str() + at + 5, nullptr, 10));
+    }
+    return times;
+}
+
+static void setCredentials(bool present) {
+    WiFiManager wifi;
+    if (present) {
+        wifi.saveCredentials("sensors", "secret");
+    } else {
+        wifi.clearCredentials();
+    }
+}
+
+void setUp() {
+    fake::broker.reset();
+    fake::dnsRecords.clear();
+    fake::dnsRecords[MQTT_SERVER] = 0x0200000A;
+    fake::deepSleeps = 0;
+    fake::sntpReachable = false;
+    fake::sntpAheadUs = 0;
+    setCredentials(true);
+}
+
+void tearDown() {}
+
+void test_batch_published_every_n_wakes() {
+    // Power-on: the RTC batch starts empty
+    for (uint16_t w = 1; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        Wake cycle = wake();
+        // Sensors only, the radio stays off and the wake period is kept
+        TEST_ASSERT_EQUAL(0, fake::broker.connects);
+        TEST_ASSERT_EQUAL_UINT64((uint64_t)LOW_POWER_WAKE_INTERVAL * 1000, cycle.sleepUs + (uint64_t)cycle.awakeMs * 1000);
+    }
+    Wake publishing = wake();
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, fake::deepSleeps);
+    TEST_ASSERT_EQUAL(1, fake::broker.connects);
+    TEST_ASSERT_EQUAL(1, batches().size());
+    TEST_ASSERT_EQUAL(0, fake::dnsUnsafeCalls);
+    std::string payload = batches()[0];
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, header(payload, "wake"));
+    TEST_ASSERT_EQUAL(fake::randomValue, header(payload, "boot"));
+    TEST_ASSERT_EQUAL(0, header(payload, "seq"));
+    TEST_ASSERT_EQUAL(0, header(payload, "dropped"));
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, count(payload, "{\"t\":"));
+    TEST_ASSERT_EQUAL('}', payload.back());
+    TEST_ASSERT_TRUE(publishing.sleepUs >= 1000000);
+    // No SNTP answer: times count from power-on, "now" on the same clock places them
+    TEST_ASSERT_TRUE(payload.find("\"synced\":false") != std::string::npos);
+    std::vector<unsigned long> times = recordTimes(payload);
+    unsigned long span = header(payload, "now") - times.front();
+    TEST_ASSERT_TRUE(span >= (LOW_POWER_PUBLISH_EVERY - 1) * LOW_POWER_WAKE_INTERVAL / 1000);
+    TEST_ASSERT_TRUE(span <= (LOW_POWER_PUBLISH_EVERY - 1) * LOW_POWER_WAKE_INTERVAL / 1000 + 5);
+    TEST_ASSERT_TRUE(header(payload, "now") < 86400);
+
+    // The next batch starts empty
+    fake::broker.reset();
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(1, batches().size());
+    payload = batches().at(0);
+    TEST_ASSERT_EQUAL(2 * LOW_POWER_PUBLISH_EVERY, header(payload, "wake"));
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, header(payload, "seq"));
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, count(payload, "{\"t\":"));
+}
+
+void test_unreachable_broker_keeps_the_batch() {
+    fake::broker.reachable = false;
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(0, batches().size());
+
+    // A failed attempt also waits N wakes before the next one
+    fake::broker.reachable = true;
+    for (uint16_t w = 1; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(0, fake::broker.connects);
+    wake();
+    TEST_ASSERT_EQUAL(1, batches().size());
+    TEST_ASSERT_EQUAL(2 * LOW_POWER_PUBLISH_EVERY, count(batches().at(0), "{\"t\":"));
+}
+
+void test_unacknowledged_batch_goes_out_again() {
+    // The broker takes the message but the PUBACK never arrives
+    fake::broker.autoPuback = false;
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(1, batches().size());
+    std::string first = batches().at(0);
+
+    fake::broker.autoPuback = true;
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(2, batches().size());
+    std::string second = batches().at(1);
+    // Same records first, then the ones of the wakes since
+    TEST_ASSERT_EQUAL(2 * LOW_POWER_PUBLISH_EVERY, count(second, "{\"t\":"));
+    std::string firstRecords = first.substr(first.find("\"records\":[") + 11);
+    firstRecords = firstRecords.substr(0, firstRecords.size() - 2);
+    TEST_ASSERT_TRUE(second.find(firstRecords) != std::string::npos);
+    // Numbered as before, so a subscriber that got the first copy skips them
+    TEST_ASSERT_EQUAL(header(first, "boot"), header(second, "boot"));
+    TEST_ASSERT_EQUAL(header(first, "seq"), header(second, "seq"));
+
+    // Acknowledged now, the next batch starts empty
+    fake::broker.reset();
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, count(batches().at(0), "{\"t\":"));
+}
+
+void test_full_batch_drops_oldest() {
+    // No credentials: nothing can go out, the batch fills and then keeps the newest
+    setCredentials(false);
+    for (uint16_t w = 0; w < LOW_POWER_BATCH_MAX + 10; w++) {
+        Wake cycle = wake();
+        TEST_ASSERT_TRUE(cycle.sleepUs >= 1000000);
+    }
+    TEST_ASSERT_EQUAL(0, fake::broker.connects);
+
+    // Full, so publishing is due on the very next wake
+    setCredentials(true);
+    wake();
+    TEST_ASSERT_EQUAL(1, batches().size());
+    std::string payload = batches().at(0);
+    TEST_ASSERT_EQUAL(LOW_POWER_BATCH_MAX, count(payload, "{\"t\":"));
+    TEST_ASSERT_EQUAL(11, header(payload, "dropped"));
+    // The batch message is larger than the payload buffer, it was streamed
+    TEST_ASSERT_GREATER_THAN(MQTT_PAYLOAD_MAX, payload.size());
+}
+
+void test_sntp_moves_the_batch_to_epoch_time() {
+    // By the SNTP servers the next wake starts at EPOCH, the RTC still counts from power-on
+    const unsigned long EPOCH = 1767225600;
+    fake::sntpReachable = true;
+    fake::sntpAheadUs = (int64_t)EPOCH * 1000000 - fake::systemTimeBaseUs;
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    TEST_ASSERT_EQUAL(1, batches().size());
+    std::string payload = batches().at(0);
+    TEST_ASSERT_TRUE(payload.find("\"synced\":true") != std::string::npos);
+
+    // Records sampled before the sync were moved by its step, a wake apart
+    std::vector<unsigned long> times = recordTimes(payload);
+    TEST_ASSERT_EQUAL(LOW_POWER_PUBLISH_EVERY, times.size());
+    TEST_ASSERT_EQUAL(EPOCH, times.front());
+    for (size_t i = 1; i < times.size(); i++) {
+        TEST_ASSERT_UINT32_WITHIN(1, LOW_POWER_WAKE_INTERVAL / 1000, times[i] - times[i - 1]);
+    }
+    unsigned long now = header(payload, "now");
+    TEST_ASSERT_TRUE(now >= times.back() && now - times.back() <= 4);
+
+    // The RTC keeps epoch time through deep sleep, the next batch is stamped with it
+    fake::broker.reset();
+    for (uint16_t w = 0; w < LOW_POWER_PUBLISH_EVERY; w++) {
+        wake();
+    }
+    payload = batches().at(0);
+    TEST_ASSERT_TRUE(payload.find("\"synced\":true") != std::string::npos);
+    TEST_ASSERT_EQUAL(EPOCH + LOW_POWER_PUBLISH_EVERY * LOW_POWER_WAKE_INTERVAL / 1000, recordTimes(payload).front());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_published_every_n_wakes);
+    RUN_TEST(test_unreachable_broker_keeps_the_batch);
+    RUN_TEST(test_unacknowledged_batch_goes_out_again);
+    RUN_TEST(test_full_batch_drops_oldest);
+    RUN_TEST(test_sntp_moves_the_batch_to_epoch_time);
+    return UNITY_END();
+}
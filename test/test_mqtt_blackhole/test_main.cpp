@@ -0,0 +1,260 @@
+// loop() latency with a broker that stops answering, and nothing lost or
+// skipped while it does: streamed writes, log replay and rollups.
+// Prints the loop() timings, run with -v to see them.
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <Preferences.h>
+#include <esp_partition.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "metrics.h"
+#include "mqtt.h"
+
+static const char* IMAGE = "test_blackhole_log.bin";
+static const uint32_t LOOP_MS = 10;
+
+static SensorSet* sensors;
+static SampleClock* sampleClock;
+static SampleLog* sampleLog;
+static RollupStore* rollupStore;
+static MQTTManager* manager;
+
+struct LoopStats {
+    uint32_t loops;
+    uint64_t maxWallUs;     // host CPU time of one loop()
+    uint64_t blockedUs;     // simulated time spent in delay() inside loop()
+    uint32_t published;
+};
+
+void setUp() {
+    remove(IMAGE);
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    fake::nvs.clear();
+    fake::openPartition(LOG_PARTITION_LABEL, LOG_PARTITION_SUBTYPE, 16 * LOG_SEGMENT_SIZE, IMAGE);
+    sensors = new SensorSet();
+    sensors->begin();
+    sampleClock = new SampleClock();
+    sampleLog = new SampleLog();
+    sampleLog->begin(sampleClock);
+    rollupStore = new RollupStore();
+    manager = new MQTTManager("10.0.0.2", 1883, "", "");
+    manager->begin(sensors, nullptr, sampleClock, sampleLog, rollupStore);
+}
+
+void tearDown() {
+    delete manager;
+    delete rollupStore;
+    delete sampleLog;
+    delete sampleClock;
+    delete sensors;
+    fake::closePartitions();
+    remove(IMAGE);
+}
+
+// The firmware's loop() for 'ms' of simulated time: sample every 2 s, run
+// the MQTT state machine, publish when connected
+static LoopStats run(uint32_t ms) {
+    LoopStats stats = { 0, 0, 0, 0 };
+    TemperatureSensor& dht = *sensors->find<TemperatureSensor>();
+    uint32_t publishes = Metrics::get(METRIC_MQTT_PUBLISHES);
+    for (uint32_t t = 0; t < ms; t += LOOP_MS) {
+        if (t % TEMP_READ_INTERVAL == 0) {
+            dht.startSample();
+            dht.pollSample();
+            for (uint8_t f = 0; f < TemperatureSensor::FIELDS; f++) {
+                SensorReading reading = { (uint32_t)millis(), f, true, dht.getValue(0, f) };
+                sampleLog->append(reading);
+                rollupStore->add(reading, sampleLog->now());
+                manager->queueReading(reading);
+            }
+        }
+
+        uint64_t delayed = fake::delayedUs;
+        auto start = std::chrono::steady_clock::now();
+        manager->loop();
+        if (t % MQTT_PUBLISH_INTERVAL == 0 && manager->isConnected()) {
+            manager->publishAllSensorData();
+        }
+        uint64_t wall = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        stats.blockedUs += fake::delayedUs - delayed;
+        if (wall > stats.maxWallUs) {
+            stats.maxWallUs = wall;
+        }
+        stats.loops++;
+
+        fake::advanceMs(LOOP_MS);
+        fake::runTasks();
+    }
+    stats.published = Metrics::get(METRIC_MQTT_PUBLISHES) - publishes;
+    return stats;
+}
+
+static void report(const char* phase, const LoopStats& stats) {
+    char line[160];
+    snprintf(line, sizeof(line), "%-22s %6lu loops, max loop() %5llu us, blocked %llu us, %lu connects, %lu published",
+             phase, (unsigned long)stats.loops, (unsigned long long)stats.maxWallUs,
+             (unsigned long long)stats.blockedUs, (unsigned long)fake::broker.connects, (unsigned long)stats.published);
+    TEST_MESSAGE(line);
+}
+
+static std::vector<std::string> payloads(const char* suffix) {
+    std::vector<std::string> values;
+    std::string tail = suffix;
+    for (const fake::MqttMessage& message : fake::broker.messages) {
+        const std::string& topic = message.topic;
+        if (topic.size() >= tail.size() && topic.compare(topic.size() - tail.size(), tail.size(), tail) == 0) {
+            values.push_back(std::string(message.payload.begin(), message.payload.end()));
+        }
+    }
+    return values;
+}
+
+void test_black_hole_broker_does_not_stall_loop() {
+    // SYN answered, nothing after it: every attempt ends in the CONNACK timeout
+    fake::broker.blackHole = true;
+    LoopStats stats = run(120000);
+    report("black hole", stats);
+
+    TEST_ASSERT_EQUAL(0, stats.blockedUs);
+    TEST_ASSERT_LESS_THAN(5000, stats.maxWallUs);
+    TEST_ASSERT_GREATER_OR_EQUAL(3, fake::broker.connects);
+    TEST_ASSERT_FALSE(manager->isConnected());
+    TEST_ASSERT_EQUAL(MqttClient::ERROR_TIMEOUT, manager->getClient().getError());
+}
+
+void test_unreachable_broker_does_not_stall_loop() {
+    fake::broker.reachable = false;
+    LoopStats stats = run(120000);
+    report("unreachable", stats);
+
+    TEST_ASSERT_EQUAL(0, stats.blockedUs);
+    TEST_ASSERT_LESS_THAN(5000, stats.maxWallUs);
+    TEST_ASSERT_GREATER_OR_EQUAL(3, manager->getConnectAttempts());
+}
+
+void test_broker_silent_after_connect() {
+    LoopStats healthy = run(30000);
+    report("healthy", healthy);
+    TEST_ASSERT_TRUE(manager->isConnected());
+    TEST_ASSERT_GREATER_THAN(0, healthy.published);
+    TEST_ASSERT_EQUAL(0, healthy.blockedUs);
+
+    // Connection stays up but the broker stops acknowledging anything
+    fake::broker.blackHole = true;
+    LoopStats silent = run(60000);
+    report("silent after connect", silent);
+    TEST_ASSERT_EQUAL(0, silent.blockedUs);
+    TEST_ASSERT_LESS_THAN(5000, silent.maxWallUs);
+    // Keepalive or the PUBACK timeout ends the half-dead session
+    TEST_ASSERT_FALSE(manager->isConnected());
+    TEST_ASSERT_GREATER_THAN(1, manager->getSessions() + manager->getConnectAttempts());
+}
+
+void test_streamed_publish_larger_than_send_buffer() {
+    MqttClient client;
+    client.setServer("10.0.0.2", 1883);
+    TEST_ASSERT_TRUE(client.connect("stream", "", ""));
+    while (client.getState() != MqttClient::STATE_CONNECTED) {
+        fake::runTasks();
+        client.loop();
+    }
+
+    std::vector<uint8_t> data(3 * fake::broker.sendBuffer);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = (uint8_t)i;
+    }
+    TEST_ASSERT_TRUE(client.beginPublish("big", data.size(), false, 0));
+    uint64_t delayed = fake::delayedUs;
+    TEST_ASSERT_EQUAL(data.size(), client.write(data.data(), data.size()));
+    TEST_ASSERT_TRUE(client.endPublish());
+    // Waited for ACKs, not into the timeout
+    TEST_ASSERT_LESS_THAN(MQTT_CONNECT_TIMEOUT * 1000ULL / 10, fake::delayedUs - delayed);
+    TEST_ASSERT_TRUE(client.flush(1000));
+
+    TEST_ASSERT_EQUAL(1, fake::broker.messages.size());
+    TEST_ASSERT_TRUE(fake::broker.messages[0].payload == data);
+}
+
+void test_streamed_publish_into_black_hole_gives_up() {
+    MqttClient client;
+    client.setServer("10.0.0.2", 1883);
+    client.setConnectTimeout(MQTT_CONNECT_TIMEOUT);
+    TEST_ASSERT_TRUE(client.connect("stream", "", ""));
+    while (client.getState() != MqttClient::STATE_CONNECTED) {
+        fake::runTasks();
+        client.loop();
+    }
+
+    fake::broker.blackHole = true;
+    std::vector<uint8_t> data(3 * fake::broker.sendBuffer);
+    TEST_ASSERT_TRUE(client.beginPublish("big", data.size(), false, 0));
+    uint64_t delayed = fake::delayedUs;
+    size_t written = client.write(data.data(), data.size());
+    TEST_ASSERT_LESS_THAN(data.size(), written);
+    uint64_t waited = fake::delayedUs - delayed;
+    TEST_ASSERT_LESS_OR_EQUAL(MQTT_CONNECT_TIMEOUT * 1000ULL + 2000, waited);
+    TEST_ASSERT_GREATER_OR_EQUAL(MQTT_CONNECT_TIMEOUT * 1000ULL, waited);
+    TEST_ASSERT_FALSE(client.endPublish());
+}
+
+void test_replay_resumes_where_the_broker_stalled() {
+    run(60000);
+    TEST_ASSERT_TRUE(manager->isConnected());
+    sampleLog->flush();
+    fake::broker.messages.clear();
+
+    uint32_t last = sampleLog->getTimestamp();
+    TEST_ASSERT_TRUE(sampleLog->startReplay(0, last));
+    size_t full = fake::broker.sendBuffer;
+    fake::broker.sendBuffer = 0; // nothing fits for a while
+    run(200);
+    TEST_ASSERT_EQUAL(0, payloads("/log/replay").size());
+    fake::broker.sendBuffer = full;
+    while (sampleLog->isReplayActive()) {
+        run(LOOP_MS);
+    }
+
+    // Every record once, in order, up to the last one logged before the stall
+    std::vector<std::string> replayed = payloads("/log/replay");
+    TEST_ASSERT_EQUAL(60000 / TEMP_READ_INTERVAL, replayed.size());
+    unsigned long previous = 0;
+    for (size_t i = 0; i < replayed.size(); i++) {
+        unsigned long t = strtoul(replayed[i].c_str() + 5, nullptr, 10);
+        if (i > 0) {
+            TEST_ASSERT_EQUAL(previous + TEMP_READ_INTERVAL / 1000, t);
+        }
+        previous = t;
+    }
+    TEST_ASSERT_EQUAL(last, previous);
+}
+
+void test_rollup_kept_until_published() {
+    run(61000 - fake::nowUs / 1000 % 60000);
+    TEST_ASSERT_TRUE(manager->isConnected());
+    fake::broker.messages.clear();
+
+    // The minute closes while nothing fits the send buffer
+    size_t full = fake::broker.sendBuffer;
+    fake::broker.sendBuffer = 0;
+    run(60000);
+    TEST_ASSERT_EQUAL(0, payloads("/rollup/minute").size());
+    fake::broker.sendBuffer = full;
+    run(1000);
+    TEST_ASSERT_EQUAL(1, payloads("/rollup/minute").size());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_black_hole_broker_does_not_stall_loop);
+    RUN_TEST(test_unreachable_broker_does_not_stall_loop);
+    RUN_TEST(test_broker_silent_after_connect);
+    RUN_TEST(test_streamed_publish_larger_than_send_buffer);
+    RUN_TEST(test_streamed_publish_into_black_hole_gives_up);
+    RUN_TEST(test_replay_resumes_where_the_broker_stalled);
+    RUN_TEST(test_rollup_kept_until_published);
+    return UNITY_END();
+}
@@ -0,0 +1,123 @@
+// Broker name lookups: started on the tcpip thread, cached for the TTL,
+// and the last good address used when DNS fails.
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <lwip/dns.h>
+#include "mqtt_client.h"
+
+static const char* BROKER = "broker.example";
+static const uint32_t ADDRESS = 0x0200000A;     // 10.0.0.2
+static const uint32_t MOVED = 0x0300000A;       // 10.0.0.3
+
+static MqttClient* client;
+
+void setUp() {
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    fake::tcpipJobs.clear();
+    fake::dnsRecords.clear();
+    fake::dnsRecords[BROKER] = ADDRESS;
+    fake::dnsQueries = 0;
+    fake::dnsUnsafeCalls = 0;
+    client = new MqttClient();
+    client->setServer(BROKER, 1883);
+}
+
+void tearDown() {
+    delete client;
+}
+
+// loop() and the other tasks until the attempt settles, plus one loop()
+// once connected, which records the address as known good
+static void settle() {
+    for (int i = 0; i < 20; i++) {
+        client->loop();
+        fake::runTasks();
+        fake::advanceMs(10);
+        MqttClient::State state = client->getState();
+        if (state == MqttClient::STATE_CONNECTED) {
+            client->loop();
+            return;
+        }
+        if (state == MqttClient::STATE_DISCONNECTED) {
+            return;
+        }
+    }
+}
+
+static void reconnect() {
+    client->disconnect();
+    fake::runTasks();
+    TEST_ASSERT_TRUE(client->connect("dns-test", "", ""));
+    settle();
+}
+
+void test_lookup_runs_on_the_tcpip_thread() {
+    TEST_ASSERT_TRUE(client->connect("dns-test", "", ""));
+    TEST_ASSERT_EQUAL(MqttClient::STATE_RESOLVING, client->getState());
+    // Nothing touches the DNS client until the tcpip thread runs the job
+    TEST_ASSERT_EQUAL(0, fake::dnsQueries);
+    TEST_ASSERT_EQUAL(1, fake::tcpipJobs.size());
+
+    settle();
+    TEST_ASSERT_EQUAL(MqttClient::STATE_CONNECTED, client->getState());
+    TEST_ASSERT_EQUAL(1, fake::dnsQueries);
+    TEST_ASSERT_EQUAL(0, fake::dnsUnsafeCalls);
+    TEST_ASSERT_EQUAL_UINT32(ADDRESS, fake::broker.lastAddress);
+    TEST_ASSERT_EQUAL(1, client->getDnsLookups());
+}
+
+void test_cached_address_skips_the_lookup() {
+    client->setDnsTtl(60000);
+    TEST_ASSERT_TRUE(client->connect("dns-test", "", ""));
+    settle();
+
+    fake::advanceMs(30000);
+    reconnect();
+    TEST_ASSERT_EQUAL(MqttClient::STATE_CONNECTED, client->getState());
+    TEST_ASSERT_EQUAL(1, fake::dnsQueries);
+    TEST_ASSERT_EQUAL(1, client->getDnsCacheHits());
+
+    // Past the TTL the name is looked up again and the new address used
+    fake::dnsRecords[BROKER] = MOVED;
+    fake::advanceMs(31000);
+    reconnect();
+    TEST_ASSERT_EQUAL(MqttClient::STATE_CONNECTED, client->getState());
+    TEST_ASSERT_EQUAL(2, fake::dnsQueries);
+    TEST_ASSERT_EQUAL_UINT32(MOVED, fake::broker.lastAddress);
+    TEST_ASSERT_EQUAL(0, fake::dnsUnsafeCalls);
+}
+
+void test_failed_lookup_falls_back_to_last_good_address() {
+    client->setDnsTtl(0);
+    TEST_ASSERT_TRUE(client->connect("dns-test", "", ""));
+    settle();
+    TEST_ASSERT_EQUAL_UINT32(ADDRESS, client->getFallbackAddress());
+
+    fake::dnsRecords.clear();
+    reconnect();
+    TEST_ASSERT_EQUAL(MqttClient::STATE_CONNECTED, client->getState());
+    TEST_ASSERT_EQUAL(1, client->getDnsFailures());
+    TEST_ASSERT_EQUAL(1, client->getDnsFallbacks());
+    TEST_ASSERT_EQUAL_UINT32(ADDRESS, fake::broker.lastAddress);
+}
+
+void test_failed_lookup_without_fallback() {
+    fake::dnsRecords.clear();
+    TEST_ASSERT_TRUE(client->connect("dns-test", "", ""));
+    settle();
+    TEST_ASSERT_EQUAL(MqttClient::STATE_DISCONNECTED, client->getState());
+    TEST_ASSERT_EQUAL(MqttClient::ERROR_DNS, client->getError());
+    TEST_ASSERT_EQUAL(0, fake::broker.connects);
+    TEST_ASSERT_EQUAL(0, fake::dnsUnsafeCalls);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_lookup_runs_on_the_tcpip_thread);
+    RUN_TEST(test_cached_address_skips_the_lookup);
+    RUN_TEST(test_failed_lookup_falls_back_to_last_good_address);
+    RUN_TEST(test_failed_lookup_without_fallback);
+    return UNITY_END();
+}
@@ -0,0 +1,296 @@
+// One TCP segment per publish, and the QoS 1 in-flight window: backpressure when full, PUBACKs out of order,
+// retransmission after a reconnect with and without the broker's session,
+// and the PUBACK timeout. Ends with the window 1 / window 8 throughput
+// benchmark on a simulated link, run with -v to see it.
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <stdio.h>
+#include <string>
+#include "mqtt_client.h"
+
+static const char* TOPIC = "ppiot/test/samples";
+static MqttClient* client;
+
+void setUp() {
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    client = new MqttClient();
+    client->setServer("10.0.0.2", 1883);
+    client->setCleanSession(false);
+    client->setKeepAlive(0);
+}
+
+void tearDown() {
+    delete client;
+}
+
+static void pump(uint32_t ms = 1) {
+    for (uint32_t i = 0; i < ms; i++) {
+        fake::runTasks();
+        client->loop();
+        fake::advanceMs(1);
+    }
+}
+
+static void connect() {
+    TEST_ASSERT_TRUE(client->connect("qos-test", "", ""));
+    for (int i = 0; i < 1000 && !client->connected(); i++) {
+        pump();
+    }
+    TEST_ASSERT_TRUE(client->connected());
+}
+
+static bool publish(uint32_t n) {
+    char payload[32];
+    snprintf(payload, sizeof(payload), "{\"n\":%lu}", (unsigned long)n);
+    return client->publish(TOPIC, (const uint8_t*)payload, strlen(payload), false, 1);
+}
+
+static std::string payloadOf(const fake::MqttMessage& message) {
+    return std::string(message.payload.begin(), message.payload.end());
+}
+
+void test_each_publish_is_one_segment() {
+    connect();
+    uint32_t before = fake::broker.segments;
+    TEST_ASSERT_TRUE(client->publish("ppiot/test/dht22/temperature", "21.50"));
+    TEST_ASSERT_TRUE(publish(1));
+    TEST_ASSERT_EQUAL(before + 2, fake::broker.segments);
+    pump(2);
+    TEST_ASSERT_EQUAL(2, fake::broker.messages.size());
+    TEST_ASSERT_EQUAL_STRING("21.50", payloadOf(fake::broker.messages[0]).c_str());
+    TEST_ASSERT_EQUAL(0, fake::broker.messages[0].qos);
+}
+
+void test_full_window_pushes_back() {
+    connect();
+    fake::broker.autoPuback = false;
+    for (uint32_t n = 0; n < MQTT_INFLIGHT_MAX; n++) {
+        TEST_ASSERT_TRUE(publish(n));
+    }
+    // Window full: refused, nothing written, the caller keeps the message
+    TEST_ASSERT_FALSE(publish(99));
+    pump(5);
+    TEST_ASSERT_EQUAL(MQTT_INFLIGHT_MAX, fake::broker.messages.size());
+    TEST_ASSERT_EQUAL(MQTT_INFLIGHT_MAX, client->getInflight());
+
+    // One PUBACK frees one slot
+    fake::broker.puback(fake::broker.messages[0].packetId);
+    pump(2);
+    TEST_ASSERT_EQUAL(MQTT_INFLIGHT_MAX - 1, client->getInflight());
+    TEST_ASSERT_TRUE(publish(MQTT_INFLIGHT_MAX));
+    TEST_ASSERT_FALSE(publish(99));
+}
+
+void test_out_of_order_pubacks() {
+    connect();
+    fake::broker.autoPuback = false;
+    for (uint32_t n = 0; n < 4; n++) {
+        TEST_ASSERT_TRUE(publish(n));
+    }
+    pump(2);
+    TEST_ASSERT_EQUAL(4, fake::broker.unacknowledged.size());
+    uint16_t id[4];
+    for (int i = 0; i < 4; i++) {
+        id[i] = fake::broker.messages[i].packetId;
+    }
+
+    // Slots are released in order: acks for 3, 4 and 1 free only the first
+    fake::broker.puback(id[2]);
+    fake::broker.puback(id[3]);
+    fake::broker.puback(id[0]);
+    pump(2);
+    TEST_ASSERT_EQUAL(3, client->getPubacks());
+    TEST_ASSERT_EQUAL(3, client->getInflight());
+
+    fake::broker.puback(id[1]);
+    pump(2);
+    TEST_ASSERT_EQUAL(4, client->getPubacks());
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+
+    // A second PUBACK for an id no longer in flight is ignored
+    fake::broker.puback(id[1]);
+    pump(2);
+    TEST_ASSERT_EQUAL(4, client->getPubacks());
+    TEST_ASSERT_EQUAL(1, client->getDuplicateAcks());
+    TEST_ASSERT_TRUE(client->connected());
+}
+
+static void dropConnection() {
+    AsyncClient::all().back()->drop();
+    pump(2);
+    TEST_ASSERT_FALSE(client->connected());
+}
+
+// Three publishes in flight when the connection drops
+static void dropWithThreeInFlight() {
+    connect();
+    fake::broker.autoPuback = false;
+    for (uint32_t n = 0; n < 3; n++) {
+        TEST_ASSERT_TRUE(publish(n));
+    }
+    pump(2);
+    TEST_ASSERT_EQUAL(3, fake::broker.messages.size());
+    dropConnection();
+    fake::broker.autoPuback = true;
+}
+
+void test_resent_with_dup_when_session_present() {
+    dropWithThreeInFlight();
+    connect();
+    pump(5);
+    TEST_ASSERT_EQUAL(6, fake::broker.messages.size());
+    for (int i = 0; i < 3; i++) {
+        const fake::MqttMessage& first = fake::broker.messages[i];
+        const fake::MqttMessage& again = fake::broker.messages[3 + i];
+        TEST_ASSERT_FALSE(first.dup);
+        TEST_ASSERT_TRUE(again.dup);
+        TEST_ASSERT_EQUAL(first.packetId, again.packetId);
+        TEST_ASSERT_TRUE(payloadOf(first) == payloadOf(again));
+    }
+    TEST_ASSERT_EQUAL(3, client->getRetransmits());
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+}
+
+void test_resent_as_new_when_session_lost() {
+    dropWithThreeInFlight();
+    // Broker restarted without persistence
+    fake::broker.hasSession = false;
+    connect();
+    pump(5);
+    TEST_ASSERT_EQUAL(6, fake::broker.messages.size());
+    for (int i = 0; i < 3; i++) {
+        const fake::MqttMessage& again = fake::broker.messages[3 + i];
+        TEST_ASSERT_FALSE(again.dup);
+        TEST_ASSERT_TRUE(payloadOf(fake::broker.messages[i]) == payloadOf(again));
+    }
+    TEST_ASSERT_EQUAL(0, client->getRetransmits());
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+
+    // A DUP flag from an earlier resend is cleared when a later session is lost
+    fake::broker.autoPuback = false;
+    TEST_ASSERT_TRUE(publish(7));
+    pump(2);
+    dropConnection();
+    connect();
+    pump(5);
+    TEST_ASSERT_TRUE(fake::broker.messages.back().dup);
+    dropConnection();
+    fake::broker.autoPuback = true;
+    fake::broker.hasSession = false;
+    connect();
+    pump(5);
+    TEST_ASSERT_FALSE(fake::broker.messages.back().dup);
+    TEST_ASSERT_TRUE(payloadOf(fake::broker.messages.back()) == "{\"n\":7}");
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+}
+
+void test_missing_puback_fails_the_connection() {
+    client->setConnectTimeout(5000);
+    connect();
+    fake::broker.autoPuback = false;
+    TEST_ASSERT_TRUE(publish(0));
+    pump(4990);
+    TEST_ASSERT_TRUE(client->connected());
+    pump(20);
+    TEST_ASSERT_FALSE(client->connected());
+    TEST_ASSERT_EQUAL(MqttClient::ERROR_ACK, client->getError());
+
+    // The message survives the failure and goes out with the next session
+    fake::broker.autoPuback = true;
+    connect();
+    pump(5);
+    TEST_ASSERT_EQUAL(2, fake::broker.messages.size());
+    TEST_ASSERT_TRUE(fake::broker.messages[1].dup);
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+}
+
+void test_stalled_stream_releases_its_slot() {
+    client->setConnectTimeout(500);
+    connect();
+    fake::broker.blackHole = true; // nothing acknowledged, the send buffer fills
+
+    static uint8_t payload[8000];
+    memset(payload, 'x', sizeof(payload));
+    TEST_ASSERT_TRUE(client->beginPublish(TOPIC, sizeof(payload), false, 1));
+    TEST_ASSERT_EQUAL(1, client->getInflight());
+    TEST_ASSERT_TRUE(client->write(payload, sizeof(payload)) < sizeof(payload));
+    TEST_ASSERT_FALSE(client->endPublish());
+    TEST_ASSERT_FALSE(client->connected());
+    TEST_ASSERT_EQUAL(MqttClient::ERROR_PROTOCOL, client->getError());
+
+    // The caller still has the message, the next session starts with an
+    // empty window instead of a slot counted as lost
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+    pump(5);
+    fake::broker.blackHole = false;
+    connect();
+    pump(5);
+    TEST_ASSERT_EQUAL(0, client->getInflightLost());
+    TEST_ASSERT_TRUE(publish(1));
+    pump(5);
+    TEST_ASSERT_EQUAL(1, fake::broker.messages.size());
+    TEST_ASSERT_EQUAL(0, client->getInflight());
+}
+
+// Publishes as fast as the window allows for 'seconds' of simulated time,
+// returns the messages acknowledged per second
+static double throughput(uint8_t window, size_t payloadLength, uint32_t rttMs, uint32_t seconds) {
+    fake::broker.reset();
+    fake::broker.keepMessages = false;
+    fake::broker.rttMs = rttMs;
+    fake::broker.bytesPerMs = 125; // 1 Mbit/s
+    client->setInflightLimit(window);
+    connect();
+
+    static uint8_t payload[2048];
+    memset(payload, 'x', sizeof(payload));
+    uint32_t startAcks = client->getPubacks();
+    for (uint32_t ms = 0; ms < seconds * 1000; ms++) {
+        while (client->publish(TOPIC, payload, payloadLength, false, 1)) {
+        }
+        pump();
+    }
+    TEST_ASSERT_TRUE(client->connected());
+    TEST_ASSERT_EQUAL(0, client->getRetransmits());
+    double rate = (client->getPubacks() - startAcks) / (double)seconds;
+
+    TEST_ASSERT_TRUE(client->flush(10000));
+    client->disconnect();
+    pump(2);
+    return rate;
+}
+
+void test_window_throughput_benchmark() {
+    const struct {
+        size_t payload;
+        uint32_t rttMs;
+    } runs[] = { { 450, 40 }, { 450, 100 }, { 2000, 40 } };
+
+    for (const auto& run : runs) {
+        double single = throughput(1, run.payload, run.rttMs, 20);
+        double windowed = throughput(MQTT_INFLIGHT_MAX, run.payload, run.rttMs, 20);
+        char line[128];
+        snprintf(line, sizeof(line), "%4u B payload, %3lu ms RTT: window 1 %6.1f msg/s, window %d %6.1f msg/s",
+                 (unsigned)run.payload, (unsigned long)run.rttMs, single, MQTT_INFLIGHT_MAX, windowed);
+        TEST_MESSAGE(line);
+
+        // Stop-and-wait gets about one message per round trip
+        TEST_ASSERT_LESS_OR_EQUAL(1000.0 / run.rttMs + 1, single);
+        TEST_ASSERT_GREATER_THAN(single * 2, windowed);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_each_publish_is_one_segment);
+    RUN_TEST(test_full_window_pushes_back);
+    RUN_TEST(test_out_of_order_pubacks);
+    RUN_TEST(test_resent_with_dup_when_session_present);
+    RUN_TEST(test_resent_as_new_when_session_lost);
+    RUN_TEST(test_missing_puback_fails_the_connection);
+    RUN_TEST(test_stalled_stream_releases_its_slot);
+    RUN_TEST(test_window_throughput_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,266 @@
+// Store-and-forward of <base>/samples against a broker that goes away:
+// short outages from the RAM ring, long ones spilled to and drained from a
+// file-backed sample log, every sample delivered once after dropping QoS 1
+// repeats by (boot, seq), and every sampling cycle kept in one log record
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <esp_partition.h>
+#include <math.h>
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <utility>
+#include "mqtt.h"
+
+static const char* IMAGE = "test_outbound_log.bin";
+static const uint32_t TICK_MS = 100;
+
+static SensorSet* sensors;
+static SampleClock* sampleClock;
+static SampleLog* sampleLog;
+static MQTTManager* manager;
+static uint32_t cycles;
+
+// Hundredths, so the value survives the log and identifies cycle and channel
+static float valueOf(uint32_t n, uint8_t ch) {
+    return (n + ch * 4000) / 100.0f;
+}
+
+void setUp() {
+    remove(IMAGE);
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    fake::openPartition(LOG_PARTITION_LABEL, LOG_PARTITION_SUBTYPE, 64 * LOG_SEGMENT_SIZE, IMAGE);
+    sensors = new SensorSet();
+    sensors->begin();
+    sampleClock = new SampleClock();
+    sampleLog = new SampleLog();
+    sampleLog->begin(sampleClock);
+    manager = new MQTTManager("10.0.0.2", 1883, "", "");
+    manager->begin(sensors, nullptr, sampleClock, sampleLog, nullptr);
+    cycles = 0;
+}
+
+void tearDown() {
+    delete manager;
+    delete sampleLog;
+    delete sampleClock;
+    delete sensors;
+    fake::closePartitions();
+    remove(IMAGE);
+}
+
+static void tick(uint32_t ms) {
+    for (uint32_t t = 0; t < ms; t += TICK_MS) {
+        manager->loop();
+        fake::advanceMs(TICK_MS);
+        fake::runTasks();
+    }
+}
+
+static void feed(uint32_t stamp, uint8_t from, uint8_t to) {
+    for (uint8_t ch = from; ch < to; ch++) {
+        SensorReading reading = { stamp, ch, true, valueOf(cycles, ch) };
+        sampleLog->append(reading);
+        manager->queueReading(reading);
+    }
+}
+
+// One 2 s sampling cycle. The slow sensors report 700 ms after the fast
+// ones, with the timestamp of the cycle start, as the DS18B20 conversion does.
+static void cycle() {
+    uint32_t stamp = millis();
+    tick(300);
+    feed(stamp, 0, TemperatureSensor::FIELDS);
+    tick(700);
+    feed(stamp, TemperatureSensor::FIELDS, CHANNEL_COUNT);
+    tick(1000);
+    cycles++;
+}
+
+static void disconnectBroker() {
+    fake::broker.reachable = false;
+    for (AsyncClient* client : AsyncClient::all()) {
+        client->drop();
+    }
+    fake::runTasks();
+}
+
+static void drain() {
+    fake::broker.reachable = true;
+    for (int i = 0; i < 200 && !manager->isConnected(); i++) {
+        cycle();
+    }
+    TEST_ASSERT_TRUE(manager->isConnected());
+    for (int i = 0; i < 400 && !manager->getOutboundQueue().isEmpty(); i++) {
+        cycle();
+    }
+    TEST_ASSERT_TRUE(manager->getOutboundQueue().isEmpty());
+}
+
+// Deliveries per (cycle, channel) in <base>/samples. QoS 1 repeats are
+// dropped the way a subscriber would, by (boot, seq), and must be the same
+// message as the first copy.
+static std::map<std::pair<uint32_t, uint8_t>, int> deliveries() {
+    std::map<std::pair<uint32_t, uint8_t>, int> seen;
+    std::map<std::pair<unsigned long, unsigned long>, std::string> received;
+    for (const fake::MqttMessage& message : fake::broker.messages) {
+        const std::string& topic = message.topic;
+        if (topic.size() < 8 || topic.compare(topic.size() - 8, 8, "/samples") != 0) {
+            continue;
+        }
+        std::string payload(message.payload.begin(), message.payload.end());
+        unsigned long boot = 0;
+        unsigned long seq = 0;
+        TEST_ASSERT_EQUAL(2, sscanf(payload.c_str(), "{\"boot\":%lu,\"seq\":%lu,", &boot, &seq));
+        auto first = received.insert(std::make_pair(std::make_pair(boot, seq), payload));
+        if (!first.second) {
+            TEST_ASSERT_EQUAL_STRING(first.first->second.c_str(), payload.c_str());
+            continue;
+        }
+        size_t pos = payload.find("\"samples\":[");
+        TEST_ASSERT_TRUE(pos != std::string::npos);
+        pos += 10;
+        while ((pos = payload.find('"', pos)) != std::string::npos) {
+            size_t end = payload.find('"', pos + 1);
+            std::string key = payload.substr(pos + 1, end - pos - 1);
+            pos = end + 1;
+            if (key == "t") {
+                continue;
+            }
+            int ch = parseChannelName(key.c_str());
+            TEST_ASSERT_TRUE_MESSAGE(ch >= 0, key.c_str());
+            long hundredths = lround(strtod(payload.c_str() + end + 2, nullptr) * 100);
+            seen[std::make_pair((uint32_t)(hundredths - ch * 4000), (uint8_t)ch)]++;
+        }
+    }
+    return seen;
+}
+
+static void assertDeliveredOnce(uint32_t from, uint32_t to) {
+    std::map<std::pair<uint32_t, uint8_t>, int> seen = deliveries();
+    for (uint32_t n = from; n < to; n++) {
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            char message[48];
+            snprintf(message, sizeof(message), "cycle %lu channel %u", (unsigned long)n, ch);
+            TEST_ASSERT_EQUAL_MESSAGE(1, seen[std::make_pair(n, ch)], message);
+        }
+    }
+}
+
+static void assertWholeLogRecords() {
+    LogCursor cursor;
+    LogRecord record;
+    uint32_t previous = 0;
+    uint32_t records = 0;
+    sampleLog->flush();
+    TEST_ASSERT_TRUE(sampleLog->beginQuery(0, LOG_ERASED - 1, cursor));
+    while (sampleLog->next(cursor, record)) {
+        TEST_ASSERT_EQUAL_HEX32((1u << CHANNEL_COUNT) - 1, record.validMask);
+        if (records > 0) {
+            TEST_ASSERT_GREATER_THAN(previous, record.timestamp);
+        }
+        previous = record.timestamp;
+        records++;
+    }
+    TEST_ASSERT_EQUAL(cycles, records);
+}
+
+void test_short_outage_drains_from_ram() {
+    TEST_ASSERT_TRUE(manager->connect());
+    for (int i = 0; i < 30; i++) {
+        cycle();
+    }
+    disconnectBroker();
+    for (int i = 0; i < 60; i++) {
+        cycle();
+    }
+    TEST_ASSERT_FALSE(manager->getOutboundQueue().isSpilled());
+    drain();
+
+    const OutboundQueue& queue = manager->getOutboundQueue();
+    TEST_ASSERT_EQUAL(0, queue.getSpills());
+    TEST_ASSERT_EQUAL(0, queue.getDropped());
+    assertDeliveredOnce(0, cycles - 1);
+    assertWholeLogRecords();
+}
+
+void test_long_outage_spills_and_drains_every_sample() {
+    TEST_ASSERT_TRUE(manager->connect());
+    for (int i = 0; i < 30; i++) {
+        cycle();
+    }
+    // 40 minutes, well past the RAM ring
+    disconnectBroker();
+    for (int i = 0; i < 1200; i++) {
+        cycle();
+    }
+    TEST_ASSERT_TRUE(manager->getOutboundQueue().isSpilled());
+    drain();
+
+    const OutboundQueue& queue = manager->getOutboundQueue();
+    TEST_ASSERT_FALSE(queue.isSpilled());
+    TEST_ASSERT_EQUAL(1, queue.getSpills());
+    TEST_ASSERT_GREATER_THAN(1000 * CHANNEL_COUNT, queue.getFromFlash());
+    assertDeliveredOnce(0, cycles - 1);
+    // Back on the ring in the middle of a cycle without splitting its record
+    assertWholeLogRecords();
+}
+
+void test_spill_resumes_at_the_log_timestamp() {
+    // The ring's wall-clock second of a cycle can be one past the log's
+    OutboundQueue queue;
+    queue.begin(sampleLog, sampleClock);
+    uint32_t first = 0;
+    for (uint32_t n = 0; n * CHANNEL_COUNT <= MQTT_QUEUE_RAM; n++) {
+        uint32_t stamp = millis();
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            SensorReading reading = { stamp, ch, true, valueOf(n, ch) };
+            sampleLog->append(reading);
+            LogRecord record;
+            uint32_t sampleMillis;
+            TEST_ASSERT_TRUE(sampleLog->getPending(record, sampleMillis));
+            if (n == 0) {
+                first = record.timestamp;
+            }
+            QueuedSample sample = { (record.timestamp + 1) * 1000ULL + 400, record.timestamp, ch, reading.value };
+            queue.push(sample);
+        }
+        fake::advanceMs(2000);
+    }
+    TEST_ASSERT_TRUE(queue.isSpilled());
+
+    QueuedSample out[MQTT_BATCH_MAX];
+    uint16_t n = queue.peek(out, MQTT_BATCH_MAX);
+    TEST_ASSERT_EQUAL(MQTT_BATCH_MAX / CHANNEL_COUNT * CHANNEL_COUNT, n);
+    TEST_ASSERT_EQUAL(first, out[0].logTimestamp);
+    TEST_ASSERT_EQUAL_FLOAT(valueOf(0, 0), out[0].value);
+}
+
+void test_dropped_batch_is_counted_and_removed() {
+    // A batch that cannot be encoded is removed like a sent one, but counted
+    OutboundQueue queue;
+    queue.begin(sampleLog, sampleClock);
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        QueuedSample sample = { 1000ULL, 1, ch, valueOf(0, ch) };
+        queue.push(sample);
+    }
+    QueuedSample out[MQTT_BATCH_MAX];
+    uint16_t n = queue.peek(out, MQTT_BATCH_MAX);
+    TEST_ASSERT_EQUAL(CHANNEL_COUNT, n);
+    queue.drop(n);
+    TEST_ASSERT_EQUAL(0, queue.getDepth());
+    TEST_ASSERT_EQUAL(CHANNEL_COUNT, queue.getDropped());
+    TEST_ASSERT_EQUAL(0, queue.getCommitted());
+    TEST_ASSERT_EQUAL(0, queue.peek(out, MQTT_BATCH_MAX));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_short_outage_drains_from_ram);
+    RUN_TEST(test_long_outage_spills_and_drains_every_sample);
+    RUN_TEST(test_spill_resumes_at_the_log_timestamp);
+    RUN_TEST(test_dropped_batch_is_counted_and_removed);
+    return UNITY_END();
+}
@@ -0,0 +1,121 @@
+#pragma once
+// Small CBOR decoder for checking payloads in tests. Covers what CborWriter
+// produces: integers, text, arrays, maps and booleans.
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct CborValue {
+    enum Type { UINT, NEGINT, TEXT, ARRAY, MAP, BOOL, INVALID };
+    Type type = INVALID;
+    uint64_t number = 0;            // UINT, or -1 - value for NEGINT
+    bool flag = false;
+    std::string text;
+    std::vector<CborValue> items;   // array items, map keys and values alternating
+
+    int64_t asInt() const { return type == NEGINT ? -1 - (int64_t)number : (int64_t)number; }
+    size_t size() const { return type == MAP ? items.size() / 2 : items.size(); }
+
+    const CborValue* get(const char* key) const {
+        for (size_t i = 0; type == MAP && i + 1 < items.size(); i += 2) {
+            if (items[i].type == TEXT && items[i].text == key) {
+                return &items[i + 1];
+            }
+        }
+        return nullptr;
+    }
+    const CborValue* get(uint64_t key) const {
+        for (size_t i = 0; type == MAP && i + 1 < items.size(); i += 2) {
+            if (items[i].type == UINT && items[i].number == key) {
+                return &items[i + 1];
+            }
+        }
+        return nullptr;
+    }
+};
+
+class CborDecoder {
+private:
+    const uint8_t* data;
+    size_t length;
+    size_t pos = 0;
+
+    bool readArgument(uint8_t info, uint64_t& value) {
+        if (info < 24) {
+            value = info;
+            return true;
+        }
+        if (info > 27) {
+            return false;
+        }
+        size_t bytes = (size_t)1 << (info - 24);
+        if (pos + bytes > length) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < bytes; i++) {
+            value = (value << 8) | data[pos++];
+        }
+        return true;
+    }
+
+    bool readItems(CborValue& out, uint8_t info, size_t perEntry) {
+        uint64_t count;
+        if (!readArgument(info, count)) {
+            return false;
+        }
+        for (uint64_t i = 0; i < count * perEntry; i++) {
+            out.items.emplace_back();
+            if (!decode(out.items.back())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    CborDecoder(const uint8_t* data, size_t length) : data(data), length(length) {}
+
+    bool decode(CborValue& out) {
+        if (pos >= length) {
+            return false;
+        }
+        uint8_t initial = data[pos++];
+        uint8_t major = initial >> 5;
+        uint8_t info = initial & 0x1F;
+        switch (major) {
+        case 0:
+        case 1:
+            out.type = major == 0 ? CborValue::UINT : CborValue::NEGINT;
+            return readArgument(info, out.number);
+        case 3: {
+            uint64_t size;
+            if (!readArgument(info, size) || pos + size > length) {
+                return false;
+            }
+            out.type = CborValue::TEXT;
+            out.text.assign((const char*)data + pos, size);
+            pos += size;
+            return true;
+        }
+        case 4:
+            out.type = CborValue::ARRAY;
+            return readItems(out, info, 1);
+        case 5:
+            out.type = CborValue::MAP;
+            return readItems(out, info, 2);
+        case 7:
+            if (info == 20 || info == 21) {
+                out.type = CborValue::BOOL;
+                out.flag = info == 21;
+                return true;
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+
+    // Whole buffer is exactly one item
+    bool decodeAll(CborValue& out) { return decode(out) && pos == length; }
+};
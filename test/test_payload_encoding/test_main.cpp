@@ -0,0 +1,206 @@
+// <base>/samples and CBOR <base>/state: decoded back with a test decoder,
+// and size and encode time of a full sample batch in JSON against CBOR.
+// Prints the benchmark, run with -v to see it.
+#include <unity.h>
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include "payload_encoding.h"
+#include "sensors.h"
+#include "cbor_decoder.h"
+
+static SensorSet* sensors;
+static QueuedSample batch[MQTT_BATCH_MAX];
+static char textBuffer[MQTT_PAYLOAD_MAX];
+static uint8_t binaryBuffer[MQTT_PAYLOAD_MAX];
+
+static const uint64_t EPOCH_MS = 1767225600000ULL;
+
+// Full cycles of every channel 2 s apart, as the outbound queue holds them
+static uint16_t fillBatch() {
+    uint16_t n = 0;
+    for (uint16_t cycle = 0; n + CHANNEL_COUNT <= MQTT_BATCH_MAX; cycle++) {
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            QueuedSample& sample = batch[n++];
+            sample.epochMs = EPOCH_MS + cycle * 2000ULL + 37;
+            sample.logTimestamp = (uint32_t)(sample.epochMs / 1000);
+            sample.channel = ch;
+            sample.value = (ch == 1 ? 45.3f : 21.0f) + cycle * 0.01f - ch * 3.17f;
+        }
+    }
+    return n;
+}
+
+void setUp() {
+    sensors = new SensorSet();
+    sensors->begin();
+}
+
+void tearDown() {
+    delete sensors;
+}
+
+void test_cbor_primitives() {
+    CborWriter writer(binaryBuffer, sizeof(binaryBuffer));
+    writer.beginArray(8);
+    writer.writeUint(23);
+    writer.writeUint(24);
+    writer.writeUint(0x10000);
+    writer.writeUint(EPOCH_MS);
+    writer.writeInt(-1);
+    writer.writeInt(-2500);
+    writer.writeBool(true);
+    writer.writeString("dht22");
+    TEST_ASSERT_FALSE(writer.hasOverflowed());
+
+    CborValue root;
+    CborDecoder decoder(binaryBuffer, writer.getLength());
+    TEST_ASSERT_TRUE(decoder.decodeAll(root));
+    TEST_ASSERT_EQUAL(CborValue::ARRAY, root.type);
+    TEST_ASSERT_EQUAL(8, root.size());
+    TEST_ASSERT_EQUAL(23, root.items[0].asInt());
+    TEST_ASSERT_EQUAL(24, root.items[1].asInt());
+    TEST_ASSERT_EQUAL(0x10000, root.items[2].asInt());
+    TEST_ASSERT_TRUE(root.items[3].number == EPOCH_MS);
+    TEST_ASSERT_EQUAL(-1, root.items[4].asInt());
+    TEST_ASSERT_EQUAL(-2500, root.items[5].asInt());
+    TEST_ASSERT_TRUE(root.items[6].flag);
+    TEST_ASSERT_EQUAL_STRING("dht22", root.items[7].text.c_str());
+
+    // Shortest form heads
+    TEST_ASSERT_EQUAL_HEX8(0x88, binaryBuffer[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x17, binaryBuffer[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x18, binaryBuffer[2]);
+}
+
+void test_cbor_overflow_is_flagged() {
+    uint8_t small[8];
+    CborWriter writer(small, sizeof(small));
+    writer.writeString("longer than eight");
+    TEST_ASSERT_TRUE(writer.hasOverflowed());
+    TEST_ASSERT_EQUAL(sizeof(small), writer.getLength());
+}
+
+void test_samples_cbor_round_trip() {
+    uint16_t count = fillBatch();
+    CborWriter writer(binaryBuffer, sizeof(binaryBuffer));
+    encodeSamplesCbor(writer, batch, count, true, 0xCAFEF00D, 42);
+    TEST_ASSERT_FALSE(writer.hasOverflowed());
+
+    CborValue root;
+    CborDecoder decoder(binaryBuffer, writer.getLength());
+    TEST_ASSERT_TRUE(decoder.decodeAll(root));
+    TEST_ASSERT_EQUAL(MQTT_CBOR_SCHEMA, root.get("v")->asInt());
+    TEST_ASSERT_TRUE(root.get("b")->number == 0xCAFEF00D);
+    TEST_ASSERT_EQUAL(42, root.get("n")->asInt());
+    TEST_ASSERT_TRUE(root.get("s")->flag);
+    const CborValue* rows = root.get("r");
+    TEST_ASSERT_NOT_NULL(rows);
+    TEST_ASSERT_EQUAL(count / CHANNEL_COUNT, rows->size());
+
+    uint16_t i = 0;
+    for (const CborValue& row : rows->items) {
+        TEST_ASSERT_EQUAL(2, row.size());
+        TEST_ASSERT_TRUE(row.items[0].number == batch[i].epochMs);
+        const CborValue& values = row.items[1];
+        TEST_ASSERT_EQUAL(CHANNEL_COUNT, values.size());
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++, i++) {
+            const CborValue* value = values.get((uint64_t)batch[i].channel);
+            TEST_ASSERT_NOT_NULL(value);
+            TEST_ASSERT_EQUAL(lroundf(batch[i].value * 100), value->asInt());
+        }
+    }
+    TEST_ASSERT_EQUAL(count, i);
+}
+
+void test_state_cbor_carries_the_sample_time() {
+    float values[CHANNEL_COUNT] = { 21.5f, 45.0f, 21.1f, -3.25f, 0, 0, 0 };
+    uint16_t mask = 0x0F;
+    CborWriter writer(binaryBuffer, sizeof(binaryBuffer));
+    encodeStateCbor(writer, EPOCH_MS + 123, values, mask);
+
+    CborValue root;
+    CborDecoder decoder(binaryBuffer, writer.getLength());
+    TEST_ASSERT_TRUE(decoder.decodeAll(root));
+    TEST_ASSERT_EQUAL(3, root.size());
+    TEST_ASSERT_TRUE(root.get("t")->number == EPOCH_MS + 123);
+    const CborValue* channels = root.get("c");
+    TEST_ASSERT_EQUAL(4, channels->size());
+    TEST_ASSERT_EQUAL(2150, channels->get((uint64_t)0)->asInt());
+    TEST_ASSERT_EQUAL(-325, channels->get((uint64_t)3)->asInt());
+    TEST_ASSERT_NULL(channels->get((uint64_t)4));
+
+    // No sample yet: no time rather than the publish time
+    CborWriter unknown(binaryBuffer, sizeof(binaryBuffer));
+    encodeStateCbor(unknown, 0, values, mask);
+    CborValue untimed;
+    CborDecoder second(binaryBuffer, unknown.getLength());
+    TEST_ASSERT_TRUE(second.decodeAll(untimed));
+    TEST_ASSERT_NULL(untimed.get("t"));
+    TEST_ASSERT_NOT_NULL(untimed.get("c"));
+}
+
+void test_samples_json_groups_cycles() {
+    QueuedSample samples[3] = {
+        { EPOCH_MS, 0, 0, 21.5f },
+        { EPOCH_MS, 0, 1, 45.0f },
+        { EPOCH_MS + 2000, 0, 0, 21.55f },
+    };
+    char name0[CHANNEL_NAME_MAX];
+    char name1[CHANNEL_NAME_MAX];
+    formatChannelName(0, name0, sizeof(name0));
+    formatChannelName(1, name1, sizeof(name1));
+    char expected[256];
+    snprintf(expected, sizeof(expected),
+             "{\"boot\":3405705229,\"seq\":7,\"synced\":false,\"samples\":[{\"t\":%llu,\"%s\":21.50,\"%s\":45.00},{\"t\":%llu,\"%s\":21.55}]}",
+             (unsigned long long)EPOCH_MS, name0, name1, (unsigned long long)EPOCH_MS + 2000, name0);
+
+    TextBuffer out(textBuffer, sizeof(textBuffer));
+    encodeSamplesJson(out, samples, 3, false, 0xCAFEF00D, 7);
+    TEST_ASSERT_EQUAL_STRING(expected, out.c_str());
+}
+
+void test_benchmark_full_batch_json_vs_cbor() {
+    uint16_t count = fillBatch();
+    const int rounds = 20000;
+    TextBuffer text(textBuffer, sizeof(textBuffer));
+    size_t jsonSize = 0;
+    size_t cborSize = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        encodeSamplesJson(text, batch, count, true, 0xCAFEF00D, 42);
+        jsonSize = text.getLength();
+    }
+    auto json = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        CborWriter writer(binaryBuffer, sizeof(binaryBuffer));
+        encodeSamplesCbor(writer, batch, count, true, 0xCAFEF00D, 42);
+        cborSize = writer.getLength();
+    }
+    auto cbor = std::chrono::steady_clock::now() - start;
+    TEST_ASSERT_FALSE(text.hasOverflowed());
+
+    double jsonUs = std::chrono::duration<double, std::micro>(json).count() / rounds;
+    double cborUs = std::chrono::duration<double, std::micro>(cbor).count() / rounds;
+    char line[160];
+    snprintf(line, sizeof(line), "%u samples: JSON %u bytes %.2f us, CBOR %u bytes %.2f us (%.1fx smaller)",
+             count, (unsigned)jsonSize, jsonUs, (unsigned)cborSize, cborUs, (double)jsonSize / cborSize);
+    TEST_MESSAGE(line);
+
+    // Channel ids and integer hundredths instead of names and decimal text
+    TEST_ASSERT_LESS_THAN(jsonSize / 3, cborSize);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cbor_primitives);
+    RUN_TEST(test_cbor_overflow_is_flagged);
+    RUN_TEST(test_samples_cbor_round_trip);
+    RUN_TEST(test_state_cbor_carries_the_sample_time);
+    RUN_TEST(test_samples_json_groups_cycles);
+    RUN_TEST(test_benchmark_full_batch_json_vs_cbor);
+    return UNITY_END();
+}
@@ -0,0 +1,252 @@
+// PrometheusWriter: family and sample lines, label escaping, histograms with
+// the +Inf bucket, replay over small buffers, and a /metrics scrape whose
+// histograms keep recording while the response is sent
+#include <unity.h>
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <map>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "metrics.h"
+#include "mqtt.h"
+#include "webserver.h"
+
+static char buffer[4096];
+
+static SensorSet* sensors;
+static SensorTask* sensorTask;
+static WiFiManager* wifiManager;
+static MQTTManager* mqttManager;
+static AsyncWebServer* server;
+static bool apMode = false;
+
+void setUp() {}
+void tearDown() {}
+
+static DurationHistogram sampleHistogram() {
+    DurationHistogram hist;
+    hist.reset();
+    hist.record(1);         // bucket 0
+    hist.record(3);         // bucket 1
+    hist.record(3);
+    hist.record(1500000);   // past the last bound, only in +Inf
+    return hist;
+}
+
+static std::vector<std::string> lines(const std::string& text) {
+    std::vector<std::string> out;
+    size_t start = 0;
+    for (size_t end; (end = text.find('\n', start)) != std::string::npos; start = end + 1) {
+        out.push_back(text.substr(start, end - start));
+    }
+    TEST_ASSERT_EQUAL(text.size(), start);  // every line is terminated
+    return out;
+}
+
+// Value of the line that starts with 'series ', -1 if there is none
+static double valueOf(const std::vector<std::string>& page, const std::string& series) {
+    for (const std::string& line : page) {
+        if (line.compare(0, series.size() + 1, series + " ") == 0) {
+            return atof(line.c_str() + series.size() + 1);
+        }
+    }
+    return -1;
+}
+
+void test_family_help_then_type_then_samples() {
+    PrometheusWriter out(buffer, sizeof(buffer));
+    out.family("ppiot_heap_free_bytes", "gauge", "Free heap");
+    out.sample("ppiot_heap_free_bytes", nullptr, 123456);
+    out.family("ppiot_uptime_seconds", "gauge", "Time since boot");
+    out.sampleSeconds("ppiot_uptime_seconds", "", 61000042);
+    TEST_ASSERT_EQUAL_STRING(
+        "# HELP ppiot_heap_free_bytes Free heap\n"
+        "# TYPE ppiot_heap_free_bytes gauge\n"
+        "ppiot_heap_free_bytes 123456\n"
+        "# HELP ppiot_uptime_seconds Time since boot\n"
+        "# TYPE ppiot_uptime_seconds gauge\n"
+        "ppiot_uptime_seconds 61.000042\n",
+        buffer);
+    TEST_ASSERT_EQUAL_UINT32(6, out.getTokens());
+}
+
+void test_labels_are_escaped() {
+    char labels[80];
+    TextBuffer text(labels, sizeof(labels));
+    PrometheusWriter::appendLabel(text, "method", "GET");
+    PrometheusWriter::appendLabel(text, "route", "/a\"b\\c\nd");
+    TEST_ASSERT_EQUAL_STRING("method=\"GET\",route=\"/a\\\"b\\\\c\\nd\"", labels);
+
+    PrometheusWriter out(buffer, sizeof(buffer));
+    out.sample("ppiot_http_requests_total", labels, -3);
+    TEST_ASSERT_EQUAL_STRING("ppiot_http_requests_total{method=\"GET\",route=\"/a\\\"b\\\\c\\nd\"} -3\n", buffer);
+}
+
+void test_histogram_is_cumulative_up_to_inf() {
+    DurationHistogram hist = sampleHistogram();
+    PrometheusWriter out(buffer, sizeof(buffer));
+    out.histogram("ppiot_loop_seconds", "sensor=\"dht22\"", hist);
+    std::vector<std::string> page = lines(buffer);
+
+    // One line per bound, +Inf, _sum and _count
+    TEST_ASSERT_EQUAL(SENSOR_STATS_BUCKETS + 2, page.size());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_bucket{sensor=\"dht22\",le=\"0.000002\"} 1", page[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_bucket{sensor=\"dht22\",le=\"0.000004\"} 3", page[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_bucket{sensor=\"dht22\",le=\"0.524288\"} 3",
+                             page[SENSOR_STATS_BUCKETS - 2].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_bucket{sensor=\"dht22\",le=\"+Inf\"} 4",
+                             page[SENSOR_STATS_BUCKETS - 1].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_sum{sensor=\"dht22\"} 1.500007", page[SENSOR_STATS_BUCKETS].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_count{sensor=\"dht22\"} 4", page[SENSOR_STATS_BUCKETS + 1].c_str());
+
+    // Bounds and counts only grow
+    double lastBound = 0, lastCount = 0;
+    for (uint8_t k = 0; k < SENSOR_STATS_BUCKETS - 1; k++) {
+        size_t le = page[k].find("le=\"") + 4;
+        double bound = atof(page[k].c_str() + le);
+        double count = atof(page[k].c_str() + page[k].rfind(' ') + 1);
+        TEST_ASSERT_TRUE(bound > lastBound);
+        TEST_ASSERT_TRUE(count >= lastCount);
+        lastBound = bound;
+        lastCount = count;
+    }
+}
+
+void test_histogram_without_labels_has_only_le() {
+    DurationHistogram hist = sampleHistogram();
+    PrometheusWriter out(buffer, sizeof(buffer));
+    out.histogram("ppiot_loop_seconds", nullptr, hist);
+    std::vector<std::string> page = lines(buffer);
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_bucket{le=\"+Inf\"} 4", page[SENSOR_STATS_BUCKETS - 1].c_str());
+    TEST_ASSERT_EQUAL_STRING("ppiot_loop_seconds_count 4", page.back().c_str());
+}
+
+// Replay like sendReplayed(): a buffer ends at a line end, never inside one
+void test_replay_splits_at_line_ends() {
+    DurationHistogram hist = sampleHistogram();
+    auto render = [&hist](PrometheusWriter& out) {
+        out.family("ppiot_loop_seconds", "histogram", "Time from one loop() iteration to the next");
+        out.histogram("ppiot_loop_seconds", nullptr, hist);
+        out.family("ppiot_heap_free_bytes", "gauge", "Free heap");
+        out.sample("ppiot_heap_free_bytes", nullptr, 123456);
+    };
+    PrometheusWriter whole(buffer, sizeof(buffer));
+    render(whole);
+    std::string expected(buffer, whole.getLength());
+
+    for (size_t size = 80; size <= expected.size() + 1; size += 7) {
+        std::string joined;
+        uint32_t sent = 0;
+        for (bool done = false; !done;) {
+            char chunk[4096];
+            PrometheusWriter out(chunk, size, sent);
+            render(out);
+            TEST_ASSERT_TRUE(out.getLength() > 0);
+            TEST_ASSERT_EQUAL('\n', chunk[out.getLength() - 1]);
+            joined.append(chunk, out.getLength());
+            sent = out.getTokens();
+            done = !out.isFull();
+        }
+        TEST_ASSERT_TRUE(joined == expected);
+    }
+}
+
+// The loop-time histogram keeps recording between the chunks of a scrape.
+// Every chunk renders the copy taken with the request, so the +Inf bucket
+// of each histogram still equals its _count.
+void test_scrape_histograms_stay_consistent() {
+    // The first call only starts the clock: 49 loop times
+    for (int i = 0; i < 50; i++) {
+        fake::advanceMs(3);
+        Metrics::markLoop();
+    }
+
+    AsyncWebServerRequest request("/metrics");
+    TEST_ASSERT_TRUE(server->handle(request));
+    AsyncWebServerResponse& response = *request.response;
+    std::string text;
+    std::vector<uint8_t> chunk(256);
+    for (int calls = 0; calls < 10000; calls++) {
+        size_t n = response.filler(chunk.data(), chunk.size(), text.size());
+        if (n == 0) {
+            break;
+        }
+        TEST_ASSERT_TRUE(n != RESPONSE_TRY_AGAIN);
+        text.append((const char*)chunk.data(), n);
+        // A slow loop lands in a higher bucket than the ones already sent
+        fake::advanceMs(200);
+        Metrics::markLoop();
+    }
+    std::vector<std::string> page = lines(text);
+    TEST_ASSERT_TRUE(page.size() > 100);
+
+    // Families: HELP, TYPE, then only their own series
+    std::map<std::string, int> families;
+    std::string family;
+    for (size_t i = 0; i < page.size(); i++) {
+        const std::string& line = page[i];
+        if (line.compare(0, 7, "# HELP ") == 0) {
+            family = line.substr(7, line.find(' ', 7) - 7);
+            TEST_ASSERT_EQUAL(0, families[family]++);
+            TEST_ASSERT_TRUE(i + 1 < page.size());
+            TEST_ASSERT_TRUE(page[i + 1].compare(0, 8 + family.size(), "# TYPE " + family + " ") == 0);
+            i++;
+            continue;
+        }
+        TEST_ASSERT_TRUE_MESSAGE(line.compare(0, family.size(), family) == 0, line.c_str());
+    }
+
+    TEST_ASSERT_EQUAL(49, valueOf(page, "ppiot_loop_seconds_bucket{le=\"+Inf\"}"));
+    TEST_ASSERT_EQUAL(49, valueOf(page, "ppiot_loop_seconds_count"));
+    // None of the 200 ms loops recorded during the scrape
+    TEST_ASSERT_EQUAL(49, valueOf(page, "ppiot_loop_seconds_bucket{le=\"0.262144\"}"));
+    TEST_ASSERT_EQUAL(49, valueOf(page, "ppiot_loop_seconds_bucket{le=\"0.008192\"}"));
+    for (const char* sensor : { "dht22", "ds18b20" }) {
+        std::string labels = std::string("{sensor=\"") + sensor + "\"";
+        TEST_ASSERT_EQUAL(valueOf(page, "ppiot_sensor_sample_seconds_count" + labels + "}"),
+                          valueOf(page, "ppiot_sensor_sample_seconds_bucket" + labels + ",le=\"+Inf\"}"));
+    }
+}
+
+// A buffer too small for the next line waits for room, one of WEB_CHUNK_MIN
+// always takes a line
+void test_scrape_waits_only_below_the_chunk_minimum() {
+    AsyncWebServerRequest request("/metrics");
+    TEST_ASSERT_TRUE(server->handle(request));
+    AsyncWebServerResponse& response = *request.response;
+    std::vector<uint8_t> chunk(WEB_CHUNK_MIN);
+    TEST_ASSERT_TRUE(response.filler(chunk.data(), 8, 0) == RESPONSE_TRY_AGAIN);
+    size_t sent = 0;
+    for (int calls = 0; calls < 10000; calls++) {
+        size_t n = response.filler(chunk.data(), chunk.size(), sent);
+        if (n == 0) {
+            break;
+        }
+        TEST_ASSERT_TRUE(n != RESPONSE_TRY_AGAIN);
+        sent += n;
+    }
+    TEST_ASSERT_TRUE(sent > WEB_CHUNK_MIN);
+}
+
+int main(int argc, char** argv) {
+    fake::resetClock(1000000);
+    sensors = new SensorSet();
+    sensors->begin();
+    sensorTask = new SensorTask(sensors);
+    wifiManager = new WiFiManager();
+    mqttManager = new MQTTManager("10.0.0.2", 1883, "", "");
+    WebServer* webServer = new WebServer(wifiManager, sensors, sensorTask, mqttManager, nullptr, nullptr, nullptr, &apMode);
+    webServer->begin();
+    server = fake::webServers().back();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_family_help_then_type_then_samples);
+    RUN_TEST(test_labels_are_escaped);
+    RUN_TEST(test_histogram_is_cumulative_up_to_inf);
+    RUN_TEST(test_histogram_without_labels_has_only_le);
+    RUN_TEST(test_replay_splits_at_line_ends);
+    RUN_TEST(test_scrape_histograms_stay_consistent);
+    RUN_TEST(test_scrape_waits_only_below_the_chunk_minimum);
+    return UNITY_END();
+}
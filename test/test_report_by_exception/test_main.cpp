@@ -0,0 +1,191 @@
+// Report-by-exception on the per-value topics: deadbands, the percent band
+// floor, heartbeat, failed reads and publishes the client did not take
+#include <unity.h>
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <string>
+#include "mqtt.h"
+
+static SensorSet* sensors;
+static MQTTManager* manager;
+
+static TemperatureSensor& dht() {
+    return *sensors->find<TemperatureSensor>();
+}
+
+// Messages published to <base>/<suffix> since the last call
+static std::vector<std::string> take(const char* suffix) {
+    std::vector<std::string> values;
+    std::string tail = suffix;
+    for (const fake::MqttMessage& message : fake::broker.messages) {
+        const std::string& topic = message.topic;
+        if (topic.size() >= tail.size() && topic.compare(topic.size() - tail.size(), tail.size(), tail) == 0) {
+            values.push_back(std::string(message.payload.begin(), message.payload.end()));
+        }
+    }
+    return values;
+}
+
+// The DHT22 read as the sensor task does it, without draining its readings
+static void read(float temperature) {
+    fake::dhtTemperature = temperature;
+    dht().startSample();
+    dht().pollSample();
+}
+
+// One cycle as loop() sees it: the readings come off the sensor task's
+// queue into the manager (DHT22 channels are first in the registry)
+static void sample(float temperature) {
+    read(temperature);
+    for (uint8_t f = 0; f < TemperatureSensor::FIELDS; f++) {
+        SensorReading reading = { (uint32_t)millis(), f, dht().isValid(0), dht().getValue(0, f) };
+        manager->queueReading(reading);
+    }
+}
+
+static void publish() {
+    fake::broker.messages.clear();
+    manager->publishAllSensorData();
+    fake::runTasks();
+    fake::advanceMs(MQTT_PUBLISH_INTERVAL);
+}
+
+void setUp() {
+    fake::resetClock(1000000);
+    fake::broker.reset();
+    fake::dhtTemperature = 21.5f;
+    fake::dhtHumidity = 45.0f;
+    sensors = new SensorSet();
+    sensors->begin();
+    manager = new MQTTManager("10.0.0.2", 1883, "", "");
+    manager->begin(sensors, nullptr, nullptr, nullptr, nullptr);
+    TEST_ASSERT_TRUE(manager->connect());
+    fake::runTasks();
+}
+
+void tearDown() {
+    delete manager;
+    delete sensors;
+}
+
+void test_deadband_suppresses_small_changes() {
+    sample(21.5f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/temperature").size());
+    TEST_ASSERT_EQUAL(1, take("/dht22/data").size());
+
+    sample(21.55f);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/temperature").size());
+    TEST_ASSERT_EQUAL(0, take("/dht22/data").size());
+    TEST_ASSERT_GREATER_THAN(0, manager->getSuppressedCount());
+
+    sample(21.7f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/temperature").size());
+    TEST_ASSERT_EQUAL(0, take("/dht22/humidity").size());
+}
+
+void test_heartbeat_republishes_unchanged_values() {
+    sample(21.5f);
+    publish();
+    for (unsigned long t = 0; t + MQTT_PUBLISH_INTERVAL < MQTT_HEARTBEAT_INTERVAL; t += MQTT_PUBLISH_INTERVAL) {
+        sample(21.5f);
+        publish();
+        TEST_ASSERT_EQUAL(0, take("/dht22/humidity").size());
+    }
+    sample(21.5f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/humidity").size());
+}
+
+void test_percent_band_has_a_floor_near_zero() {
+    // 1 % of 0.05 °C would let every flicker through
+    sample(0.05f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/heatindex").size());
+    sample(0.0f);
+    publish();
+    sample(0.08f);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/heatindex").size());
+    sample(0.2f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/heatindex").size());
+
+    // Far from zero the percent band is the wider one
+    sample(40.0f);
+    publish();
+    sample(40.3f);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/heatindex").size());
+    TEST_ASSERT_EQUAL(1, take("/dht22/temperature").size());
+}
+
+void test_failed_read_is_reported_once() {
+    sample(21.5f);
+    publish();
+
+    // The numeric topics stay quiet as they always have, data carries the null
+    sample(NAN);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/temperature").size());
+    std::vector<std::string> values = take("/dht22/data");
+    TEST_ASSERT_EQUAL(1, values.size());
+    TEST_ASSERT_TRUE(values[0].find("\"temperature\":null") != std::string::npos);
+
+    sample(NAN);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/data").size());
+
+    // Back with the value it had before the failure
+    sample(21.5f);
+    publish();
+    values = take("/dht22/temperature");
+    TEST_ASSERT_EQUAL(1, values.size());
+    TEST_ASSERT_EQUAL_STRING(" 21.50", values[0].c_str());
+}
+
+void test_rejected_publish_is_retried() {
+    sample(21.5f);
+    publish();
+
+    // Send buffer full: the change must not count as published
+    fake::broker.sendBuffer = 0;
+    sample(23.0f);
+    publish();
+    TEST_ASSERT_EQUAL(0, take("/dht22/temperature").size());
+
+    fake::broker.sendBuffer = 5744;
+    sample(23.0f);
+    publish();
+    std::vector<std::string> values = take("/dht22/temperature");
+    TEST_ASSERT_EQUAL(1, values.size());
+    TEST_ASSERT_EQUAL_STRING(" 23.00", values[0].c_str());
+}
+
+void test_publishes_the_drained_reading() {
+    sample(21.5f);
+    publish();
+    TEST_ASSERT_EQUAL(1, take("/dht22/temperature").size());
+
+    // The sensor task has a failed read that loop() has not drained yet:
+    // the manager keeps publishing from the readings it was given
+    sample(23.0f);
+    read(NAN);
+    publish();
+    std::vector<std::string> values = take("/dht22/temperature");
+    TEST_ASSERT_EQUAL(1, values.size());
+    TEST_ASSERT_EQUAL_STRING(" 23.00", values[0].c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_deadband_suppresses_small_changes);
+    RUN_TEST(test_heartbeat_republishes_unchanged_values);
+    RUN_TEST(test_percent_band_has_a_floor_near_zero);
+    RUN_TEST(test_failed_read_is_reported_once);
+    RUN_TEST(test_rejected_publish_is_retried);
+    RUN_TEST(test_publishes_the_drained_reading);
+    return UNITY_END();
+}
@@ -0,0 +1,176 @@
+// RollupStore: window aggregation, the RAM footprint, and the day ring
+// surviving a reboot through NVS
+#include <unity.h>
+#include <Arduino.h>
+#include <Preferences.h>
+#include "rollup.h"
+
+static const uint32_t T0 = 1700000000 - 1700000000 % 86400; // midnight
+
+static RollupStore* store;
+
+void setUp() {
+    fake::nvs.clear();
+    store = new RollupStore();
+    store->begin();
+}
+
+void tearDown() {
+    delete store;
+}
+
+static void reboot() {
+    delete store;
+    store = new RollupStore();
+    store->begin();
+}
+
+static void add(uint8_t channel, float value, uint32_t timestamp, bool valid = true) {
+    SensorReading reading;
+    reading.timestamp = 0;
+    reading.channel = channel;
+    reading.valid = valid;
+    reading.value = value;
+    store->add(reading, timestamp);
+}
+
+// One reading per channel every 'step' seconds over [from, to)
+static void feed(uint32_t from, uint32_t to, uint32_t step, float value) {
+    for (uint32_t t = from; t < to; t += step) {
+        for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+            add(ch, value + ch, t);
+        }
+    }
+}
+
+void test_ram_footprint() {
+    // 60 minutes, 168 hours and 31 days of windows per channel, on the heap.
+    // A year of days would add ~30 KB with 7 channels, more than NVS holds.
+    TEST_ASSERT_LESS_THAN(24 * 1024, sizeof(RollupStore));
+}
+
+void test_minute_window_aggregates() {
+    add(0, 20.0f, T0 + 1);
+    add(0, 22.5f, T0 + 30);
+    add(0, 21.0f, T0 + 59);
+    add(1, 0.0f, T0 + 59, false);
+    add(0, 0.0f, T0 + 60); // closes the first minute
+
+    RollupBucket bucket;
+    TEST_ASSERT_EQUAL(1, store->getCount(ROLLUP_MINUTE));
+    TEST_ASSERT_EQUAL(T0, store->getBucketStart(ROLLUP_MINUTE, 0));
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_MINUTE, 0, 0, bucket));
+    TEST_ASSERT_EQUAL(3, bucket.count);
+    TEST_ASSERT_EQUAL(2000, bucket.min);
+    TEST_ASSERT_EQUAL(2250, bucket.max);
+    TEST_ASSERT_EQUAL(2100, bucket.last);
+    TEST_ASSERT_EQUAL(6350, bucket.sum);
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_MINUTE, 1, 0, bucket));
+    TEST_ASSERT_EQUAL(0, bucket.count);
+}
+
+void test_week_of_hours_kept() {
+    feed(T0, T0 + 8 * 86400 + 1, 600, 5.0f);
+    TEST_ASSERT_EQUAL(7 * 24, store->getCount(ROLLUP_HOUR));
+    TEST_ASSERT_EQUAL(T0 + 86400, store->getBucketStart(ROLLUP_HOUR, 0));
+    RollupBucket bucket;
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_HOUR, 3, 0, bucket));
+    TEST_ASSERT_EQUAL(6, bucket.count);
+    TEST_ASSERT_EQUAL(800, bucket.max);
+}
+
+void test_day_survives_reboot() {
+    feed(T0, T0 + 3 * 86400 + 1800, 300, 10.0f);
+    TEST_ASSERT_EQUAL(3 * 24, store->getCount(ROLLUP_HOUR));
+    TEST_ASSERT_EQUAL(3, store->getCount(ROLLUP_DAY));
+    TEST_ASSERT_EQUAL(3, store->getClosedCount(ROLLUP_DAY));
+
+    RollupBucket before;
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 2, 2, before));
+
+    reboot();
+
+    TEST_ASSERT_EQUAL(0, store->getCount(ROLLUP_MINUTE));
+    TEST_ASSERT_EQUAL(0, store->getCount(ROLLUP_HOUR));
+    TEST_ASSERT_EQUAL(3, store->getCount(ROLLUP_DAY));
+    TEST_ASSERT_EQUAL(T0, store->getBucketStart(ROLLUP_DAY, 0));
+    TEST_ASSERT_EQUAL(0, store->getClosedCount(ROLLUP_DAY)); // counts since boot
+
+    RollupBucket after;
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 2, 2, after));
+    TEST_ASSERT_EQUAL(before.sum, after.sum);
+    TEST_ASSERT_EQUAL(288, after.count);
+    TEST_ASSERT_EQUAL(1200, after.min);
+
+    // Down for 2 days: the missed days close as empty windows and the day
+    // open at the reboot was not saved
+    uint32_t resume = T0 + 5 * 86400 + 1800;
+    feed(resume, resume + 86400 + 1, 3600, 30.0f);
+    TEST_ASSERT_EQUAL(6, store->getCount(ROLLUP_DAY));
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 5, after));
+    TEST_ASSERT_EQUAL(24, after.count);
+    TEST_ASSERT_EQUAL(3000, after.max);
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 4, after));
+    TEST_ASSERT_EQUAL(0, after.count);
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 3, after));
+    TEST_ASSERT_EQUAL(0, after.count);
+
+    reboot();
+    TEST_ASSERT_EQUAL(6, store->getCount(ROLLUP_DAY));
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 5, after));
+    TEST_ASSERT_EQUAL(3000, after.max);
+}
+
+void test_saved_once_per_day() {
+    // Hours closing write nothing
+    feed(T0, T0 + 86399, 600, 5.0f);
+    TEST_ASSERT_EQUAL(0, fake::nvs["rollup"].size());
+
+    // A closed day writes its own slot and the ring position, not the ring
+    feed(T0 + 86400, T0 + 86401, 600, 5.0f);
+    TEST_ASSERT_EQUAL(2, fake::nvs["rollup"].size());
+    TEST_ASSERT_EQUAL(CHANNEL_COUNT * sizeof(RollupBucket), fake::nvs["rollup"]["day0"].size());
+    feed(T0 + 2 * 86400, T0 + 2 * 86400 + 1, 600, 5.0f);
+    TEST_ASSERT_EQUAL(3, fake::nvs["rollup"].size());
+    TEST_ASSERT_EQUAL(CHANNEL_COUNT * sizeof(RollupBucket), fake::nvs["rollup"]["day1"].size());
+}
+
+void test_mismatched_layout_ignored() {
+    feed(T0, T0 + 2 * 86400 + 1, 3600, 5.0f);
+    TEST_ASSERT_EQUAL(2, store->getCount(ROLLUP_DAY));
+
+    // A slot lost to a reset between the writes reads as empty
+    fake::nvs["rollup"].erase("day1");
+    reboot();
+    RollupBucket bucket;
+    TEST_ASSERT_EQUAL(2, store->getCount(ROLLUP_DAY));
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 0, bucket));
+    TEST_ASSERT_EQUAL(24, bucket.count);
+    TEST_ASSERT_TRUE(store->getBucket(ROLLUP_DAY, 0, 1, bucket));
+    TEST_ASSERT_EQUAL(0, bucket.count);
+
+    // Written by a build with another ROLLUP_DAY_SLOTS
+    std::vector<uint8_t>& position = fake::nvs["rollup"]["day_at"];
+    position[4] ^= 1;
+    reboot();
+    TEST_ASSERT_EQUAL(0, store->getCount(ROLLUP_DAY));
+
+    // A long gap empties the ring, also on flash
+    feed(T0, T0 + 86400 + 1, 3600, 5.0f);
+    reboot();
+    TEST_ASSERT_EQUAL(1, store->getCount(ROLLUP_DAY));
+    feed(T0 + (ROLLUP_DAY_SLOTS + 5) * 86400, T0 + (ROLLUP_DAY_SLOTS + 5) * 86400 + 1, 3600, 5.0f);
+    reboot();
+    TEST_ASSERT_EQUAL(0, store->getCount(ROLLUP_DAY));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ram_footprint);
+    RUN_TEST(test_minute_window_aggregates);
+    RUN_TEST(test_week_of_hours_kept);
+    RUN_TEST(test_day_survives_reboot);
+    RUN_TEST(test_saved_once_per_day);
+    RUN_TEST(test_mismatched_layout_ignored);
+    return UNITY_END();
+}
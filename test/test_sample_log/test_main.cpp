@@ -0,0 +1,269 @@
+// SampleLog on a file-backed partition image: batching, ring wrap, index
+// rebuild after a reboot, replay requests from another task, and readers
+// not blocked while a segment is erased
+#include <unity.h>
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <freertos/semphr.h>
+#include <stdio.h>
+#include <vector>
+#include "sample_log.h"
+
+static const char* IMAGE = "test_samplelog.bin";
+static const uint32_t PARTITION_SIZE = 16 * LOG_SEGMENT_SIZE;
+
+static SampleClock* clock;
+static SampleLog* sampleLog;
+static fake::Partition* partition;
+
+static void boot() {
+    partition = fake::openPartition(LOG_PARTITION_LABEL, LOG_PARTITION_SUBTYPE, PARTITION_SIZE, IMAGE);
+    clock = new SampleClock();
+    sampleLog = new SampleLog();
+    TEST_ASSERT_TRUE(sampleLog->begin(clock));
+}
+
+static void shutdown() {
+    delete sampleLog;
+    delete clock;
+    fake::closePartitions();
+}
+
+void setUp() {
+    remove(IMAGE);
+    fake::resetClock(1000000);
+    fake::mutexContention = 0;
+    fake::onErase = nullptr;
+    boot();
+}
+
+void tearDown() {
+    shutdown();
+    remove(IMAGE);
+}
+
+// One sampling cycle on every channel, 2 s apart, value encodes the cycle
+static void cycle(uint32_t n) {
+    uint32_t stamp = millis();
+    for (uint8_t ch = 0; ch < CHANNEL_COUNT; ch++) {
+        SensorReading reading;
+        reading.timestamp = stamp;
+        reading.channel = ch;
+        reading.valid = ch != 1;
+        reading.value = (n % 3000) / 10.0f + ch;
+        sampleLog->append(reading);
+    }
+    fake::advanceMs(2000);
+}
+
+static uint32_t countRange(uint32_t from, uint32_t to, uint32_t& first, uint32_t& last) {
+    LogCursor cursor;
+    LogRecord record;
+    uint32_t n = 0;
+    uint32_t previous = 0;
+    if (!sampleLog->beginQuery(from, to, cursor)) {
+        return 0;
+    }
+    while (sampleLog->next(cursor, record)) {
+        TEST_ASSERT_GREATER_OR_EQUAL(previous, record.timestamp);
+        previous = record.timestamp;
+        if (n == 0) {
+            first = record.timestamp;
+        }
+        last = record.timestamp;
+        n++;
+    }
+    return n;
+}
+
+void test_records_round_trip() {
+    uint32_t start = sampleLog->now();
+    for (uint32_t n = 0; n < 100; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+    TEST_ASSERT_EQUAL(100, sampleLog->getRecordsWritten());
+    // Batched: far fewer flash writes than records
+    TEST_ASSERT_LESS_THAN(100 / LOG_BATCH_RECORDS + 4, partition->writes);
+    TEST_ASSERT_EQUAL(0, partition->straddles);
+
+    LogCursor cursor;
+    LogRecord record;
+    TEST_ASSERT_TRUE(sampleLog->beginQuery(start + 20, start + 29, cursor));
+    uint32_t n = 0;
+    while (sampleLog->next(cursor, record)) {
+        TEST_ASSERT_EQUAL(start + 20 + n * 2, record.timestamp);
+        TEST_ASSERT_FALSE(record.validMask & 2);
+        TEST_ASSERT_EQUAL((int16_t)((10 + n) * 10 + 0), record.values[0]);
+        n++;
+    }
+    TEST_ASSERT_EQUAL(5, n);
+}
+
+void test_unflushed_records_are_queryable() {
+    uint32_t start = sampleLog->now();
+    for (uint32_t n = 0; n < 3; n++) {
+        cycle(n);
+    }
+    uint32_t first = 0;
+    uint32_t last = 0;
+    // The third cycle is still being assembled, nothing is on flash yet
+    TEST_ASSERT_EQUAL(2, countRange(start, LOG_ERASED - 1, first, last));
+    TEST_ASSERT_EQUAL(0, partition->writes);
+}
+
+void test_partial_flush_keeps_writes_within_pages() {
+    uint32_t start = sampleLog->now();
+    for (uint32_t n = 0; n < 6; n++) {
+        cycle(n);
+    }
+    // Five completed records go out mid-page, the batch after them only
+    // fills the rest of that page
+    sampleLog->flushCompleted();
+    for (uint32_t n = 6; n < 6 + 3 * LOG_BATCH_RECORDS; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+    TEST_ASSERT_EQUAL(0, partition->straddles);
+    // Header, the partial flush, the rest of its page, two full pages and
+    // the final flush
+    TEST_ASSERT_EQUAL(1 + 1 + 1 + 2 + 1, partition->writes);
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    TEST_ASSERT_EQUAL(6 + 3 * LOG_BATCH_RECORDS, countRange(start, LOG_ERASED - 1, first, last));
+    TEST_ASSERT_EQUAL(start, first);
+}
+
+void test_ring_wraps_and_keeps_the_newest() {
+    uint32_t capacity = sampleLog->getCapacityRecords();
+    for (uint32_t n = 0; n < capacity + 3 * LOG_RECORDS_PER_SEGMENT; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint32_t n = countRange(0, LOG_ERASED - 1, first, last);
+    TEST_ASSERT_GREATER_THAN(capacity - 2 * LOG_RECORDS_PER_SEGMENT, n);
+    TEST_ASSERT_LESS_OR_EQUAL(capacity, n);
+    TEST_ASSERT_EQUAL(sampleLog->getTimestamp(), last);
+    TEST_ASSERT_EQUAL((n - 1) * 2, last - first);
+}
+
+void test_index_rebuilt_after_reboot() {
+    for (uint32_t n = 0; n < 5 * LOG_RECORDS_PER_SEGMENT / 2; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+    uint32_t lastBefore = sampleLog->getTimestamp();
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint32_t countBefore = countRange(0, LOG_ERASED - 1, first, last);
+
+    shutdown();
+    fake::resetClock(500000);
+    uint32_t reads = 0;
+    boot();
+    reads = partition->reads;
+
+    TEST_ASSERT_EQUAL(lastBefore, sampleLog->getTimestamp());
+    // Headers plus a binary search of the head segment, not a full scan
+    TEST_ASSERT_LESS_THAN(PARTITION_SIZE / LOG_SEGMENT_SIZE + 16, reads);
+    TEST_ASSERT_EQUAL(countBefore, countRange(0, LOG_ERASED - 1, first, last));
+
+    // The clock continues after the last record until SNTP syncs
+    TEST_ASSERT_GREATER_THAN(lastBefore, sampleLog->now());
+    cycle(0);
+    cycle(1);
+    sampleLog->flush();
+    TEST_ASSERT_EQUAL(countBefore + 2, countRange(0, LOG_ERASED - 1, first, last));
+}
+
+void test_readers_not_blocked_during_erase() {
+    for (uint32_t n = 0; n < LOG_RECORDS_PER_SEGMENT; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+
+    // A web request reading the log while the loop task erases a segment
+    uint32_t queries = 0;
+    fake::onErase = [&queries]() {
+        uint32_t first = 0;
+        uint32_t last = 0;
+        queries += countRange(0, LOG_ERASED - 1, first, last) > 0;
+    };
+    uint32_t erases = partition->erases;
+    for (uint32_t n = 0; n < 2 * LOG_RECORDS_PER_SEGMENT; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+
+    TEST_ASSERT_GREATER_THAN(erases, partition->erases);
+    TEST_ASSERT_EQUAL(partition->erases - erases, queries);
+    TEST_ASSERT_EQUAL(0, fake::mutexContention);
+}
+
+void test_replay_request_is_picked_up_by_the_loop() {
+    LogRecord record;
+    TEST_ASSERT_FALSE(sampleLog->startReplay(0, LOG_ERASED - 1)); // empty log
+    TEST_ASSERT_FALSE(sampleLog->isReplayActive());
+
+    uint32_t start = sampleLog->now();
+    for (uint32_t n = 0; n < 20; n++) {
+        cycle(n);
+    }
+    sampleLog->flush();
+
+    // The web task only posts the range, the cursor is set up by the loop task
+    TEST_ASSERT_TRUE(sampleLog->startReplay(start + 10, start + 19));
+    TEST_ASSERT_TRUE(sampleLog->isReplayActive());
+
+    std::vector<uint32_t> seen;
+    while (sampleLog->peekReplay(record)) {
+        seen.push_back(record.timestamp);
+        sampleLog->advanceReplay();
+        if (seen.size() == 2) {
+            // A new request replaces the running one
+            TEST_ASSERT_TRUE(sampleLog->startReplay(start, start + 3));
+        }
+    }
+    TEST_ASSERT_EQUAL(4, seen.size());
+    TEST_ASSERT_EQUAL(start + 10, seen[0]);
+    TEST_ASSERT_EQUAL(start + 12, seen[1]);
+    TEST_ASSERT_EQUAL(start, seen[2]);
+    TEST_ASSERT_EQUAL(start + 2, seen[3]);
+    TEST_ASSERT_FALSE(sampleLog->isReplayActive());
+}
+
+void test_replay_record_kept_until_advanced() {
+    LogRecord record;
+    uint32_t start = sampleLog->now();
+    for (uint32_t n = 0; n < 4; n++) {
+        cycle(n);
+    }
+    TEST_ASSERT_TRUE(sampleLog->startReplay(start, start + 7));
+
+    // Publish failed: the same record comes back
+    TEST_ASSERT_TRUE(sampleLog->peekReplay(record));
+    TEST_ASSERT_EQUAL(start, record.timestamp);
+    TEST_ASSERT_TRUE(sampleLog->peekReplay(record));
+    TEST_ASSERT_EQUAL(start, record.timestamp);
+    sampleLog->advanceReplay();
+    sampleLog->advanceReplay(); // no second step without a peek
+    TEST_ASSERT_TRUE(sampleLog->peekReplay(record));
+    TEST_ASSERT_EQUAL(start + 2, record.timestamp);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_records_round_trip);
+    RUN_TEST(test_unflushed_records_are_queryable);
+    RUN_TEST(test_partial_flush_keeps_writes_within_pages);
+    RUN_TEST(test_ring_wraps_and_keeps_the_newest);
+    RUN_TEST(test_index_rebuilt_after_reboot);
+    RUN_TEST(test_readers_not_blocked_during_erase);
+    RUN_TEST(test_replay_request_is_picked_up_by_the_loop);
+    RUN_TEST(test_replay_record_kept_until_advanced);
+    return UNITY_END();
+}
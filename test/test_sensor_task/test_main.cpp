@@ -0,0 +1,95 @@
+// Sampling task pacing on the simulated clock: the task body runs as it
+// would on core 1, sensor reads hold the CPU for the bus time the fakes are
+// given, and the start lateness the task records is checked against it.
+// Run with -v to see the numbers.
+#include <unity.h>
+#include <Arduino.h>
+#include <DallasTemperature.h>
+#include <DHT.h>
+#include <stdio.h>
+#include "sensor_task.h"
+
+void setUp() {
+    fake::resetClock(1000000);
+    fake::resetOneWire();
+    fake::createdTasks.clear();
+    fake::addProbe(1, 21.5f);
+    fake::addProbe(2, 19.25f);
+}
+
+void tearDown() {
+    fake::stopTasksUs = UINT64_MAX;
+    fake::dhtReadUs = 0;
+}
+
+// Runs the sampling task for 'ms' of simulated time
+static void runTask(SensorTask& task, uint32_t ms) {
+    task.begin();
+    TEST_ASSERT_EQUAL(1, fake::createdTasks.size());
+    fake::CreatedTask& body = fake::createdTasks.back();
+    fake::stopTasksUs = fake::nowUs + (uint64_t)ms * 1000;
+    try {
+        body.function(body.parameter);
+    } catch (const fake::TaskStopped&) {
+    }
+}
+
+static void report(const char* label, SensorTask& task) {
+    char line[128];
+    snprintf(line, sizeof(line), "%s: %lu sample starts, lateness avg %lu us, max %lu us", label,
+             (unsigned long)task.getCycleCount(), (unsigned long)task.getJitterAvgUs(),
+             (unsigned long)task.getJitterMaxUs());
+    TEST_MESSAGE(line);
+}
+
+void test_instant_reads_start_on_time() {
+    SensorSet sensors;
+    sensors.begin();
+    SensorTask task(&sensors);
+    runTask(task, 600000);
+
+    report("no bus time", task);
+    // Both sensors every 2 s for 10 min
+    TEST_ASSERT_UINT32_WITHIN(2, 600, task.getCycleCount());
+    TEST_ASSERT_EQUAL_UINT32(0, task.getJitterMaxUs());
+}
+
+// Bus time spent after the sleep was worked out (the DHT22 read, the
+// scratchpad reads once the conversion is done) must not push the next
+// wake-up back
+void test_blocking_reads_do_not_delay_the_schedule() {
+    fake::dhtReadUs = 5000;
+    fake::oneWire.scratchpadReadUs = 10000;
+    SensorSet sensors;
+    sensors.begin();
+    SensorTask task(&sensors);
+    runTask(task, 600000);
+
+    report("5 ms DHT22 read, 2 x 10 ms scratchpad reads", task);
+    TEST_ASSERT_UINT32_WITHIN(2, 600, task.getCycleCount());
+    // Both sensors start in the same cycle, the DS18B20 after the DHT22 read
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(fake::dhtReadUs, task.getJitterMaxUs());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(fake::dhtReadUs / 2 + 1000, task.getJitterAvgUs());
+}
+
+// Reads longer than the interval: the task falls behind but still yields
+// between cycles instead of catching up back to back
+void test_overrun_yields_between_cycles() {
+    fake::oneWire.scratchpadReadUs = 1500000;
+    SensorSet sensors;
+    sensors.begin();
+    SensorTask task(&sensors);
+    runTask(task, 60000);
+
+    report("2 x 1.5 s scratchpad reads", task);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, task.getCycleCount());
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(task.getCycleCount() / 2, fake::delayCalls);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_instant_reads_start_on_time);
+    RUN_TEST(test_blocking_reads_do_not_delay_the_schedule);
+    RUN_TEST(test_overrun_yields_between_cycles);
+    return UNITY_END();
+}
@@ -0,0 +1,166 @@
+// /events with 20 dashboards connected: one small frame per client and
+// sampling cycle, every field in every frame, a stalled client costs the
+// others nothing. Prints the per-cycle cost, run with -v to see it.
+#include <unity.h>
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include "webserver.h"
+
+static const int CLIENTS = 20;
+static const int CYCLES = 600;
+
+static SensorSet* sensors;
+static SensorTask* sensorTask;
+static WiFiManager* wifiManager;
+static WebServer* webServer;
+static AsyncEventSource* events;
+static bool apMode = false;
+
+void setUp() {
+    events->clients.clear();
+    events->sends = 0;
+}
+
+void tearDown() {}
+
+static void feed(uint8_t from, uint8_t to, uint32_t n, bool valid = true) {
+    for (uint8_t ch = from; ch < to; ch++) {
+        SensorReading reading = { (uint32_t)millis(), ch, valid, 20.0f + ch + (n % 100) * 0.01f };
+        webServer->queueReading(reading);
+    }
+}
+
+// The socket writes out whatever the client had queued
+static void drainSockets() {
+    for (auto& client : events->clients) {
+        client->queued = 0;
+    }
+}
+
+static bool hasField(const std::string& frame, const char* sensor, const char* key) {
+    std::string object = "\"" + std::string(sensor) + "\":{";
+    size_t start = frame.find(object);
+    size_t end = frame.find('}', start);
+    return start != std::string::npos && frame.find("\"" + std::string(key) + "\":", start) < end;
+}
+
+void test_partial_first_frame_has_every_field() {
+    AsyncEventSourceClient* client = events->connectClient();
+
+    // Only the DHT22 temperature read so far
+    feed(0, 1, 0);
+    webServer->publishEvents();
+    TEST_ASSERT_EQUAL(1, client->frames.size());
+    const std::string& frame = client->frames[0];
+    TEST_ASSERT_TRUE(hasField(frame, "dht22", "temperature"));
+    TEST_ASSERT_TRUE(frame.find("\"humidity\":null") != std::string::npos);
+    TEST_ASSERT_TRUE(frame.find("\"heatIndex\":null") != std::string::npos);
+    TEST_ASSERT_TRUE(frame.find("\"valid\":false") != std::string::npos);
+
+    // A failed read keeps the last value and reports invalid
+    feed(0, TemperatureSensor::FIELDS, 1);
+    webServer->publishEvents();
+    TEST_ASSERT_TRUE(client->frames[1].find("\"valid\":true") != std::string::npos);
+    feed(0, TemperatureSensor::FIELDS, 2, false);
+    webServer->publishEvents();
+    TEST_ASSERT_TRUE(client->frames[2].find("\"valid\":false") != std::string::npos);
+    TEST_ASSERT_TRUE(client->frames[2].find("null") == std::string::npos);
+}
+
+void test_twenty_clients_one_frame_per_cycle() {
+    for (int c = 0; c < CLIENTS; c++) {
+        events->connectClient();
+    }
+
+    size_t bytes = 0;
+    size_t largest = 0;
+    double totalUs = 0;
+    double maxUs = 0;
+    for (int n = 0; n < CYCLES; n++) {
+        feed(0, CHANNEL_COUNT, n);
+        auto start = std::chrono::steady_clock::now();
+        webServer->publishEvents();
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        totalUs += us;
+        if (us > maxUs) {
+            maxUs = us;
+        }
+        const std::string& frame = events->clients[0]->frames.back();
+        bytes += frame.size();
+        if (frame.size() > largest) {
+            largest = frame.size();
+        }
+        drainSockets();
+        fake::advanceMs(TEMP_READ_INTERVAL);
+    }
+
+    char line[160];
+    snprintf(line, sizeof(line), "%d clients, %d cycles: frame avg %u bytes max %u, publishEvents avg %.1f us max %.1f us",
+             CLIENTS, CYCLES, (unsigned)(bytes / CYCLES), (unsigned)largest, totalUs / CYCLES, maxUs);
+    TEST_MESSAGE(line);
+
+    // One frame built per cycle and handed to every client
+    TEST_ASSERT_EQUAL(CYCLES, events->sends);
+    for (auto& client : events->clients) {
+        TEST_ASSERT_EQUAL(CYCLES, client->frames.size());
+        TEST_ASSERT_EQUAL(0, client->dropped);
+        TEST_ASSERT_EQUAL(events->clients[0]->lastId(), client->lastId());
+    }
+    TEST_ASSERT_LESS_THAN(WEB_EVENT_MAX, largest);
+    TEST_ASSERT_LESS_THAN(200, bytes / CYCLES);
+    const std::string& last = events->clients[CLIENTS - 1]->frames.back();
+    TEST_ASSERT_TRUE(hasField(last, "dht22", "humidity"));
+    TEST_ASSERT_TRUE(hasField(last, "ds18b20", "temperature"));
+    TEST_ASSERT_TRUE(last.find("null") == std::string::npos);
+}
+
+void test_no_frame_without_new_readings() {
+    AsyncEventSourceClient* client = events->connectClient();
+    feed(0, CHANNEL_COUNT, 0);
+    webServer->publishEvents();
+    for (int i = 0; i < 10; i++) {
+        webServer->publishEvents();
+    }
+    TEST_ASSERT_EQUAL(1, client->frames.size());
+}
+
+void test_stalled_client_does_not_hold_back_the_others() {
+    for (int c = 0; c < CLIENTS; c++) {
+        events->connectClient();
+    }
+    AsyncEventSourceClient* stalled = events->clients[0].get();
+
+    for (int n = 0; n < 100; n++) {
+        feed(0, CHANNEL_COUNT, n);
+        webServer->publishEvents();
+        // Every socket but the first keeps up
+        for (int c = 1; c < CLIENTS; c++) {
+            events->clients[c]->queued = 0;
+        }
+    }
+    TEST_ASSERT_EQUAL(stalled->queueLimit, stalled->frames.size());
+    TEST_ASSERT_EQUAL(100 - stalled->queueLimit, stalled->dropped);
+    for (int c = 1; c < CLIENTS; c++) {
+        TEST_ASSERT_EQUAL(100, events->clients[c]->frames.size());
+    }
+}
+
+int main(int argc, char** argv) {
+    sensors = new SensorSet();
+    sensors->begin();
+    sensorTask = new SensorTask(sensors);
+    wifiManager = new WiFiManager();
+    webServer = new WebServer(wifiManager, sensors, sensorTask, nullptr, nullptr, nullptr, nullptr, &apMode);
+    webServer->begin();
+    events = static_cast<AsyncEventSource*>(fake::webServers().back()->handlers[0]);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_partial_first_frame_has_every_field);
+    RUN_TEST(test_twenty_clients_one_frame_per_cycle);
+    RUN_TEST(test_no_frame_without_new_readings);
+    RUN_TEST(test_stalled_client_does_not_hold_back_the_others);
+    return UNITY_END();
+}
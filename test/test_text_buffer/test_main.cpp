@@ -0,0 +1,79 @@
+// TextBuffer: appendFloat() byte-identical to %.2f, padding and overflow
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "text_buffer.h"
+
+static char buffer[64];
+
+static void assertLikePrintf(float value) {
+    char expected[64];
+    snprintf(expected, sizeof(expected), "%.2f", value);
+    TextBuffer out(buffer, sizeof(buffer));
+    out.appendFloat(value);
+    TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, out.c_str(), expected);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_ties_round_to_even_like_printf() {
+    assertLikePrintf(0.125f);   // 0.12
+    assertLikePrintf(0.375f);   // 0.38
+    assertLikePrintf(-0.125f);
+    assertLikePrintf(2.675f);   // just below the tie as a float
+    assertLikePrintf(1.005f);
+}
+
+void test_negative_zero_keeps_its_sign() {
+    assertLikePrintf(-0.004f);  // -0.00
+    assertLikePrintf(-0.0f);
+    assertLikePrintf(0.004f);
+}
+
+void test_sweep_matches_printf() {
+    for (long i = -400000; i <= 400000; i++) {
+        assertLikePrintf(i / 8000.0f);
+    }
+    for (float value = 1e-3f; value < 2e7f; value *= 1.37f) {
+        assertLikePrintf(value);
+        assertLikePrintf(-value);
+    }
+}
+
+void test_out_of_range_falls_back_to_printf() {
+    assertLikePrintf(NAN);
+    assertLikePrintf(INFINITY);
+    assertLikePrintf(-3e9f);
+}
+
+void test_width_pads_like_dtostrf() {
+    TextBuffer out(buffer, sizeof(buffer));
+    out.appendFloat(21.5f, 6);
+    out.append('|');
+    out.appendFloat(-3.25f, 6);
+    out.append('|');
+    out.appendFloat(123456.0f, 6);
+    TEST_ASSERT_EQUAL_STRING(" 21.50| -3.25|123456.00", out.c_str());
+}
+
+void test_overflow_drops_the_whole_append() {
+    char small[8];
+    TextBuffer out(small, sizeof(small));
+    out.append("abc");
+    out.appendFloat(12345.67f);
+    TEST_ASSERT_TRUE(out.hasOverflowed());
+    TEST_ASSERT_EQUAL_STRING("abc", out.c_str());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ties_round_to_even_like_printf);
+    RUN_TEST(test_negative_zero_keeps_its_sign);
+    RUN_TEST(test_sweep_matches_printf);
+    RUN_TEST(test_out_of_range_falls_back_to_printf);
+    RUN_TEST(test_width_pads_like_dtostrf);
+    RUN_TEST(test_overflow_drops_the_whole_append);
+    return UNITY_END();
+}
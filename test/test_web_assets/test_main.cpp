@@ -0,0 +1,115 @@
+// Static pages from web_assets.h: gzip body with ETag and Cache-Control, and
+// an empty 304 when If-None-Match names the current ETag. Whether the
+// header is up to date with the pages is checked by
+// tools/build_web_assets.py, which fails the native build when it is stale.
+#include <unity.h>
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <ctype.h>
+#include <memory>
+#include <string>
+#include "webserver.h"
+#include "web_assets.h"
+
+static AsyncWebServer* server;
+static bool apMode = false;
+
+static const struct {
+    const char* path;
+    const WebAsset* asset;
+} pages[] = {
+    { "/", &index_html_asset },
+    { "/dashboard", &dashboard_html_asset },
+    { "/device", &deviceinfo_html_asset },
+};
+
+void setUp() {}
+void tearDown() {}
+
+static std::unique_ptr<AsyncWebServerRequest> get(const char* path, const char* ifNoneMatch = nullptr) {
+    std::unique_ptr<AsyncWebServerRequest> request(new AsyncWebServerRequest(path));
+    if (ifNoneMatch) {
+        request->addHeader("If-None-Match", ifNoneMatch);
+    }
+    TEST_ASSERT_TRUE(server->handle(*request));
+    TEST_ASSERT_NOT_NULL(request->response.get());
+    return request;
+}
+
+void test_pages_are_sent_gzipped_with_etag() {
+    for (const auto& page : pages) {
+        auto request = get(page.path);
+        AsyncWebServerResponse& response = *request->response;
+        TEST_ASSERT_EQUAL(200, response.code);
+        TEST_ASSERT_EQUAL_STRING("text/html", response.contentType.c_str());
+        TEST_ASSERT_EQUAL_STRING("gzip", response.headers.at("Content-Encoding").c_str());
+        TEST_ASSERT_EQUAL_STRING(page.asset->etag, response.headers.at("ETag").c_str());
+        TEST_ASSERT_EQUAL_STRING("public, max-age=86400", response.headers.at("Cache-Control").c_str());
+
+        std::string body = response.drain(536);
+        TEST_ASSERT_EQUAL(page.asset->length, body.size());
+        TEST_ASSERT_EQUAL_MEMORY(page.asset->data, body.data(), body.size());
+        // gzip magic, and no timestamp so the bytes and the ETag only
+        // change with the page
+        TEST_ASSERT_EQUAL_HEX8(0x1f, (uint8_t)body[0]);
+        TEST_ASSERT_EQUAL_HEX8(0x8b, (uint8_t)body[1]);
+        TEST_ASSERT_EQUAL(0, body[4] | body[5] | body[6] | body[7]);
+    }
+}
+
+void test_etags_are_strong_and_distinct() {
+    for (const auto& page : pages) {
+        std::string etag = page.asset->etag;
+        TEST_ASSERT_EQUAL(18, etag.size());
+        TEST_ASSERT_EQUAL('"', etag.front());
+        TEST_ASSERT_EQUAL('"', etag.back());
+        for (size_t i = 1; i < etag.size() - 1; i++) {
+            TEST_ASSERT_TRUE(isxdigit((unsigned char)etag[i]));
+        }
+    }
+    TEST_ASSERT_TRUE(strcmp(index_html_asset.etag, dashboard_html_asset.etag) != 0);
+    TEST_ASSERT_TRUE(strcmp(index_html_asset.etag, deviceinfo_html_asset.etag) != 0);
+    TEST_ASSERT_TRUE(strcmp(dashboard_html_asset.etag, deviceinfo_html_asset.etag) != 0);
+}
+
+void test_matching_if_none_match_gets_empty_304() {
+    for (const auto& page : pages) {
+        auto request = get(page.path, page.asset->etag);
+        AsyncWebServerResponse& response = *request->response;
+        TEST_ASSERT_EQUAL(304, response.code);
+        TEST_ASSERT_TRUE(response.drain().empty());
+        TEST_ASSERT_EQUAL(0, response.headers.count("Content-Encoding"));
+        // The browser refreshes its cache entry from these
+        TEST_ASSERT_EQUAL_STRING(page.asset->etag, response.headers.at("ETag").c_str());
+        TEST_ASSERT_EQUAL_STRING("public, max-age=86400", response.headers.at("Cache-Control").c_str());
+    }
+}
+
+void test_if_none_match_may_list_several_tags() {
+    std::string tags = std::string("\"0123456789abcdef\", ") + dashboard_html_asset.etag;
+    TEST_ASSERT_EQUAL(304, get("/dashboard", tags.c_str())->response->code);
+}
+
+void test_other_etag_gets_the_page() {
+    // The tag of another page, or of an older build of this one
+    TEST_ASSERT_EQUAL(200, get("/dashboard", index_html_asset.etag)->response->code);
+    TEST_ASSERT_EQUAL(200, get("/device", "\"0123456789abcdef\"")->response->code);
+}
+
+int main(int argc, char** argv) {
+    SensorSet* sensors = new SensorSet();
+    sensors->begin();
+    SensorTask* sensorTask = new SensorTask(sensors);
+    WiFiManager* wifiManager = new WiFiManager();
+    WebServer* webServer = new WebServer(wifiManager, sensors, sensorTask, nullptr, nullptr, nullptr, nullptr, &apMode);
+    webServer->begin();
+    server = fake::webServers().back();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_pages_are_sent_gzipped_with_etag);
+    RUN_TEST(test_etags_are_strong_and_distinct);
+    RUN_TEST(test_matching_if_none_match_gets_empty_304);
+    RUN_TEST(test_if_none_match_may_list_several_tags);
+    RUN_TEST(test_other_etag_gets_the_page);
+    return UNITY_END();
+}
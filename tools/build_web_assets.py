@@ -0,0 +1,123 @@
+"""Minify and gzip the web pages into src/web_assets.h.
+
+The pages are edited in src/*_html.h as PROGMEM raw string literals. This
+script runs before every PlatformIO build (extra_scripts in platformio.ini)
+and can also be run by hand: python tools/build_web_assets.py
+
+The header is committed so the tree builds without this script. With
+--check, and in the native test env, it is not written: the script fails
+if the committed header is stale, i.e. a page was edited without
+regenerating it.
+
+Each page becomes a gzip byte array plus a strong ETag taken from the hash of
+the compressed bytes. The output is deterministic (no gzip timestamp), so the
+header only changes when a page does.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "src")
+OUTPUT = os.path.join(SRC, "web_assets.h")
+
+# (source header, array name in it)
+PAGES = [
+    ("webserver_html.h", "index_html"),
+    ("dashboard_html.h", "dashboard_html"),
+    ("deviceinfo_html.h", "deviceinfo_html"),
+]
+
+
+def extract(path, name):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    match = re.search(r"const char " + name + r'\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";', text, re.S)
+    if not match:
+        raise SystemExit("build_web_assets: %s not found in %s" % (name, path))
+    return match.group(1)
+
+
+def minify(html):
+    # Conservative: the pages have no <pre> or multi-line JS strings, so
+    # indentation, blank lines and comments can go. Line breaks stay, JS
+    # relies on them for semicolon insertion. Only whole-line // comments
+    # inside <script> are dropped, a line of page text may start with //.
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    html = re.sub(r"<style>.*?</style>",
+                  lambda m: re.sub(r"/\*.*?\*/", "", m.group(0), flags=re.S), html, flags=re.S)
+    lines = []
+    in_script = False
+    for line in html.splitlines():
+        line = line.strip()
+        if in_script and line.startswith("//"):
+            continue
+        if re.search(r"<script[ >]", line):
+            in_script = True
+        if "</script>" in line:
+            in_script = False
+        if line:
+            lines.append(line)
+    return "\n".join(lines)
+
+
+def to_c_array(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def build(check=False):
+    parts = [
+        "// Generated by tools/build_web_assets.py from the *_html.h pages, do not edit",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// A gzip-compressed page and its strong ETag",
+        "struct WebAsset {",
+        "    const uint8_t* data;",
+        "    size_t length;",
+        "    const char* etag;",
+        "};",
+    ]
+    for source, name in PAGES:
+        html = extract(os.path.join(SRC, source), name)
+        data = gzip.compress(minify(html).encode("utf-8"), 9, mtime=0)
+        etag = hashlib.sha256(data).hexdigest()[:16]
+        parts += [
+            "",
+            "// %s: %d bytes, %d gzipped" % (source, len(html.encode("utf-8")), len(data)),
+            "const uint8_t %s_gz[] PROGMEM = {" % name,
+            to_c_array(data),
+            "};",
+            'const WebAsset %s_asset = { %s_gz, sizeof(%s_gz), "\\"%s\\"" };' % (name, name, name, etag),
+        ]
+    parts += ["", "#endif // WEB_ASSETS_H", ""]
+    output = "\n".join(parts)
+
+    current = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, encoding="utf-8") as f:
+            current = f.read()
+    if output == current:
+        return
+    if check:
+        raise SystemExit("build_web_assets: %s is stale, run python tools/build_web_assets.py"
+                         % os.path.relpath(OUTPUT, ROOT))
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(output)
+    print("build_web_assets: updated %s" % os.path.relpath(OUTPUT, ROOT))
+
+
+try:
+    Import("env")  # noqa: F821, PlatformIO pre-script
+    check = env["PIOENV"] == "native"  # noqa: F821
+except NameError:
+    check = "--check" in sys.argv[1:]
+build(check)